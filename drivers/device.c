@@ -250,37 +250,40 @@ int device_erase(device_erase_type_t et, address_t addr)
 		return 0;
 	}
 
+	device_default->mem_gen++;
 	return device_default->type->erase(device_default, et, addr);
 }
 
+static const struct chipinfo_memory default_memory[] = {
+	{
+		.name		= "DefaultFlash",
+		.type		= CHIPINFO_MEMTYPE_FLASH,
+		.bits		= 20,
+		.mapped		= 1,
+		.size		= 0xff000,
+		.offset		= 0x01000,
+		.seg_size	= 0,
+		.bank_size	= 0,
+		.banks		= 1,
+	},
+	{
+		.name		= "DefaultRam",
+		.type		= CHIPINFO_MEMTYPE_RAM,
+		.bits		= 20,
+		.mapped		= 1,
+		.size		= 0x01000,
+		.offset		= 0x00000,
+		.seg_size	= 0,
+		.bank_size	= 0,
+		.banks		= 1,
+	},
+	{0}
+};
+
 static const struct chipinfo default_chip = {
 		.name		= "DefaultChip",
 		.bits		= 20,
-		.memory		= {
-			{
-				.name		= "DefaultFlash",
-				.type		= CHIPINFO_MEMTYPE_FLASH,
-				.bits		= 20,
-				.mapped		= 1,
-				.size		= 0xff000,
-				.offset		= 0x01000,
-				.seg_size	= 0,
-				.bank_size	= 0,
-				.banks		= 1,
-			},
-			{
-				.name		= "DefaultRam",
-				.type		= CHIPINFO_MEMTYPE_RAM,
-				.bits		= 20,
-				.mapped		= 1,
-				.size		= 0x01000,
-				.offset		= 0x00000,
-				.seg_size	= 0,
-				.bank_size	= 0,
-				.banks		= 1,
-			},
-			{0}
-		},
+		.memory		= default_memory,
 	};
 
 /* Given an address range, specified by a start and a size (in bytes),
@@ -146,6 +146,12 @@ struct device {
 	 */
 	const struct chipinfo *chip;
 	int need_probe;
+
+	/* Incremented whenever device memory might have changed: when
+	 * it's written or erased, or when the CPU is allowed to run. This
+	 * tells cached copies of memory when they're stale.
+	 */
+	unsigned int mem_gen;
 };
 
 /* Probe the device memory and extract ID bytes. This should be called
@@ -176,15 +182,18 @@ extern device_t device_default;
 #define device_readmem(addr, mem, len) \
 	device_default->type->readmem(device_default, addr, mem, len)
 #define device_writemem(addr, mem, len) \
-	device_default->type->writemem(device_default, addr, mem, len)
+	(device_default->mem_gen++, \
+	 device_default->type->writemem(device_default, addr, mem, len))
 #define device_getregs(regs) \
 	device_default->type->getregs(device_default, regs)
 #define device_setregs(regs) \
 	device_default->type->setregs(device_default, regs)
 #define device_ctl(op) \
-	device_default->type->ctl(device_default, op)
+	(device_default->mem_gen++, \
+	 device_default->type->ctl(device_default, op))
 #define device_poll() \
-	device_default->type->poll(device_default)
+	(device_default->mem_gen++, \
+	 device_default->type->poll(device_default))
 
 int device_erase(device_erase_type_t et, address_t addr);
 
@@ -36,7 +36,10 @@
 #include "fet_db.h"
 #include "output.h"
 #include "opdb.h"
+#include "record.h"
 #include "ctrlc.h"
+#include "thread.h"
+#include "spsc.h"
 
 #include "fet_olimex_db.h"
 #include "devicelist.h"
@@ -47,10 +50,12 @@ struct fet_device {
 	int                             version;
 	int				fet_flags;
 
-	int				poll_enable;
-
 	struct fet_proto		proto;
 	fperm_t				active_fperm;
+
+	/* Power profiling, if supported */
+	thread_lock_t			xfer_lock;
+	struct power_sampler		*sampler;
 };
 
 /**********************************************************************
@@ -397,8 +402,58 @@ static int do_identify(struct fet_device *dev, const char *force_id)
 	return try_new(dev, force_id);
 }
 
+/**********************************************************************
+ * Power profiling
+ *
+ * While the target is running, power data is fetched by a sampling
+ * thread, so that the FET's buffer is drained at a steady rate however
+ * often the device is polled. The thread has a protocol parser of its
+ * own, and transfers are serialized by xfer_lock. Raw data is passed
+ * back through a lock-free queue, and decoded into the power buffer
+ * whenever the device is polled.
+ */
+
+#define POWER_POLL_MS		10
+#define POWER_QUEUE_SIZE	1048576
+
+struct power_sampler {
+	struct fet_proto	proto;
+	thread_t		thread;
+	int			running;
+
+	/* Raw sample data, in the FET's format */
+	struct spsc		queue;
+
+	/* Set by the main thread to stop the sampling thread, and by
+	 * the sampling thread if a transfer fails.
+	 */
+	int			stop;
+	int			failed;
+
+	/* Samples discarded because the queue was full */
+	unsigned int		dropped;
+};
+
+static void power_free(struct fet_device *dev)
+{
+	if (dev->sampler) {
+		dev->proto.lock = NULL;
+		thread_lock_destroy(&dev->xfer_lock);
+		spsc_destroy(&dev->sampler->queue);
+		free(dev->sampler);
+		dev->sampler = NULL;
+	}
+
+	if (dev->base.power_buf) {
+		powerbuf_free(dev->base.power_buf);
+		dev->base.power_buf = NULL;
+	}
+}
+
 static void power_init(struct fet_device *dev)
 {
+	struct power_sampler *s;
+
 	if (fet_proto_xfer(&dev->proto, C_CMM_PARAM, NULL, 0, 0) < 0) {
 		printc_err("warning: device does not support power "
 			   "profiling\n");
@@ -414,7 +469,15 @@ static void power_init(struct fet_device *dev)
 
 	printc("Power profiling enabled: bufsize = %d bytes, %d us/sample\n",
 		dev->proto.argv[1], dev->proto.argv[0]);
-	printc_shell("power-sample-us %d\n", dev->proto.argv[0]);
+	if (record_enabled()) {
+		struct record r;
+
+		record_begin(&r, "power-sample-us");
+		record_int(&r, "period", dev->proto.argv[0]);
+		record_end(&r);
+	} else {
+		printc_shell("power-sample-us %d\n", dev->proto.argv[0]);
+	}
 
 	dev->base.power_buf = powerbuf_new(POWERBUF_DEFAULT_SAMPLES,
 		dev->proto.argv[0]);
@@ -422,44 +485,86 @@ static void power_init(struct fet_device *dev)
 		printc_err("Failed to allocate memory for power profile\n");
 		return;
 	}
+
+	s = malloc(sizeof(*s));
+	if (!s || spsc_init(&s->queue, 1, POWER_QUEUE_SIZE) < 0) {
+		printc_err("Failed to allocate memory for power profile\n");
+		free(s);
+		power_free(dev);
+		return;
+	}
+
+	dev->sampler = s;
+	s->running = 0;
+
+	thread_lock_init(&dev->xfer_lock);
+	dev->proto.lock = &dev->xfer_lock;
+	fet_proto_init(&s->proto, dev->proto.transport,
+		       dev->proto.proto_flags);
+	s->proto.lock = &dev->xfer_lock;
 }
 
-static int power_start(struct fet_device *dev)
+static int count_samples(const uint8_t *data, int len)
 {
-	if (!dev->base.power_buf)
-		return 0;
+	int count = 0;
+	int i;
 
-	if (fet_proto_xfer(&dev->proto, C_CMM_CTRL, NULL, 0, 1, 1) < 0) {
-		printc_err("fet: failed to start power profiling, "
-			   "disabling\n");
-		powerbuf_free(dev->base.power_buf);
-		dev->base.power_buf = NULL;
-		return -1;
-	}
+	for (i = 0; i + 3 < len; i += 4)
+		if (!(data[i + 3] & 0x80))
+			count++;
 
-	powerbuf_begin_session(dev->base.power_buf, time(NULL));
-	dev->poll_enable = 1;
-	return 0;
+	return count;
 }
 
-static int power_end(struct fet_device *dev)
+static void sampler_worker(void *thread_arg)
 {
-	if (!dev->base.power_buf)
-		return 0;
+	struct power_sampler *s = (struct power_sampler *)thread_arg;
 
-	powerbuf_end_session(dev->base.power_buf);
-	dev->poll_enable = 0;
+	while (!__atomic_load_n(&s->stop, __ATOMIC_ACQUIRE)) {
+		int len;
 
-	if (fet_proto_xfer(&dev->proto, C_CMM_CTRL, NULL, 0, 1, 1) < 0) {
-		printc_err("fet: failed to end power profiling\n");
-		return -1;
+		if (fet_proto_xfer(&s->proto, C_CMM_READ, NULL, 0, 0) < 0) {
+			__atomic_store_n(&s->failed, 1, __ATOMIC_RELEASE);
+			break;
+		}
+
+		len = s->proto.datalen & ~3;
+
+		/* Each read is queued whole, or not at all */
+		if (spsc_room(&s->queue) >= len)
+			spsc_push(&s->queue, s->proto.data, len);
+		else
+			__atomic_add_fetch(&s->dropped,
+				count_samples(s->proto.data, len),
+				__ATOMIC_RELAXED);
+
+		delay_ms(POWER_POLL_MS);
 	}
+}
 
-	return 0;
+static void sampler_stop(struct fet_device *dev)
+{
+	struct power_sampler *s = dev->sampler;
+
+	if (!s || !s->running)
+		return;
+
+	__atomic_store_n(&s->stop, 1, __ATOMIC_RELEASE);
+	thread_join(s->thread);
+	s->running = 0;
 }
 
 static void shell_power(const uint8_t *data, int len)
 {
+	if (record_enabled()) {
+		struct record r;
+
+		record_begin(&r, "power-samples");
+		record_data(&r, "data", data, len);
+		record_end(&r);
+		return;
+	}
+
 	while (len > 0) {
 		int plen = 128;
 		char text[256];
@@ -475,43 +580,100 @@ static void shell_power(const uint8_t *data, int len)
 	}
 }
 
-static int power_poll(struct fet_device *dev)
+/* Decode whatever the sampling thread has queued into the power
+ * buffer.
+ */
+static int power_drain(struct fet_device *dev)
 {
-	address_t mab;
-	address_t mab_samples[1024];
-	unsigned int cur_samples[1024];
-	unsigned int count = 0;
-	int i;
+	struct power_sampler *s = dev->sampler;
+	uint8_t data[4096];
+	address_t mab_samples[ARRAY_LEN(data) / 4];
+	unsigned int cur_samples[ARRAY_LEN(data) / 4];
+	address_t mab = powerbuf_last_mab(dev->base.power_buf);
+	int len;
 
-	if (!dev->base.power_buf || !dev->poll_enable)
-		return 0;
+	while ((len = spsc_pop(&s->queue, data, sizeof(data))) > 0) {
+		unsigned int count = 0;
+		int i;
+
+		shell_power(data, len);
+
+		for (i = 0; i + 3 < len; i += 4) {
+			uint32_t w = LE_LONG(data, i);
+
+			if (w & 0x80000000) {
+				mab = w & 0x7fffffff;
+			} else {
+				cur_samples[count] = w;
+				mab_samples[count] = mab;
+				count++;
+			}
+		}
+
+		powerbuf_add_samples(dev->base.power_buf, count,
+				     cur_samples, mab_samples);
+	}
+
+	dev->base.power_buf->dropped +=
+		__atomic_exchange_n(&s->dropped, 0, __ATOMIC_RELAXED);
 
-	if (fet_proto_xfer(&dev->proto, C_CMM_READ, NULL, 0, 0) < 0) {
+	if (__atomic_load_n(&s->failed, __ATOMIC_ACQUIRE)) {
 		printc_err("fet: failed to fetch power data, disabling\n");
-		power_end(dev);
-		powerbuf_free(dev->base.power_buf);
-		dev->base.power_buf = NULL;
-		dev->poll_enable = 0;
+		sampler_stop(dev);
+		powerbuf_end_session(dev->base.power_buf);
+		fet_proto_xfer(&dev->proto, C_CMM_CTRL, NULL, 0, 1, 1);
+		power_free(dev);
 		return -1;
 	}
 
-	shell_power(dev->proto.data, dev->proto.datalen);
+	return 0;
+}
 
-	mab = powerbuf_last_mab(dev->base.power_buf);
-	for (i = 0; i + 3 < dev->proto.datalen; i += 4) {
-		uint32_t s = LE_LONG(dev->proto.data, i);
+static int power_start(struct fet_device *dev)
+{
+	struct power_sampler *s = dev->sampler;
 
-		if (s & 0x80000000) {
-			mab = s & 0x7fffffff;
-		} else if (count + 1 < ARRAY_LEN(cur_samples)) {
-			cur_samples[count] = s;
-			mab_samples[count] = mab;
-			count++;
-		}
+	if (!dev->base.power_buf)
+		return 0;
+
+	if (fet_proto_xfer(&dev->proto, C_CMM_CTRL, NULL, 0, 1, 1) < 0) {
+		printc_err("fet: failed to start power profiling, "
+			   "disabling\n");
+		power_free(dev);
+		return -1;
 	}
 
-	powerbuf_add_samples(dev->base.power_buf, count,
-			     cur_samples, mab_samples);
+	powerbuf_begin_session(dev->base.power_buf, time(NULL));
+
+	s->stop = 0;
+	s->failed = 0;
+	if (thread_create(&s->thread, sampler_worker, s) < 0) {
+		printc_err("fet: failed to start power sampling "
+			   "thread, disabling\n");
+		fet_proto_xfer(&dev->proto, C_CMM_CTRL, NULL, 0, 1, 1);
+		power_free(dev);
+		return -1;
+	}
+
+	s->running = 1;
+	return 0;
+}
+
+static int power_end(struct fet_device *dev)
+{
+	if (!dev->base.power_buf || !dev->sampler->running)
+		return 0;
+
+	sampler_stop(dev);
+	if (power_drain(dev) < 0)
+		return -1;
+
+	powerbuf_end_session(dev->base.power_buf);
+
+	if (fet_proto_xfer(&dev->proto, C_CMM_CTRL, NULL, 0, 1, 1) < 0) {
+		printc_err("fet: failed to end power profiling\n");
+		return -1;
+	}
 
 	return 0;
 }
@@ -620,10 +782,10 @@ device_status_t fet_poll(device_t dev_base)
 		return DEVICE_STATUS_ERROR;
 	}
 
-	if (dev->base.power_buf)
-		power_poll(dev);
-	else
-		delay_ms(50);
+	if (dev->base.power_buf && dev->sampler->running)
+		power_drain(dev);
+
+	delay_ms(50);
 
 	if (!(dev->proto.argv[0] & FET_POLL_RUNNING)) {
 		power_end(dev);
@@ -730,6 +892,8 @@ void fet_destroy(device_t dev_base)
 {
 	struct fet_device *dev = (struct fet_device *)dev_base;
 
+	sampler_stop(dev);
+
 	if (dev->fet_flags & FET_SKIP_CLOSE) {
 		printc_dbg("Skipping close procedure\n");
 	} else {
@@ -749,10 +913,10 @@ void fet_destroy(device_t dev_base)
 		if (fet_proto_xfer(&dev->proto, C_CLOSE, NULL, 0, 1, 0) < 0)
 			printc_err("fet: close command failed\n");
 
-		if (dev->base.power_buf)
-			powerbuf_free(dev->base.power_buf);
 	}
 
+	power_free(dev);
+
 	dev->proto.transport->ops->destroy(dev->proto.transport);
 	free(dev);
 }
@@ -345,23 +345,13 @@ void fet_proto_init(struct fet_proto *dev, transport_t transport,
 	dev->transport = transport;
 	dev->proto_flags = proto_flags;
 	dev->fet_len = 0;
+	dev->lock = NULL;
 }
 
-int fet_proto_xfer(struct fet_proto *dev,
+static int do_xfer(struct fet_proto *dev,
 		   int command_code, const uint8_t *data, int datalen,
-		   int nparams, ...)
+		   uint32_t *params, int nparams)
 {
-	uint32_t params[FET_PROTO_MAX_PARAMS];
-	int i;
-	va_list ap;
-
-	assert (nparams <= FET_PROTO_MAX_PARAMS);
-
-	va_start(ap, nparams);
-	for (i = 0; i < nparams; i++)
-		params[i] = va_arg(ap, uint32_t);
-	va_end(ap);
-
 	if (data && (dev->proto_flags & FET_PROTO_SEPARATE_DATA)) {
 		assert (nparams + 1 <= FET_PROTO_MAX_PARAMS);
 		params[nparams++] = datalen;
@@ -388,3 +378,30 @@ int fet_proto_xfer(struct fet_proto *dev,
 
 	return 0;
 }
+
+int fet_proto_xfer(struct fet_proto *dev,
+		   int command_code, const uint8_t *data, int datalen,
+		   int nparams, ...)
+{
+	uint32_t params[FET_PROTO_MAX_PARAMS];
+	int i;
+	int ret;
+	va_list ap;
+
+	assert (nparams <= FET_PROTO_MAX_PARAMS);
+
+	va_start(ap, nparams);
+	for (i = 0; i < nparams; i++)
+		params[i] = va_arg(ap, uint32_t);
+	va_end(ap);
+
+	if (!dev->lock)
+		return do_xfer(dev, command_code, data, datalen,
+			       params, nparams);
+
+	thread_lock_acquire(dev->lock);
+	ret = do_xfer(dev, command_code, data, datalen, params, nparams);
+	thread_lock_release(dev->lock);
+
+	return ret;
+}
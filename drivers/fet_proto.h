@@ -22,6 +22,7 @@
 #include <stdint.h>
 
 #include "transport.h"
+#include "thread.h"
 
 /* Send data in separate packets, as in the RF2500 */
 #define FET_PROTO_SEPARATE_DATA		0x01
@@ -55,6 +56,11 @@ struct fet_proto {
 
 	uint8_t				*data;
 	int				datalen;
+
+	/* If set, transfers are serialized by this lock. This allows
+	 * several parsers to share a transport from different threads.
+	 */
+	thread_lock_t			*lock;
 };
 
 /* Initialize a FET protocol parser */
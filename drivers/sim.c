@@ -21,6 +21,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <ctype.h>
+#include <time.h>
 #include "device.h"
 #include "dis.h"
 #include "util.h"
@@ -28,6 +29,7 @@
 #include "sim.h"
 #include "simio_cpu.h"
 #include "ctrlc.h"
+#include "cycles.h"
 
 #define MEM_SIZE	(1<<17)
 
@@ -43,6 +45,7 @@ struct sim_device {
 
 	int                     running;
 	uint32_t                current_insn;
+	simio_insn_t		insn_class;
 
 	int			watchpoint_hit;
 
@@ -313,21 +316,6 @@ static int store_operand(struct sim_device *dev,
 
 #define ARITH_BITS (MSP430_SR_V | MSP430_SR_N | MSP430_SR_Z | MSP430_SR_C)
 
-static int determine_op_width(uint16_t ins, uint16_t ext)
-{
-	uint16_t opcode = ins & 0xff80;
-
-	/* handle inconsistent SXTX and SWPBX encoding */
-	if (ext && (opcode == MSP430_OP_SWPB || opcode == MSP430_OP_SXT))
-		return (ins & 0x40) ? WIDTH_UNDEFINED : (ext & 0x40) ? 16 : 20;
-
-	else if (!ext || (ext & 0x0040))
-		return (ins & 0x0040) ? 8 : 16;
-
-	else
-		return (ins & 0x0040) ? 20 : WIDTH_UNDEFINED;
-}
-
 static int step_double(struct sim_device *dev, uint16_t ins, uint16_t ext)
 {
 	uint16_t opcode = ins & 0xf000;
@@ -345,7 +333,7 @@ static int step_double(struct sim_device *dev, uint16_t ins, uint16_t ext)
 	int rept = 1;
 	uint16_t zc_sr_mask = ~0;
 
-	int opwidth = determine_op_width(ins,ext);
+	int opwidth = cycles_op_width(ins, ext);
 	if (opwidth == WIDTH_UNDEFINED) {
 		printc_err("%s: invalid op width encoding at PC = 0x%04x\n",
 			SIMx,dev->current_insn);
@@ -368,66 +356,7 @@ static int step_double(struct sim_device *dev, uint16_t ins, uint16_t ext)
 			zc_sr_mask = ~MSP430_SR_C;
 	}
 
-	if (!dev->cpux) { /* original CPU timing */
-
-		if (amode_dst == MSP430_AMODE_REGISTER && dreg == MSP430_REG_PC) {
-			if (amode_src == MSP430_AMODE_REGISTER ||
-			    amode_src == MSP430_AMODE_INDIRECT)
-				cycles = 2;
-			else
-				cycles = 3;
-		} else if (sreg == MSP430_REG_SR || sreg == MSP430_REG_R3) {
-			if (amode_dst == MSP430_AMODE_REGISTER)
-				cycles = 1;
-			else
-				cycles = 4;
-		} else {
-			if (amode_src == MSP430_AMODE_INDIRECT ||
-			    amode_src == MSP430_AMODE_INDIRECT_INC)
-				cycles = 2;
-			else if (amode_src == MSP430_AMODE_INDEXED)
-				cycles = 3;
-			else
-				cycles = 1;
-
-			if (amode_dst == MSP430_AMODE_INDEXED)
-				cycles += 3;
-		}
-
-	} else { /* CPUX timing */
-		cycles = 1;					/* read opcode */
-		if (ext) cycles += 1;		/* read ext wd */
-
-		if (amode_src == MSP430_AMODE_INDEXED)
-			cycles += 1;			/* read offset */
-
-		if (amode_src != MSP430_AMODE_REGISTER) {
-			cycles += 1;			/* read src value */
-			if (opwidth > 16 && (sreg != MSP430_REG_PC || amode_src != MSP430_AMODE_INDIRECT_INC))
-				cycles += 1;		/* read src value high bits */
-		}
-		if (amode_dst == MSP430_AMODE_INDEXED) {
-			cycles += 1;			/* read offset; */
-			if (opcode != MSP430_OP_MOV) {
-				cycles += 1;		/* read dst value */
-				if (opwidth > 16)
-					cycles += 1;	/* read dst value high bits */
-			}
-			if (opcode != MSP430_OP_BIT && opcode != MSP430_OP_CMP) {
-				cycles += 1;		/* write dst value */
-				if (opwidth > 16)
-					cycles += 1;	/* write dst value high bits */
-			}
-		} else if (dreg == MSP430_REG_PC) {
-			if (opcode != MSP430_OP_MOV
-					&& opcode != MSP430_OP_ADD
-					&& opcode != MSP430_OP_SUB)
-				cycles += 1;	/* pipelining hit */
-			if (amode_src != MSP430_AMODE_INDIRECT_INC || sreg != MSP430_REG_PC)
-				cycles += 1;	/* pipelining hit */
-		}
-		cycles += rept - 1;
-	}
+	cycles = cycles_double(ins, ext, opwidth, rept, dev->cpux);
 
 	if (fetch_operand(dev, amode_src, sreg, opwidth, NULL, &src_data, ext, ext_src_bits) < 0)
 		return -1;
@@ -575,7 +504,7 @@ static int step_single(struct sim_device *dev, uint16_t ins, uint16_t ext)
 	uint16_t zc_sr_mask = ~0;
 	int store_results = 1;
 
-	int opwidth = determine_op_width(ins,ext);
+	int opwidth = cycles_op_width(ins, ext);
 	if (opwidth == WIDTH_UNDEFINED)
 		return invalid_opcode(dev);
 
@@ -594,87 +523,7 @@ static int step_single(struct sim_device *dev, uint16_t ins, uint16_t ext)
 			zc_sr_mask = ~MSP430_SR_C;
 	}
 
-	if (!dev->cpux) { /* original CPU timing */
-
-		switch (opcode) {
-		case MSP430_OP_PUSH:
-			if (amode == MSP430_AMODE_REGISTER)
-				cycles = 3;
-			else if (amode == MSP430_AMODE_INDIRECT ||
-				 (amode == MSP430_AMODE_INDIRECT_INC &&
-				  reg == MSP430_REG_PC))
-				cycles = 4;
-			else
-				cycles = 5;
-			break;
-		case MSP430_OP_CALL:
-			if (amode == MSP430_AMODE_REGISTER ||
-				amode == MSP430_AMODE_INDIRECT)
-				cycles = 4;
-			else
-				cycles = 5;
-			break;
-		case MSP430_OP_RETI:
-			cycles = 5;
-			break;
-		default:
-			if (amode == MSP430_AMODE_INDEXED)
-				cycles = 4;
-			else if (amode == MSP430_AMODE_REGISTER)
-				cycles = 1;
-			else
-				cycles = 3;
-			break;
-		}
-
-	} else { /* CPUX timing */
-		cycles = 1;					/* read opcode */
-		if (ext) cycles += 1;		/* read ext wd */
-
-		if (amode == MSP430_AMODE_INDEXED)
-			cycles += 1;			/* read offset */
-
-		switch (opcode) {			/* special-case opcodes */
-
-		case MSP430_OP_CALL:
-			if (amode == MSP430_AMODE_INDEXED && reg == MSP430_REG_SR)
-				cycles += 1;		/* extra cycle for call &xxx */
-			/* fall through */
-
-		case MSP430_OP_PUSH:
-			if (amode == MSP430_AMODE_REGISTER)
-				cycles += 1;		/* sp decr pipeline hit */
-			else {
-				cycles += 1;		/* read data */
-				if (opwidth > 16 &&
-						!(amode == MSP430_AMODE_INDIRECT_INC &&
-						reg == MSP430_REG_PC))
-					cycles += 1;	/* read high wd, except if immediate */
-			}
-			cycles += 1;		/* write to stack */
-			if (opwidth > 16 || opcode == MSP430_OP_CALL)
-				cycles += 1;	/* write high bits to dest or stack */
-
-			/* to match observed MSP430FR5739 behavior requires the following
-					additional fudge */
-			if (opwidth == 20 && amode == MSP430_AMODE_INDEXED)
-				cycles += 1;	/* reason unknown */
-
-			if (opwidth > 16)
-				cycles += rept - 1;
-
-			break;
-
-		default:
-			if (amode != MSP430_AMODE_REGISTER) {
-				cycles += 2;			/* read/write data */
-				if (opwidth > 16)
-					cycles += 2;		/* extra read/write cycles */
-			}
-			break;
-		}
-		cycles += rept - 1;
-	}
+	cycles = cycles_single(ins, ext, opwidth, rept, dev->cpux);
 
 	if (fetch_operand(dev, amode, reg, opwidth, &src_addr, &src_data,
 			ext, ext_dst_bits) < 0)
@@ -1152,6 +1001,50 @@ static int step_reti_calla(struct sim_device *dev, uint16_t ins)
 	return cycles;
 }
 
+/* Classify an instruction for energy accounting, by whether it touches
+ * memory. Immediate operands and the constant generators don't count.
+ */
+static simio_insn_t classify(struct sim_device *dev, uint16_t ins)
+{
+	int as;
+	int src;
+
+	if ((ins & 0xe000) == 0x2000)
+		return SIMIO_INSN_JUMP;
+
+	if ((ins & 0xf000) >= 0x4000) {
+		if (ins & 0x0080)
+			return SIMIO_INSN_MEM;
+
+		as = (ins >> 4) & 3;
+		src = (ins >> 8) & 0xf;
+	} else if ((ins & 0xfc00) == 0x1000) {
+		/* PUSH, CALL and RETI use the stack */
+		if ((ins & 0x0380) >= 0x0200)
+			return SIMIO_INSN_MEM;
+
+		as = (ins >> 4) & 3;
+		src = ins & 0xf;
+	} else if (dev->cpux && (ins & 0xf0e0) == 0x0040) {
+		/* RRCM, RRAM, RLAM, RRUM */
+		return SIMIO_INSN_REG;
+	} else if (dev->cpux && (ins & 0xf000) == 0x0000) {
+		/* MOVA with an indirect, indexed or absolute operand */
+		return ((ins >> 4) & 0xf) < 8 ? SIMIO_INSN_MEM :
+			SIMIO_INSN_REG;
+	} else {
+		/* PUSHM, POPM, CALLA and RETI */
+		return SIMIO_INSN_MEM;
+	}
+
+	if (!as || src == MSP430_REG_R3 ||
+	    (src == MSP430_REG_SR && as >= 2) ||
+	    (src == MSP430_REG_PC && as == 3))
+		return SIMIO_INSN_REG;
+
+	return SIMIO_INSN_MEM;
+}
+
 /* Fetch and execute one instruction. Return the number of CPU cycles
  * it would have taken, or -1 if an error occurs.
  */
@@ -1216,6 +1109,8 @@ static int step_cpu(struct sim_device *dev)
 	/* If things went wrong, restart at the current instruction */
 	if (ret < 0)
 		dev->regs[MSP430_REG_PC] = dev->current_insn;
+	else
+		dev->insn_class = classify(dev, ins);
 
 	return ret;
 }
@@ -1260,11 +1155,17 @@ static int step_system(struct sim_device *dev)
 		dev->regs[MSP430_REG_PC] = mem_getw(dev, 0xffe0 + irq * 2);
 
 		simio_ack_interrupt(irq);
+		simio_insn(dev->regs[MSP430_REG_PC], SIMIO_INSN_IRQ, status, 6);
 		count = 6;
 	} else if (!(status & MSP430_SR_CPUOFF)) {
 		count = step_cpu(dev);
 		if (count < 0)
 			return -1;
+
+		simio_insn(dev->current_insn, dev->insn_class, status, count);
+	} else {
+		simio_insn(dev->regs[MSP430_REG_PC], SIMIO_INSN_IDLE,
+			   status, count);
 	}
 
 	simio_step(status, count);
@@ -1376,6 +1277,14 @@ static int sim_setregs(device_t dev_base, const address_t *regs)
 	return 0;
 }
 
+static void halt(struct sim_device *dev)
+{
+	if (dev->running && dev->base.power_buf)
+		powerbuf_end_session(dev->base.power_buf);
+
+	dev->running = 0;
+}
+
 static int sim_ctl(device_t dev_base, device_ctl_t op)
 {
 	struct sim_device *dev = (struct sim_device *)dev_base;
@@ -1386,7 +1295,7 @@ static int sim_ctl(device_t dev_base, device_ctl_t op)
 		return 0;
 
 	case DEVICE_CTL_HALT:
-		dev->running = 0;
+		halt(dev);
 		return 0;
 
 	case DEVICE_CTL_STEP:
@@ -1394,6 +1303,13 @@ static int sim_ctl(device_t dev_base, device_ctl_t op)
 
 	case DEVICE_CTL_RUN:
 		dev->running = 1;
+
+		/* Each run is a power profiling session, if there's an
+		 * energy model (see simio_power.c).
+		 */
+		if (dev->base.power_buf)
+			powerbuf_begin_session(dev->base.power_buf,
+					       time(NULL));
 		return 0;
 
 	default:
@@ -1447,18 +1363,18 @@ static device_status_t sim_poll(device_t dev_base)
 			if ((bp->flags & DEVICE_BP_ENABLED) &&
 			    (bp->type == DEVICE_BPTYPE_BREAK) &&
 			    dev->regs[MSP430_REG_PC] == bp->addr) {
-				dev->running = 0;
+				halt(dev);
 				return DEVICE_STATUS_HALTED;
 			}
 		}
 
 		if (step_system(dev) < 0) {
-			dev->running = 0;
+			halt(dev);
 			return DEVICE_STATUS_ERROR;
 		}
 
 		if (dev->watchpoint_hit) {
-			dev->running = 0;
+			halt(dev);
 			return DEVICE_STATUS_HALTED;
 		}
 
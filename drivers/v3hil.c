@@ -22,6 +22,7 @@
 #include "dis.h"
 #include "output.h"
 #include "opdb.h"
+#include "devcache.h"
 
 /* HAL function IDs */
 typedef enum {
@@ -141,12 +142,17 @@ void v3hil_init(struct v3hil *h, transport_t trans,
 {
 	memset(h, 0, sizeof(*h));
 	hal_proto_init(&h->hal, trans, flags);
+
+	if (!trans->ops->get_serial ||
+	    trans->ops->get_serial(trans, h->serial, sizeof(h->serial)) < 0)
+		h->serial[0] = 0;
 }
 
 int v3hil_set_vcc(struct v3hil *h, int vcc_mv)
 {
 	uint8_t data[2];
 
+	h->vcc_mv = vcc_mv;
 	w16le(data, vcc_mv);
 	return hal_proto_execute(&h->hal, HAL_PROTO_FID_SET_VCC, data, 2);
 }
@@ -172,6 +178,8 @@ int v3hil_comm_init(struct v3hil *h)
 		printc_dbg("Version: %d.%d.%d.%d, HW: 0x%04x\n",
 			   major, minor, patch, flavour,
 			   r32le(h->hal.payload + 4));
+
+		memcpy(h->version, h->hal.payload, sizeof(h->version));
 	}
 
 	printc_dbg("Reset firmware...\n");
@@ -318,37 +326,139 @@ fail:
 	return NULL;
 }
 
+/************************************************************************
+ * Cached device information
+ */
+
+#define CACHE_KEY_MAX		128
+
+/* Entries are keyed by the adapter's serial number, so nothing is
+ * cached for adapters without one (such as those opened as a tty).
+ */
+static int cache_enabled(const struct v3hil *h)
+{
+	return h->serial[0] && *opdb_get_string("devcache_dir");
+}
+
+/* Build a key identifying the adapter, supply voltage and target,
+ * followed by a fingerprint of the data being cached. Returns the key
+ * length.
+ */
+static int make_key(const struct v3hil *h, const uint8_t *fp, int fp_len,
+		    uint8_t *key)
+{
+	int len = 0;
+
+	memcpy(key + len, h->serial, sizeof(h->serial));
+	len += sizeof(h->serial);
+	memcpy(key + len, h->version, sizeof(h->version));
+	len += sizeof(h->version);
+	w16le(key + len, h->vcc_mv);
+	len += 2;
+	memcpy(key + len, h->jtag_reply, sizeof(h->jtag_reply));
+	len += sizeof(h->jtag_reply);
+
+	if (fp_len > CACHE_KEY_MAX - len)
+		fp_len = CACHE_KEY_MAX - len;
+	memcpy(key + len, fp, fp_len);
+
+	return len + fp_len;
+}
+
+/* 2xx chips carry factory DCO calibration data in information segment
+ * A, protected by a checksum. Its contents differ from die to die, so
+ * it serves as a fingerprint for the DCO calibration. Other chips have
+ * nothing comparable, and are calibrated every session. Returns the key
+ * length, or 0 if no key can be made.
+ */
+#define INFOA_ADDR		0x10c0
+#define INFOA_SIZE		64
+#define INFOA_TAG_DCO_30	0x36
+
+static int dco_key(struct v3hil *h, uint8_t *key)
+{
+	uint8_t seg[INFOA_SIZE];
+	uint16_t sum = 0;
+	int i;
+
+	if (h->chip->clock_sys != CHIPINFO_CLOCK_SYS_BC_2XX ||
+	    !cache_enabled(h))
+		return 0;
+
+	if (v3hil_read(h, INFOA_ADDR, seg, sizeof(seg)) != sizeof(seg))
+		return 0;
+
+	for (i = 2; i < sizeof(seg); i += 2)
+		sum ^= r16le(seg + i);
+
+	if (((sum + r16le(seg)) & 0xffff) || seg[INFOA_TAG_DCO_30] != 0x01)
+		return 0;
+
+	return make_key(h, seg, sizeof(seg), key);
+}
+
+/************************************************************************
+ * Clock calibration
+ */
+
+/* DCO calibration results, as cached */
+struct dco_cal {
+	uint16_t		cal0;
+	uint16_t		cal1;
+	uint8_t			regs[4];
+};
+
 static int calibrate_dco(struct v3hil *h, uint8_t max_bcs)
 {
 	const struct chipinfo_memory *ram = find_ram(h->chip);
+	uint8_t key[CACHE_KEY_MAX];
+	int key_len;
+	struct dco_cal dc;
 	uint8_t data[6];
 	uint8_t mem_write[16];
 
 	if (!ram)
 		goto fail;
 
-	printc_dbg("Calibrate DCO...\n");
+	memset(&dc, 0, sizeof(dc));
+	key_len = dco_key(h, key);
 
-	w16le(data, ram->offset);
-	w16le(data + 2, max_bcs);
+	if (key_len &&
+	    !devcache_load("dco", key, key_len, &dc, sizeof(dc))) {
+		printc_dbg("Using cached DCO calibration\n");
+	} else {
+		printc_dbg("Calibrate DCO...\n");
 
-	if (hal_proto_execute(&h->hal,
-		map_fid(h, HAL_PROTO_FID_GET_DCO_FREQUENCY),
-		data, 6) < 0)
-		goto fail;
-	if (h->hal.length < 6) {
-		printc_err("v3hil: short reply: %d\n", h->hal.length);
-		goto fail;
+		memset(data, 0, sizeof(data));
+		w16le(data, ram->offset);
+		w16le(data + 2, max_bcs);
+
+		if (hal_proto_execute(&h->hal,
+			map_fid(h, HAL_PROTO_FID_GET_DCO_FREQUENCY),
+			data, 6) < 0)
+			goto fail;
+		if (h->hal.length < 6) {
+			printc_err("v3hil: short reply: %d\n",
+				   h->hal.length);
+			goto fail;
+		}
+
+		dc.cal0 = r16le(h->hal.payload);
+		dc.cal1 = r16le(h->hal.payload + 2);
+		dc.regs[0] = h->hal.payload[0]; /* DCO */
+		dc.regs[1] = h->hal.payload[2]; /* BCS1 */
+		dc.regs[2] = h->hal.payload[4]; /* BCS2 */
+
+		if (key_len)
+			devcache_store("dco", key, key_len, &dc, sizeof(dc));
 	}
 
-	h->cal.cal0 = r16le(data);
-	h->cal.cal1 = r16le(data + 2);
+	h->cal.cal0 = dc.cal0;
+	h->cal.cal1 = dc.cal1;
 
 	w32le(mem_write, 0x56); /* addr of DCO */
 	w32le(mem_write + 4, 3);
-	mem_write[8] = data[0]; /* DCO */
-	mem_write[9] = data[2]; /* BCS1 */
-	mem_write[10] = data[4]; /* BCS2 */
+	memcpy(mem_write + 8, dc.regs, 3);
 	mem_write[11] = 0; /* pad */
 	if (hal_proto_execute(&h->hal,
 		    map_fid(h, HAL_PROTO_FID_WRITE_MEM_BYTES),
@@ -375,8 +485,8 @@ static int calibrate_fll(struct v3hil *h)
 
 	printc_dbg("Calibrate FLL...\n");
 
+	memset(data, 0, sizeof(data));
 	w16le(data, ram->offset);
-	w16le(data + 2, 0);
 
 	if (hal_proto_execute(&h->hal,
 		map_fid(h, HAL_PROTO_FID_GET_DCO_FREQUENCY),
@@ -388,15 +498,15 @@ static int calibrate_fll(struct v3hil *h)
 	}
 
 	h->cal.cal0 = 0;
-	h->cal.cal1 = r16le(data + 2);
+	h->cal.cal1 = r16le(h->hal.payload + 2);
 
 	w32le(mem_write, 0x50); /* addr of SCFI0 */
 	w32le(mem_write + 4, 5);
-	mem_write[8] = data[0]; /* SCFI0 */
-	mem_write[9] = data[2]; /* SCFI1 */
-	mem_write[10] = data[4]; /* SCFQCTL */
-	mem_write[11] = data[6]; /* FLLCTL0 */
-	mem_write[12] = data[8]; /* FLLCTL1 */
+	mem_write[8] = h->hal.payload[0]; /* SCFI0 */
+	mem_write[9] = h->hal.payload[2]; /* SCFI1 */
+	mem_write[10] = h->hal.payload[4]; /* SCFQCTL */
+	mem_write[11] = h->hal.payload[6]; /* FLLCTL0 */
+	mem_write[12] = h->hal.payload[8]; /* FLLCTL1 */
 	mem_write[13] = 0; /* pad */
 
 	if (hal_proto_execute(&h->hal,
@@ -844,6 +954,41 @@ static int set_param(struct v3hil *fet, hal_proto_config_t cfg,
 	return 0;
 }
 
+/* CPUxV2 identification results are cached, keyed by the first device
+ * ID read. This includes the TLV checksum, so the entry is specific to
+ * the die, and the TLV read can be skipped. Older chips are identified
+ * by their ID bytes and fuses, which are cheap to read but shared by
+ * many parts, so they aren't cached.
+ */
+static int load_id(struct v3hil *fet, const uint8_t *raw, int len,
+		   struct chipinfo_id *id)
+{
+	uint8_t key[CACHE_KEY_MAX];
+	int key_len;
+
+	if (!cache_enabled(fet))
+		return -1;
+
+	key_len = make_key(fet, raw, len, key);
+	if (devcache_load("id", key, key_len, id, sizeof(*id)))
+		return -1;
+
+	printc_dbg("Using cached identification\n");
+	return 0;
+}
+
+static void store_id(struct v3hil *fet, const uint8_t *raw, int len,
+		     const struct chipinfo_id *id)
+{
+	uint8_t key[CACHE_KEY_MAX];
+
+	if (!cache_enabled(fet))
+		return;
+
+	devcache_store("id", key, make_key(fet, raw, len, key),
+		       id, sizeof(*id));
+}
+
 static int idproc_89(struct v3hil *fet, uint32_t id_data_addr,
 		     struct chipinfo_id *id)
 {
@@ -885,6 +1030,7 @@ static int idproc_9x(struct v3hil *fet, uint32_t dev_id_ptr,
 		     struct chipinfo_id *id)
 {
 	uint8_t data[32];
+	uint8_t raw[8];
 	uint8_t info_len;
 	int i;
 	int tlv_size;
@@ -913,6 +1059,10 @@ static int idproc_9x(struct v3hil *fet, uint32_t dev_id_ptr,
 	if ((info_len < 1) || (info_len > 11))
 		return 0;
 
+	memcpy(raw, fet->hal.payload, sizeof(raw));
+	if (!load_id(fet, raw, sizeof(raw), id))
+		return 0;
+
 	printc_dbg("Read TLV...\n");
 	tlv_size = ((1 << info_len) - 2) << 2;
 	w32le(data, dev_id_ptr);
@@ -941,6 +1091,7 @@ static int idproc_9x(struct v3hil *fet, uint32_t dev_id_ptr,
 		i += len;
 	}
 
+	store_id(fet, raw, sizeof(raw), id);
 	return 0;
 }
 
@@ -970,6 +1121,7 @@ int v3hil_identify(struct v3hil *fet)
 	 * means old CPU.
 	 */
 	fet->jtag_id = fet->hal.payload[0];
+	memcpy(fet->jtag_reply, fet->hal.payload, sizeof(fet->jtag_reply));
 	dev_id_ptr = r32le(fet->hal.payload + 4);
 	id_data_addr = r32le(fet->hal.payload + 8);
 
@@ -1045,17 +1197,17 @@ int v3hil_configure(struct v3hil *fet)
 		      (fet->chip->features &
 		       CHIPINFO_FEATURE_PSACH) ? 1 : 0) < 0 ||
 	    set_param(fet, HAL_PROTO_CONFIG_POWER_TESTREG_MASK,
-		      fet->chip->power.reg_mask) < 0 ||
+		      fet->chip->power->reg_mask) < 0 ||
 	    set_param(fet, HAL_PROTO_CONFIG_TESTREG_ENABLE_LPMX5,
-		      fet->chip->power.enable_lpm5) < 0 ||
+		      fet->chip->power->enable_lpm5) < 0 ||
 	    set_param(fet, HAL_PROTO_CONFIG_TESTREG_DISABLE_LPMX5,
-		      fet->chip->power.disable_lpm5) < 0 ||
+		      fet->chip->power->disable_lpm5) < 0 ||
 	    set_param(fet, HAL_PROTO_CONFIG_POWER_TESTREG3V_MASK,
-		      fet->chip->power.reg_mask_3v) < 0 ||
+		      fet->chip->power->reg_mask_3v) < 0 ||
 	    set_param(fet, HAL_PROTO_CONFIG_TESTREG3V_ENABLE_LPMX5,
-		      fet->chip->power.enable_lpm5_3v) < 0 ||
+		      fet->chip->power->enable_lpm5_3v) < 0 ||
 	    set_param(fet, HAL_PROTO_CONFIG_TESTREG3V_DISABLE_LPMX5,
-		      fet->chip->power.disable_lpm5_3v) < 0 ||
+		      fet->chip->power->disable_lpm5_3v) < 0 ||
 	    set_param(fet, HAL_PROTO_CONFIG_NO_BSL,
 		      (fet->chip->features &
 		       CHIPINFO_FEATURE_NO_BSL) ? 1 : 0) < 0 ||
@@ -50,6 +50,15 @@ struct v3hil {
 	address_t		regs[DEVICE_NUM_REGS];
 
 	struct v3hil_calibrate	cal;
+
+	/* Adapter and target identity, used to key cached device
+	 * information (see devcache.h). The serial number is read from
+	 * the transport, and is empty if it isn't known.
+	 */
+	char			serial[32];
+	uint8_t			version[8];
+	uint16_t		vcc_mv;
+	uint8_t			jtag_reply[12];
 };
 
 /* Initialize data, associate transport */
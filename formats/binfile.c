@@ -110,6 +110,7 @@ int binfile_extract(FILE *in, binfile_imgcb_t cb, void *user_data)
 int binfile_syms(FILE *in)
 {
 	const struct file_format *fmt = identify(in);
+	int ret;
 
 	if (!fmt) {
 		printc_err("binfile: unknown file format\n");
@@ -121,5 +122,11 @@ int binfile_syms(FILE *in)
 		return -1;
 	}
 
-	return fmt->syms(in);
+	/* Loading into an empty table builds the indices in one pass */
+	stab_bulk_begin();
+	ret = fmt->syms(in);
+	if (stab_bulk_end() < 0)
+		ret = -1;
+
+	return ret;
 }
@@ -21,6 +21,7 @@
 
 #include "elf32.h"
 #include "elf_format.h"
+#include "fmap.h"
 #include "output.h"
 #include "util.h"
 
@@ -35,22 +36,28 @@ static const uint8_t elf32_id[] = {
 #define MAX_PHDRS	128
 #define MAX_SHDRS	512
 
+#define EHDR_SIZE	52
+#define PHDR_SIZE	32
+#define SHDR_SIZE	40
+#define SYM_SIZE	16
+
+/* The file is mapped in its entirety, and all offsets are checked
+ * against the mapping once, in read_all(). After that, section contents
+ * and string tables are used directly from the mapping.
+ */
 struct elf32_info {
+	struct fmap		map;
+
 	Elf32_Ehdr              file_ehdr;
 	Elf32_Phdr              file_phdrs[MAX_PHDRS];
 	Elf32_Shdr              file_shdrs[MAX_SHDRS];
 
-	char                    *string_tab;
+	const char              *string_tab;
 	int                     string_len;
 };
 
-static int parse_ehdr(Elf32_Ehdr *e, FILE *in)
+static void parse_ehdr(Elf32_Ehdr *e, const uint8_t *data)
 {
-	uint8_t data[52];
-
-	if (fread(data, sizeof(data), 1, in) != 1)
-		return -1;
-
 	memcpy(e->e_ident, data, EI_NIDENT);
 	e->e_type = LE_WORD(data, 16);
 	e->e_machine = LE_WORD(data, 18);
@@ -65,17 +72,10 @@ static int parse_ehdr(Elf32_Ehdr *e, FILE *in)
 	e->e_shentsize = LE_WORD(data, 46);
 	e->e_shnum = LE_WORD(data, 48);
 	e->e_shstrndx = LE_WORD(data, 50);
-
-	return 0;
 }
 
-static int parse_phdr(Elf32_Phdr *p, FILE *in)
+static void parse_phdr(Elf32_Phdr *p, const uint8_t *data)
 {
-	uint8_t data[32];
-
-	if (fread(data, sizeof(data), 1, in) != 1)
-		return -1;
-
 	p->p_type = LE_LONG(data, 0);
 	p->p_offset = LE_LONG(data, 4);
 	p->p_vaddr = LE_LONG(data, 8);
@@ -84,17 +84,10 @@ static int parse_phdr(Elf32_Phdr *p, FILE *in)
 	p->p_memsz = LE_LONG(data, 20);
 	p->p_flags = LE_LONG(data, 24);
 	p->p_align = LE_LONG(data, 28);
-
-	return 0;
 }
 
-static int parse_shdr(Elf32_Shdr *s, FILE *in)
+static void parse_shdr(Elf32_Shdr *s, const uint8_t *data)
 {
-	uint8_t data[40];
-
-	if (fread(data, sizeof(data), 1, in) != 1)
-		return -1;
-
 	s->sh_name = LE_LONG(data, 0);
 	s->sh_type = LE_LONG(data, 4);
 	s->sh_flags = LE_LONG(data, 8);
@@ -105,36 +98,35 @@ static int parse_shdr(Elf32_Shdr *s, FILE *in)
 	s->sh_info = LE_LONG(data, 28);
 	s->sh_addralign = LE_LONG(data, 32);
 	s->sh_entsize = LE_LONG(data, 36);
-
-	return 0;
 }
 
-static int parse_sym(Elf32_Sym *s, FILE *in)
+static void parse_sym(Elf32_Sym *s, const uint8_t *data)
 {
-	uint8_t data[16];
-
-	if (fread(data, sizeof(data), 1, in) != 1)
-		return -1;
-
 	s->st_name = LE_LONG(data, 0);
 	s->st_value = LE_LONG(data, 4);
 	s->st_size = LE_LONG(data, 8);
 	s->st_info = data[12];
 	s->st_other = data[13];
 	s->st_shndx = LE_WORD(data, 14);
+}
 
-	return 0;
+/* Is the given range of the file within the mapping? */
+static int in_file(const struct elf32_info *info,
+		   uint64_t offset, uint64_t len)
+{
+	return offset <= info->map.len && len <= info->map.len - offset;
 }
 
-static int read_ehdr(struct elf32_info *info, FILE *in)
+static int read_ehdr(struct elf32_info *info)
 {
 	/* Read and check the ELF header */
-	rewind(in);
-	if (parse_ehdr(&info->file_ehdr, in) < 0) {
-		pr_error("elf32: couldn't read ELF header");
+	if (!in_file(info, 0, EHDR_SIZE)) {
+		printc_err("elf32: couldn't read ELF header\n");
 		return -1;
 	}
 
+	parse_ehdr(&info->file_ehdr, info->map.data);
+
 	if (memcmp(info->file_ehdr.e_ident, elf32_id, sizeof(elf32_id))) {
 		printc_err("elf32: not an ELF32 file\n");
 		return -1;
@@ -143,55 +135,58 @@ static int read_ehdr(struct elf32_info *info, FILE *in)
 	return 0;
 }
 
-static int read_phdr(struct elf32_info *info, FILE *in)
+static int read_phdr(struct elf32_info *info)
 {
+	const Elf32_Ehdr *e = &info->file_ehdr;
 	int i;
 
-	if (info->file_ehdr.e_phnum > MAX_PHDRS) {
+	if (e->e_phnum > MAX_PHDRS) {
 		printc_err("elf32: too many program headers: %d\n",
-			info->file_ehdr.e_phnum);
+			e->e_phnum);
 		return -1;
 	}
 
-	for (i = 0; i < info->file_ehdr.e_phnum; i++) {
-		if (fseek(in, i * info->file_ehdr.e_phentsize +
-			  info->file_ehdr.e_phoff,
-			  SEEK_SET) < 0) {
-			printc_err("elf32: can't seek to phdr %d\n", i);
-			return -1;
-		}
+	for (i = 0; i < e->e_phnum; i++) {
+		const uint64_t offset =
+			(uint64_t)i * e->e_phentsize + e->e_phoff;
 
-		if (parse_phdr(&info->file_phdrs[i], in) < 0) {
-			printc_err("elf32: can't read phdr %d: %s\n",
-				i, last_error());
+		if (!in_file(info, offset, PHDR_SIZE)) {
+			printc_err("elf32: can't read phdr %d\n", i);
 			return -1;
 		}
+
+		parse_phdr(&info->file_phdrs[i], info->map.data + offset);
 	}
 
 	return 0;
 }
 
-static int read_shdr(struct elf32_info *info, FILE *in)
+static int read_shdr(struct elf32_info *info)
 {
+	const Elf32_Ehdr *e = &info->file_ehdr;
 	int i;
 
-	if (info->file_ehdr.e_shnum > MAX_SHDRS) {
+	if (e->e_shnum > MAX_SHDRS) {
 		printc_err("elf32: too many section headers: %d\n",
-			info->file_ehdr.e_shnum);
+			e->e_shnum);
 		return -1;
 	}
 
-	for (i = 0; i < info->file_ehdr.e_shnum; i++) {
-		if (fseek(in, i * info->file_ehdr.e_shentsize +
-			  info->file_ehdr.e_shoff,
-			  SEEK_SET) < 0) {
-			printc_err("elf32: can't seek to shdr %d\n", i);
+	for (i = 0; i < e->e_shnum; i++) {
+		const uint64_t offset =
+			(uint64_t)i * e->e_shentsize + e->e_shoff;
+		Elf32_Shdr *s = &info->file_shdrs[i];
+
+		if (!in_file(info, offset, SHDR_SIZE)) {
+			printc_err("elf32: can't read shdr %d\n", i);
 			return -1;
 		}
 
-		if (parse_shdr(&info->file_shdrs[i], in) < 0) {
-			printc_err("elf32: can't read shdr %d: %s\n",
-				i, last_error());
+		parse_shdr(s, info->map.data + offset);
+
+		if (s->sh_type != SHT_NOBITS &&
+		    !in_file(info, s->sh_offset, s->sh_size)) {
+			printc_err("elf32: section %d out of bounds\n", i);
 			return -1;
 		}
 	}
@@ -213,101 +208,71 @@ static uint32_t file_to_phys(struct elf32_info *info, uint32_t v)
 	return v;
 }
 
-static int feed_section(struct elf32_info *info,
-			FILE *in, const Elf32_Shdr *sh,
-			binfile_imgcb_t cb, void *user_data)
+/* Fetch a nul-terminated string from the loaded string table, or NULL
+ * if the offset is invalid.
+ */
+static const char *get_string(const struct elf32_info *info, uint32_t offset)
 {
-	uint32_t offset = sh->sh_offset;
-	uint32_t size = sh->sh_size;
-	uint8_t buf[1024];
-	uint32_t addr = file_to_phys(info, offset);
-	const char *name = NULL;
-
-	if (fseek(in, offset, SEEK_SET) < 0) {
-		pr_error("elf32: can't seek to section");
-		return -1;
-	}
-
-	if (info->string_tab &&
-	    sh->sh_name < info->string_len)
-		name = info->string_tab + sh->sh_name;
+	const char *text = info->string_tab + offset;
 
-	while (size) {
-		int ask = size > sizeof(buf) ? sizeof(buf) : size;
-		int len = fread(buf, 1, ask, in);
-		struct binfile_chunk ch = {0};
+	if (!info->string_tab || offset >= info->string_len ||
+	    !memchr(text, 0, info->string_len - offset))
+		return NULL;
 
-		if (len < 0) {
-			pr_error("elf32: can't read section");
-			return -1;
-		}
+	return text;
+}
 
-		ch.name = name;
-		ch.addr = addr;
-		ch.data = buf;
-		ch.len = len;
+static int feed_section(struct elf32_info *info, const Elf32_Shdr *sh,
+			binfile_imgcb_t cb, void *user_data)
+{
+	struct binfile_chunk ch = {0};
 
-		if (cb(user_data, &ch) < 0)
-			return -1;
+	if (!sh->sh_size)
+		return 0;
 
-		size -= len;
-		offset += len;
-		addr += len;
-	}
+	ch.name = get_string(info, sh->sh_name);
+	ch.addr = file_to_phys(info, sh->sh_offset);
+	ch.data = info->map.data + sh->sh_offset;
+	ch.len = sh->sh_size;
 
-	return 0;
+	return cb(user_data, &ch);
 }
 
 static int read_all(struct elf32_info *info, FILE *in)
 {
 	memset(info, 0, sizeof(*info));
 
-	if (read_ehdr(info, in) < 0)
+	if (fmap_map(&info->map, in, 0) < 0)
 		return -1;
 
+	if (read_ehdr(info) < 0)
+		goto fail;
+
 	if (info->file_ehdr.e_machine != EM_MSP430)
 		printc_err("elf32: warning: unknown machine type: 0x%x\n",
 			info->file_ehdr.e_machine);
 
-	if (read_phdr(info, in) < 0)
-		return -1;
-	if (read_shdr(info, in) < 0)
-		return -1;
+	if (read_phdr(info) < 0)
+		goto fail;
+	if (read_shdr(info) < 0)
+		goto fail;
 
 	return 0;
+
+fail:
+	fmap_unmap(&info->map);
+	return -1;
 }
 
-static int load_strings(struct elf32_info *info, FILE *in, Elf32_Shdr *s)
+static int load_strings(struct elf32_info *info, const Elf32_Shdr *s)
 {
-	int len = s->sh_size;
-
-	if (!len)
-		return 0;
-
-	if (fseek(in, s->sh_offset, SEEK_SET) < 0) {
-		pr_error("elf32: can't seek to strings");
-		return -1;
-	}
-
-	info->string_len = len;
-	info->string_tab = malloc(len + 1);
-
-	if (!info->string_tab) {
-		pr_error("elf32: can't allocate string table memory");
+	if (s->sh_type == SHT_NOBITS) {
+		printc_err("elf32: string table has no data\n");
 		return -1;
 	}
 
-	if (!fread(info->string_tab, info->string_len, 1, in)) {
-		if (ferror(in)) {
-			pr_error("elf32: error reading strings");
-			return -1;
-		}
-
-		printc_err("elf32: eof reading strings\n");
-		return -1;
-	}
-
-	info->string_tab[info->string_len] = 0;
+	info->string_tab = (const char *)info->map.data + s->sh_offset;
+	info->string_len = s->sh_size;
 	return 0;
 }
 
@@ -320,7 +285,8 @@ int elf32_extract(FILE *in, binfile_imgcb_t cb, void *user_data)
 	if (read_all(&info, in) < 0)
 		return -1;
 
-	if (load_strings(&info, in,
+	if (info.file_ehdr.e_shstrndx >= info.file_ehdr.e_shnum ||
+	    load_strings(&info,
 			 &info.file_shdrs[info.file_ehdr.e_shstrndx]) < 0) {
 		printc_err("elf32: warning: can't load section string "
 			   "table\n");
@@ -332,15 +298,13 @@ int elf32_extract(FILE *in, binfile_imgcb_t cb, void *user_data)
 
 		if ((s->sh_type == SHT_PROGBITS || s->sh_type == SHT_INIT_ARRAY) &&
 		    s->sh_flags & SHF_ALLOC &&
-		    feed_section(&info, in, s, cb, user_data) < 0) {
+		    feed_section(&info, s, cb, user_data) < 0) {
 			ret = -1;
 			break;
 		}
 	}
 
-	if (info.string_tab)
-		free(info.string_tab);
-
+	fmap_unmap(&info.map);
 	return ret;
 }
 
@@ -370,47 +334,36 @@ static Elf32_Shdr *find_shdr(struct elf32_info *info, Elf32_Word type)
 	return NULL;
 }
 
-#define N_SYMS	128
-
 #ifndef STT_COMMON
 #define STT_COMMON 5
 #endif
 
-static int syms_load_syms(struct elf32_info *info, FILE *in,
-			  Elf32_Shdr *s)
+static int syms_load_syms(struct elf32_info *info, const Elf32_Shdr *s)
 {
-	int len = s->sh_size / 16;
+	const uint8_t *data = info->map.data + s->sh_offset;
+	int len = s->sh_size / SYM_SIZE;
 	int i;
 
-	if (fseek(in, s->sh_offset, SEEK_SET) < 0) {
-		pr_error("elf32: can't seek to symbols");
-		return -1;
-	}
-
 	for (i = 0; i < len; i++) {
 		Elf32_Sym y;
 		int st;
 		const char *name;
 
-		if (parse_sym(&y, in) < 0) {
-			pr_error("elf32: error reading symbols");
-			return -1;
-		}
+		parse_sym(&y, data + i * SYM_SIZE);
 
 		st = ELF32_ST_TYPE(y.st_info);
-		name = info->string_tab + y.st_name;
+		if (!(st == STT_OBJECT || st == STT_FUNC ||
+		      st == STT_SECTION || st == STT_COMMON ||
+		      st == STT_TLS))
+			continue;
 
-		if (y.st_name > info->string_len) {
+		name = get_string(info, y.st_name);
+		if (!name) {
 			printc_err("elf32: symbol out of bounds\n");
 			return -1;
 		}
 
-		if (name[0] &&
-		    (st == STT_OBJECT || st == STT_FUNC ||
-		     st == STT_SECTION || st == STT_COMMON ||
-		     st == STT_TLS) &&
-		    stab_set(info->string_tab + y.st_name,
-			     y.st_value) < 0)
+		if (name[0] && stab_set(name, y.st_value) < 0)
 			return -1;
 	}
 
@@ -429,20 +382,15 @@ int elf32_syms(FILE *in)
 	s = find_shdr(&info, SHT_SYMTAB);
 	if (!s) {
 		printc_err("elf32: no symbol table\n");
-		return -1;
-	}
-
-	if (s->sh_link <= 0 || s->sh_link >= info.file_ehdr.e_shnum) {
+		ret = -1;
+	} else if (s->sh_link <= 0 || s->sh_link >= info.file_ehdr.e_shnum) {
 		printc_err("elf32: no string table\n");
-		return -1;
-	}
-
-	if (load_strings(&info, in, &info.file_shdrs[s->sh_link]) < 0 ||
-	    syms_load_syms(&info, in, s) < 0)
 		ret = -1;
+	} else if (load_strings(&info, &info.file_shdrs[s->sh_link]) < 0 ||
+		   syms_load_syms(&info, s) < 0) {
+		ret = -1;
+	}
 
-	if (info.string_tab)
-		free(info.string_tab);
-
+	fmap_unmap(&info.map);
 	return ret;
 }
@@ -0,0 +1,217 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <string.h>
+#include "hexrec.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define HEXREC_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define HEXREC_NEON
+#endif
+
+/************************************************************************
+ * Hex decoding
+ */
+
+static inline int digit_value(int c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+
+	c |= 0x20;
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+
+	return -1;
+}
+
+/* Each of the vector versions decodes 16 digits at a time. Digits are
+ * classified by subtracting the base of each range and checking the
+ * result against the range length. The nibbles are then combined by
+ * treating each pair as a little-endian 16-bit word.
+ */
+#if defined(HEXREC_SSE2)
+static int decode_16(uint8_t *out, const char *text)
+{
+	const __m128i v = _mm_loadu_si128((const __m128i *)text);
+	const __m128i d = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+	const __m128i a = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)),
+				       _mm_set1_epi8('a'));
+	const __m128i is_d = _mm_cmpeq_epi8(_mm_min_epu8(d,
+					_mm_set1_epi8(9)), d);
+	const __m128i is_a = _mm_cmpeq_epi8(_mm_min_epu8(a,
+					_mm_set1_epi8(5)), a);
+	__m128i nib;
+	__m128i w;
+
+	if (_mm_movemask_epi8(_mm_or_si128(is_d, is_a)) != 0xffff)
+		return -1;
+
+	nib = _mm_or_si128(_mm_and_si128(is_d, d),
+			   _mm_andnot_si128(is_d,
+				_mm_add_epi8(a, _mm_set1_epi8(10))));
+	w = _mm_or_si128(_mm_slli_epi16(nib, 4), _mm_srli_epi16(nib, 8));
+	w = _mm_and_si128(w, _mm_set1_epi16(0xff));
+	_mm_storel_epi64((__m128i *)out,
+			 _mm_packus_epi16(w, _mm_setzero_si128()));
+	return 0;
+}
+#elif defined(HEXREC_NEON)
+static int decode_16(uint8_t *out, const char *text)
+{
+	const uint8x16_t v = vld1q_u8((const uint8_t *)text);
+	const uint8x16_t d = vsubq_u8(v, vdupq_n_u8('0'));
+	const uint8x16_t a = vsubq_u8(vorrq_u8(v, vdupq_n_u8(0x20)),
+				      vdupq_n_u8('a'));
+	const uint8x16_t is_d = vcltq_u8(d, vdupq_n_u8(10));
+	const uint8x16_t is_a = vcltq_u8(a, vdupq_n_u8(6));
+	uint8x16_t nib;
+	uint16x8_t w;
+
+	if (vminvq_u8(vorrq_u8(is_d, is_a)) != 0xff)
+		return -1;
+
+	nib = vbslq_u8(is_d, d, vaddq_u8(a, vdupq_n_u8(10)));
+	w = vreinterpretq_u16_u8(nib);
+	w = vorrq_u16(vshlq_n_u16(w, 4), vshrq_n_u16(w, 8));
+	vst1_u8(out, vmovn_u16(w));
+	return 0;
+}
+#endif
+
+int hexrec_decode(uint8_t *out, const char *text, int nbytes)
+{
+	int i = 0;
+
+#if defined(HEXREC_SSE2) || defined(HEXREC_NEON)
+	for (; i + 8 <= nbytes; i += 8)
+		if (decode_16(out + i, text + i * 2) < 0)
+			return -1;
+#endif
+
+	for (; i < nbytes; i++) {
+		const int hi = digit_value(text[i * 2]);
+		const int lo = digit_value(text[i * 2 + 1]);
+
+		if ((hi | lo) < 0)
+			return -1;
+
+		out[i] = (hi << 4) | lo;
+	}
+
+	return 0;
+}
+
+uint8_t hexrec_sum(const uint8_t *data, int len)
+{
+	unsigned int sum = 0;
+	int i = 0;
+
+#if defined(HEXREC_SSE2)
+	__m128i acc = _mm_setzero_si128();
+
+	for (; i + 16 <= len; i += 16)
+		acc = _mm_add_epi64(acc,
+			_mm_sad_epu8(_mm_loadu_si128((const __m128i *)
+						     (data + i)),
+				     _mm_setzero_si128()));
+
+	sum = _mm_cvtsi128_si32(acc) +
+		_mm_cvtsi128_si32(_mm_srli_si128(acc, 8));
+#elif defined(HEXREC_NEON)
+	for (; i + 16 <= len; i += 16)
+		sum += vaddlvq_u8(vld1q_u8(data + i));
+#endif
+
+	for (; i < len; i++)
+		sum += data[i];
+
+	return sum;
+}
+
+const char *hexrec_line(const char *text, const char *end, int *len)
+{
+	const char *eol = memchr(text, '\n', end - text);
+
+	if (!eol) {
+		*len = end - text;
+		return end;
+	}
+
+	*len = eol - text;
+	return eol + 1;
+}
+
+/************************************************************************
+ * Chunk merging
+ */
+
+void hexrec_merge_init(struct hexrec_merge *m,
+		       binfile_imgcb_t cb, void *user_data)
+{
+	m->cb = cb;
+	m->user_data = user_data;
+	m->addr = 0;
+	m->len = 0;
+}
+
+int hexrec_merge_flush(struct hexrec_merge *m)
+{
+	struct binfile_chunk ch = {0};
+
+	if (!m->len)
+		return 0;
+
+	ch.addr = m->addr;
+	ch.data = m->buf;
+	ch.len = m->len;
+	m->len = 0;
+
+	return m->cb(m->user_data, &ch);
+}
+
+int hexrec_merge_feed(struct hexrec_merge *m, address_t addr,
+		      const uint8_t *data, int len)
+{
+	while (len) {
+		int count;
+
+		if (m->len && (m->addr + m->len != addr ||
+			       m->len == sizeof(m->buf)) &&
+		    hexrec_merge_flush(m) < 0)
+			return -1;
+
+		if (!m->len)
+			m->addr = addr;
+
+		count = sizeof(m->buf) - m->len;
+		if (count > len)
+			count = len;
+
+		memcpy(m->buf + m->len, data, count);
+		m->len += count;
+		addr += count;
+		data += count;
+		len -= count;
+	}
+
+	return 0;
+}
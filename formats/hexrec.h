@@ -0,0 +1,71 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef HEXREC_H_
+#define HEXREC_H_
+
+#include "binfile.h"
+
+/* Helpers shared by the text record formats (Intel HEX, S-record and
+ * TI-TXT).
+ */
+
+/* Decode pairs of hex digits. Returns 0 if every character was a valid
+ * hex digit, or -1 otherwise (in which case the contents of the output
+ * buffer are undefined).
+ */
+int hexrec_decode(uint8_t *out, const char *text, int nbytes);
+
+/* Sum a block of bytes, modulo 256. */
+uint8_t hexrec_sum(const uint8_t *data, int len);
+
+/* Find the end of the line starting at text. The length of the line,
+ * not counting the terminator, is returned in *len, and the start of
+ * the following line is returned.
+ */
+const char *hexrec_line(const char *text, const char *end, int *len);
+
+/* Records are small, so rather than passing each one to the image
+ * callback, contiguous records are gathered together and passed on in
+ * larger chunks.
+ */
+#define HEXREC_CHUNK_SIZE	16384
+
+struct hexrec_merge {
+	binfile_imgcb_t		cb;
+	void			*user_data;
+
+	address_t		addr;
+	int			len;
+	uint8_t			buf[HEXREC_CHUNK_SIZE];
+};
+
+void hexrec_merge_init(struct hexrec_merge *m,
+		       binfile_imgcb_t cb, void *user_data);
+
+/* Add data to the pending chunk, passing the chunk on if the new data
+ * isn't contiguous with it, or if it fills up. Returns 0 on success or
+ * -1 if the callback fails.
+ */
+int hexrec_merge_feed(struct hexrec_merge *m, address_t addr,
+		      const uint8_t *data, int len);
+
+/* Pass on any pending data. */
+int hexrec_merge_flush(struct hexrec_merge *m);
+
+#endif
@@ -20,34 +20,36 @@
 #include <string.h>
 #include <ctype.h>
 #include "ihex.h"
+#include "hexrec.h"
+#include "fmap.h"
 #include "output.h"
 
+/* Longest possible record: count, address, type, 255 data bytes and
+ * checksum.
+ */
+#define MAX_RECORD	260
+
 int ihex_check(FILE *in)
 {
 	rewind(in);
 	return fgetc(in) == ':';
 }
 
-static int feed_line(uint8_t *data, int nbytes, binfile_imgcb_t cb,
-		     void *user_data, address_t *segment_offset)
+static int feed_line(uint8_t *data, int nbytes, struct hexrec_merge *m,
+		     address_t *segment_offset)
 {
-	uint8_t cksum = 0;
 	address_t address;
 	uint8_t type;
 	uint8_t *payload;
 	int data_len;
-	int i;
-	struct binfile_chunk ch = {0};
 
 	if (nbytes < 5)
 		return 0;
 
-	/* Verify checksum */
-	for (i = 0; i + 1 < nbytes; i++)
-		cksum += data[i];
-	cksum = ~(cksum - 1) & 0xff;
+	/* Verify checksum: the bytes of a valid record sum to zero */
+	if (hexrec_sum(data, nbytes)) {
+		uint8_t cksum = -hexrec_sum(data, nbytes - 1);
 
-	if (data[nbytes - 1] != cksum) {
 		printc_err("ihex: invalid checksum: %02x "
 			"(calculated %02x)\n", data[nbytes - 1], cksum);
 		return -1;
@@ -61,10 +63,8 @@ static int feed_line(uint8_t *data, int nbytes, binfile_imgcb_t cb,
 
 	switch (type) {
 	case 0:
-		ch.addr = address + *segment_offset;
-		ch.data = payload;
-		ch.len = data_len;
-		return cb(user_data, &ch);
+		return hexrec_merge_feed(m, address + *segment_offset,
+					 payload, data_len);
 
 	case 1:
 	case 3:
@@ -100,46 +100,78 @@ static int feed_line(uint8_t *data, int nbytes, binfile_imgcb_t cb,
 	return 0;
 }
 
+/* Slow path for lines containing characters other than hex digits.
+ * Each pair is decoded leniently, as strtoul() would.
+ */
+static void decode_lenient(uint8_t *data, const char *text, int nbytes)
+{
+	int i;
+
+	for (i = 0; i < nbytes; i++) {
+		char d[] = {text[i * 2], text[i * 2 + 1], 0};
+
+		data[i] = strtoul(d, NULL, 16);
+	}
+}
+
 int ihex_extract(FILE *in, binfile_imgcb_t cb, void *user_data)
 {
-	char buf[128];
+	struct fmap map;
+	struct hexrec_merge merge;
+	const char *text;
+	const char *end;
 	int lno = 0;
 	address_t segment_offset = 0;
 
-	rewind(in);
-	while (fgets(buf, sizeof(buf), in)) {
-		int len = strlen(buf);
-		int i;
-		uint8_t data[64];
+	if (fmap_map(&map, in, 0) < 0)
+		return -1;
+
+	hexrec_merge_init(&merge, cb, user_data);
+	text = (const char *)map.data;
+	end = text + map.len;
+
+	while (text < end) {
+		const char *line = text;
+		int len;
+		uint8_t data[MAX_RECORD];
 		int nbytes;
 
+		text = hexrec_line(text, end, &len);
 		lno++;
-		if (buf[0] != ':') {
+
+		if (!len || line[0] != ':') {
 			printc_err("ihex: line %d: invalid start "
 				"marker\n", lno);
 			continue;
 		}
 
 		/* Trim trailing whitespace */
-		while (len && isspace(buf[len - 1]))
+		while (len && isspace(line[len - 1]))
 			len--;
-		buf[len] = 0;
 
 		/* Decode hex digits */
 		nbytes = (len - 1) / 2;
-		for (i = 0; i < nbytes; i++) {
-			char d[] = {buf[i * 2 + 1], buf[i * 2 + 2], 0};
-
-			data[i] = strtoul(d, NULL, 16);
+		if (nbytes > sizeof(data)) {
+			printc_err("ihex: line %d: record too long\n", lno);
+			goto fail;
 		}
 
+		if (hexrec_decode(data, line + 1, nbytes) < 0)
+			decode_lenient(data, line + 1, nbytes);
+
 		/* Handle the line */
-		if (feed_line(data, nbytes, cb, user_data,
-			      &segment_offset) < 0) {
-			printc_err("ihex: error on line %d\n", lno);
-			return -1;
-		}
+		if (feed_line(data, nbytes, &merge, &segment_offset) < 0)
+			goto fail;
 	}
 
+	if (hexrec_merge_flush(&merge) < 0)
+		goto fail;
+
+	fmap_unmap(&map);
 	return 0;
+
+fail:
+	printc_err("ihex: error on line %d\n", lno);
+	fmap_unmap(&map);
+	return -1;
 }
@@ -0,0 +1,391 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "imgcache.h"
+#include "symcache.h"
+#include "stab.h"
+#include "fmap.h"
+#include "vector.h"
+#include "output.h"
+#include "util.h"
+
+#define IMGCACHE_MAX_ENTRIES	4
+
+struct img_chunk {
+	address_t		addr;
+	int			len;
+
+	/* Offset of the data in the entry's data vector */
+	int			offset;
+
+	/* Offset of the section name in the entry's name vector, or -1
+	 * if there is no name.
+	 */
+	int			name;
+
+	/* Position in the file, so that sorting is stable */
+	int			seq;
+};
+
+struct imgcache_entry {
+	uint64_t		size;
+	uint64_t		hash;
+	int			info;
+
+	int			have_text;
+	struct vector		chunks;
+	struct vector		data;
+	struct vector		names;
+
+	int			have_syms;
+	struct vector		syms;
+};
+
+/* Most recently used first */
+static struct imgcache_entry *cache[IMGCACHE_MAX_ENTRIES];
+static int cache_count;
+
+/************************************************************************
+ * Entry management
+ */
+
+static void clear_text(struct imgcache_entry *e)
+{
+	vector_destroy(&e->chunks);
+	vector_destroy(&e->data);
+	vector_destroy(&e->names);
+
+	vector_init(&e->chunks, sizeof(struct img_chunk));
+	vector_init(&e->data, 1);
+	vector_init(&e->names, 1);
+	e->have_text = 0;
+}
+
+static void entry_destroy(struct imgcache_entry *e)
+{
+	clear_text(e);
+	vector_destroy(&e->syms);
+	free(e);
+}
+
+static struct imgcache_entry *entry_new(uint64_t size, uint64_t hash,
+					FILE *in)
+{
+	struct imgcache_entry *e = malloc(sizeof(*e));
+
+	if (!e) {
+		pr_error("imgcache: can't allocate memory");
+		return NULL;
+	}
+
+	memset(e, 0, sizeof(*e));
+	e->size = size;
+	e->hash = hash;
+	e->info = binfile_info(in);
+
+	clear_text(e);
+	vector_init(&e->syms, 1);
+
+	return e;
+}
+
+static void move_to_front(int i)
+{
+	struct imgcache_entry *e = cache[i];
+
+	memmove(cache + 1, cache, i * sizeof(cache[0]));
+	cache[0] = e;
+}
+
+struct imgcache_entry *imgcache_open(FILE *in)
+{
+	struct fmap map;
+	uint64_t hash;
+	uint64_t size;
+	struct imgcache_entry *e;
+	int i;
+
+	if (fmap_map(&map, in, 0) < 0)
+		return NULL;
+
+	size = map.len;
+	hash = fnv64(FNV64_INIT, map.data, map.len);
+	fmap_unmap(&map);
+
+	for (i = 0; i < cache_count; i++) {
+		e = cache[i];
+
+		if (e->size == size && e->hash == hash) {
+			move_to_front(i);
+			return e;
+		}
+	}
+
+	e = entry_new(size, hash, in);
+	if (!e)
+		return NULL;
+
+	if (cache_count >= IMGCACHE_MAX_ENTRIES)
+		entry_destroy(cache[--cache_count]);
+
+	cache[cache_count++] = e;
+	move_to_front(cache_count - 1);
+	return e;
+}
+
+int imgcache_info(const struct imgcache_entry *e)
+{
+	return e->info;
+}
+
+void imgcache_clear(void)
+{
+	while (cache_count)
+		entry_destroy(cache[--cache_count]);
+}
+
+/************************************************************************
+ * Text
+ */
+
+static const char *chunk_name(const struct imgcache_entry *e,
+			      const struct img_chunk *c)
+{
+	if (c->name < 0)
+		return NULL;
+
+	return VECTOR_PTR(e->names, c->name, char);
+}
+
+static int same_name(const struct imgcache_entry *e,
+		     const struct img_chunk *c, const char *name)
+{
+	const char *cname = chunk_name(e, c);
+
+	return !strcmp(cname ? cname : "", name ? name : "");
+}
+
+static int collect_chunk(void *user_data, const struct binfile_chunk *ch)
+{
+	struct imgcache_entry *e = (struct imgcache_entry *)user_data;
+	struct img_chunk c;
+
+	if (!ch->len)
+		return 0;
+
+	/* Extend the previous chunk, if this one follows on from it */
+	if (e->chunks.size) {
+		struct img_chunk *last = VECTOR_PTR(e->chunks,
+			e->chunks.size - 1, struct img_chunk);
+
+		if (last->addr + last->len == ch->addr &&
+		    same_name(e, last, ch->name)) {
+			if (vector_push(&e->data, ch->data, ch->len) < 0)
+				goto fail;
+
+			last->len += ch->len;
+			return 0;
+		}
+	}
+
+	c.addr = ch->addr;
+	c.len = ch->len;
+	c.offset = e->data.size;
+	c.name = -1;
+	c.seq = e->chunks.size;
+
+	if (ch->name && *ch->name) {
+		const struct img_chunk *last = e->chunks.size ?
+			VECTOR_PTR(e->chunks, e->chunks.size - 1,
+				   struct img_chunk) : NULL;
+
+		if (last && same_name(e, last, ch->name)) {
+			c.name = last->name;
+		} else {
+			c.name = e->names.size;
+			if (vector_push(&e->names, ch->name,
+					strlen(ch->name) + 1) < 0)
+				goto fail;
+		}
+	}
+
+	if (vector_push(&e->data, ch->data, ch->len) < 0 ||
+	    vector_push(&e->chunks, &c, 1) < 0)
+		goto fail;
+
+	return 0;
+
+fail:
+	printc_err("imgcache: can't allocate memory for image\n");
+	return -1;
+}
+
+static int cmp_addr(const void *a, const void *b)
+{
+	const struct img_chunk *x = (const struct img_chunk *)a;
+	const struct img_chunk *y = (const struct img_chunk *)b;
+
+	if (x->addr != y->addr)
+		return x->addr < y->addr ? -1 : 1;
+
+	return x->seq - y->seq;
+}
+
+static int cmp_seq(const void *a, const void *b)
+{
+	const struct img_chunk *x = (const struct img_chunk *)a;
+	const struct img_chunk *y = (const struct img_chunk *)b;
+
+	return x->seq - y->seq;
+}
+
+/* Sort chunks by address, and merge any that become contiguous. If any
+ * chunks overlap, they're left in file order, so that later data still
+ * takes precedence when the image is replayed.
+ */
+static int sort_chunks(struct imgcache_entry *e)
+{
+	struct img_chunk *c = (struct img_chunk *)e->chunks.ptr;
+	const int n = e->chunks.size;
+	struct vector data;
+	int i;
+	int j = 0;
+
+	if (n < 2)
+		return 0;
+
+	qsort(c, n, sizeof(c[0]), cmp_addr);
+
+	for (i = 1; i < n; i++)
+		if (c[i].addr < c[i - 1].addr + c[i - 1].len) {
+			qsort(c, n, sizeof(c[0]), cmp_seq);
+			return 0;
+		}
+
+	vector_init(&data, 1);
+	if (vector_realloc(&data, e->data.size) < 0)
+		goto fail;
+
+	for (i = 0; i < n; i++) {
+		const uint8_t *src = VECTOR_PTR(e->data, c[i].offset,
+						uint8_t);
+
+		if (j && c[j - 1].addr + c[j - 1].len == c[i].addr &&
+		    same_name(e, &c[j - 1], chunk_name(e, &c[i]))) {
+			c[j - 1].len += c[i].len;
+		} else {
+			c[j] = c[i];
+			c[j].offset = data.size;
+			c[j].seq = j;
+			j++;
+		}
+
+		if (vector_push(&data, src, c[i].len) < 0)
+			goto fail;
+	}
+
+	vector_destroy(&e->data);
+	e->data = data;
+	e->chunks.size = j;
+	return 0;
+
+fail:
+	vector_destroy(&data);
+	printc_err("imgcache: can't allocate memory for image\n");
+	return -1;
+}
+
+int imgcache_extract(struct imgcache_entry *e, FILE *in,
+		     binfile_imgcb_t cb, void *user_data)
+{
+	int i;
+
+	if (!e->have_text) {
+		if (binfile_extract(in, collect_chunk, e) < 0 ||
+		    sort_chunks(e) < 0) {
+			clear_text(e);
+			return -1;
+		}
+
+		e->have_text = 1;
+	}
+
+	for (i = 0; i < e->chunks.size; i++) {
+		const struct img_chunk *c =
+			VECTOR_PTR(e->chunks, i, struct img_chunk);
+		struct binfile_chunk ch;
+
+		ch.name = chunk_name(e, c);
+		ch.addr = c->addr;
+		ch.data = VECTOR_PTR(e->data, c->offset, uint8_t);
+		ch.len = c->len;
+
+		if (cb(user_data, &ch) < 0)
+			return -1;
+	}
+
+	return 0;
+}
+
+/************************************************************************
+ * Symbols
+ */
+
+static void release_copy(void *ctx)
+{
+	free(ctx);
+}
+
+int imgcache_syms(struct imgcache_entry *e, FILE *in, const char *path)
+{
+	void *copy;
+
+	if (!e->have_syms) {
+		if (symcache_syms(in, path) < 0)
+			return -1;
+
+		if (stab_save_vector(&e->syms) < 0) {
+			vector_destroy(&e->syms);
+			vector_init(&e->syms, 1);
+		} else {
+			e->have_syms = 1;
+		}
+
+		return 0;
+	}
+
+	/* The symbol table annotates its image as it's used, so it gets
+	 * a copy of its own.
+	 */
+	copy = malloc(e->syms.size);
+	if (!copy) {
+		pr_error("imgcache: can't allocate memory for symbols");
+		return -1;
+	}
+
+	memcpy(copy, e->syms.ptr, e->syms.size);
+	if (stab_use_image(copy, e->syms.size, release_copy, copy) < 0) {
+		free(copy);
+		return -1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,66 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef IMGCACHE_H_
+#define IMGCACHE_H_
+
+#include "binfile.h"
+
+/* Cache of parsed image files.
+ *
+ * Images are identified by content: when a file is opened, it's hashed,
+ * and if an image with the same size and hash has been seen before, its
+ * parsed form is reused without probing or parsing the file again. The
+ * text of an image is kept as a list of chunks sorted by address, with
+ * contiguous chunks merged. Symbols are kept as a flat symbol table
+ * image.
+ *
+ * Only the most recently used images are kept in memory. Symbols are
+ * also cached on disk by symcache_syms().
+ */
+struct imgcache_entry;
+
+/* Look up an image file, adding it to the cache if necessary. The
+ * entry remains valid until the next call to imgcache_open() or
+ * imgcache_clear(). Returns NULL if an error occurs.
+ */
+struct imgcache_entry *imgcache_open(FILE *in);
+
+/* Find out what an image contains, as binfile_info() does. */
+int imgcache_info(const struct imgcache_entry *e);
+
+/* Feed the image's text to the given callback, as binfile_extract()
+ * does. The file is parsed only if the text isn't already cached.
+ *
+ * Returns 0 if successful, -1 if an error occurs.
+ */
+int imgcache_extract(struct imgcache_entry *e, FILE *in,
+		     binfile_imgcb_t cb, void *user_data);
+
+/* Load the image's symbols into an empty symbol table, as
+ * symcache_syms() does. The file is parsed (or looked up in the on-disk
+ * cache) only if the symbols aren't already cached.
+ *
+ * Returns 0 on success or -1 if an error occurs.
+ */
+int imgcache_syms(struct imgcache_entry *e, FILE *in, const char *path);
+
+/* Discard all cached images. */
+void imgcache_clear(void);
+
+#endif
@@ -19,6 +19,8 @@
 #include <ctype.h>
 #include <stdlib.h>
 #include "srec.h"
+#include "hexrec.h"
+#include "fmap.h"
 #include "util.h"
 #include "output.h"
 
@@ -45,92 +47,140 @@ int srec_check(FILE *in)
 	return 1;
 }
 
-int srec_extract(FILE *in, binfile_imgcb_t cb, void *user_data)
+/* Decode the bytes of a record (everything after the type). Returns the
+ * number of bytes, or -1 if the line is malformed.
+ */
+static int decode_line(const char *line, int len, uint8_t *bytes,
+		       int max_bytes, int lno)
 {
-	char buf[128];
-	int lno = 0;
+	int trimmed = len;
+	int count = 0;
+	int i;
 
-	rewind(in);
-	while (fgets(buf, sizeof(buf), in)) {
-		uint8_t bytes[128];
-		uint8_t cksum = 0;
-		int count = 0;
-		int i;
+	while (trimmed && isspace(line[trimmed - 1]))
+		trimmed--;
 
-		lno++;
+	/* Fast path: a well-formed record is nothing but hex pairs */
+	if (trimmed >= 2 && !(trimmed & 1)) {
+		count = (trimmed - 2) / 2;
 
-		if (buf[0] != 'S') {
-			printc_err("srec: garbage on line %d\n", lno);
+		if (count <= max_bytes &&
+		    !hexrec_decode(bytes, line + 2, count))
+			return count;
+	}
+
+	/* Otherwise, find the first fault */
+	count = 0;
+	for (i = 2; i + 1 < len && ishex(line[i]) && ishex(line[i + 1]);
+	     i += 2) {
+		if (count >= max_bytes) {
+			printc_err("srec: too many bytes on "
+				"line %d\n", lno);
 			return -1;
 		}
 
-		for (i = 2; ishex(buf[i]) && ishex(buf[i + 1]); i += 2) {
-			if (count >= sizeof(bytes)) {
-				printc_err("srec: too many bytes on "
-					"line %d\n", lno);
-				return -1;
-			}
+		bytes[count++] = (hexval(line[i]) << 4) |
+			hexval(line[i + 1]);
+	}
 
-			bytes[count++] = (hexval(buf[i]) << 4) |
-				hexval(buf[i + 1]);
+	for (; i < len; i++) {
+		if (!isspace(line[i])) {
+			printc_err("srec: trailing garbage on "
+				"line %d\n", lno);
+			return -1;
 		}
+	}
 
-		while (buf[i]) {
-			if (!isspace(buf[i])) {
-				printc_err("srec: trailing garbage on "
-					"line %d\n", lno);
-				return -1;
-			}
+	return count;
+}
 
-			i++;
+int srec_extract(FILE *in, binfile_imgcb_t cb, void *user_data)
+{
+	struct fmap map;
+	struct hexrec_merge merge;
+	const char *text;
+	const char *end;
+	int lno = 0;
+
+	if (fmap_map(&map, in, 0) < 0)
+		return -1;
+
+	hexrec_merge_init(&merge, cb, user_data);
+	text = (const char *)map.data;
+	end = text + map.len;
+
+	while (text < end) {
+		const char *line = text;
+		int len;
+		uint8_t bytes[256];
+		int count;
+
+		text = hexrec_line(text, end, &len);
+		lno++;
+
+		if (!len || line[0] != 'S') {
+			printc_err("srec: garbage on line %d\n", lno);
+			goto fail;
 		}
 
+		count = decode_line(line, len, bytes, sizeof(bytes), lno);
+		if (count < 0)
+			goto fail;
+
 		if (count < 2) {
 			printc_err("srec: too few bytes on line %d\n",
 				lno);
-			return -1;
+			goto fail;
 		}
 
 		if (bytes[0] + 1 != count) {
 			printc_err("srec: byte count mismatch on "
 				"line %d\n", lno);
-			return -1;
+			goto fail;
 		}
 
-		for (i = 0; i + 1 < count; i++)
-			cksum += bytes[i];
-		cksum = ~cksum;
-		if (cksum != bytes[count - 1]) {
+		/* The bytes of a valid record sum to 0xff */
+		if (hexrec_sum(bytes, count) != 0xff) {
+			uint8_t cksum = ~hexrec_sum(bytes, count - 1);
+
 			printc_err("srec: checksum error on line %d "
 				"(calc = 0x%02x, read = 0x%02x)\n",
 				lno, cksum, bytes[count - 1]);
-			return -1;
+			goto fail;
 		}
 
-		if (buf[1] >= '1' && buf[1] <= '3') {
-			int addrbytes = buf[1] - '1' + 2;
+		if (line[1] >= '1' && line[1] <= '3') {
+			int addrbytes = line[1] - '1' + 2;
 			address_t addr = 0;
-			struct binfile_chunk ch = {0};
-
-			for (i = 0; i < addrbytes; i++)
-				addr = (addr << 8) | bytes[i + 1];
+			int i;
 
 			if (count < addrbytes + 2) {
 				printc_err("srec: too few address bytes "
 					"on line %d\n", lno);
-				return -1;
+				goto fail;
 			}
 
-			ch.addr = addr;
-			ch.data = bytes + addrbytes + 1;
-			ch.len = count - 2 - addrbytes;
+			for (i = 0; i < addrbytes; i++)
+				addr = (addr << 8) | bytes[i + 1];
 
-			if (cb(user_data, &ch) < 0) {
+			if (hexrec_merge_feed(&merge, addr,
+					      bytes + addrbytes + 1,
+					      count - 2 - addrbytes) < 0) {
 				printc_err("srec: error on line %d\n", lno);
-				return -1;
+				goto fail;
 			}
 		}
 	}
 
+	if (hexrec_merge_flush(&merge) < 0) {
+		printc_err("srec: error on line %d\n", lno);
+		goto fail;
+	}
+
+	fmap_unmap(&map);
 	return 0;
+
+fail:
+	fmap_unmap(&map);
+	return -1;
 }
@@ -0,0 +1,275 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "symcache.h"
+#include "cachefile.h"
+#include "binfile.h"
+#include "stab.h"
+#include "fmap.h"
+#include "opdb.h"
+#include "output.h"
+#include "util.h"
+
+/* Each cache file holds the symbol table for one image file, and is
+ * named after a hash of the image's full path. It consists of a
+ * header, the full path, and then a flat symbol table image (see
+ * stab_save_image()) aligned to 8 bytes.
+ *
+ * The cache is only valid on the host which wrote it: everything is in
+ * host byte order.
+ */
+static const char cache_magic[8] = "MSPSYMC1";
+
+struct cache_header {
+	char		magic[8];
+	uint64_t	size;
+	int64_t		mtime;
+	uint64_t	hash;
+	uint32_t	path_len;
+	uint32_t	image_offset;
+	uint64_t	image_len;
+};
+
+struct image_key {
+	char		*path;
+	uint64_t	size;
+	int64_t		mtime;
+	uint64_t	hash;
+	int		have_hash;
+};
+
+/************************************************************************
+ * Image identification
+ */
+
+static char *full_path(const char *path)
+{
+#ifdef __Windows__
+	return _fullpath(NULL, path, 0);
+#else
+	return realpath(path, NULL);
+#endif
+}
+
+static int key_init(struct image_key *key, FILE *in, const char *path)
+{
+	struct stat st;
+
+	memset(key, 0, sizeof(*key));
+
+	if (fstat(fileno(in), &st) < 0)
+		return -1;
+
+	key->path = full_path(path);
+	if (!key->path)
+		return -1;
+
+	key->size = st.st_size;
+	key->mtime = st.st_mtime;
+	return 0;
+}
+
+/* Hash the contents of the image. This is done only when a cache entry
+ * matches on everything else, or when writing a new entry.
+ */
+static int key_hash(struct image_key *key, FILE *in)
+{
+	uint8_t buf[65536];
+	uint64_t h = FNV64_INIT;
+	size_t len;
+
+	if (key->have_hash)
+		return 0;
+
+	rewind(in);
+	while ((len = fread(buf, 1, sizeof(buf), in)) > 0)
+		h = fnv64(h, buf, len);
+
+	if (ferror(in)) {
+		pr_error("symcache: error reading image");
+		return -1;
+	}
+
+	rewind(in);
+	key->hash = h;
+	key->have_hash = 1;
+	return 0;
+}
+
+static char *cache_file_name(const struct image_key *key)
+{
+	return cachefile_name("symcache_dir", "",
+			      fnv64(FNV64_INIT, key->path, strlen(key->path)),
+			      "sym");
+}
+
+/************************************************************************
+ * Cache access
+ */
+
+static void release_map(void *ctx)
+{
+	struct fmap *m = (struct fmap *)ctx;
+
+	fmap_unmap(m);
+	free(m);
+}
+
+/* Map a cache file privately, so that the symbol table can annotate it
+ * in place without touching the file.
+ */
+static struct fmap *map_file(const char *filename)
+{
+	FILE *in = fopen(filename, "rb");
+	struct fmap *m;
+
+	if (!in)
+		return NULL;
+
+	m = malloc(sizeof(*m));
+	if (!m || fmap_map(m, in, FMAP_WRITABLE) < 0) {
+		free(m);
+		fclose(in);
+		return NULL;
+	}
+
+	fclose(in);
+
+	if (m->len < sizeof(struct cache_header)) {
+		release_map(m);
+		return NULL;
+	}
+
+	return m;
+}
+
+/* Returns 0 if the table was loaded from the cache, 1 if not */
+static int cache_load(const char *filename, struct image_key *key, FILE *in)
+{
+	struct fmap *m = map_file(filename);
+	const struct cache_header *hdr;
+	const char *path;
+
+	if (!m)
+		return 1;
+
+	hdr = (const struct cache_header *)m->data;
+	path = (const char *)(hdr + 1);
+
+	if (memcmp(hdr->magic, cache_magic, sizeof(cache_magic)) ||
+	    hdr->size != key->size || hdr->mtime != key->mtime ||
+	    hdr->path_len != strlen(key->path) ||
+	    hdr->path_len >= m->len - sizeof(*hdr) ||
+	    memcmp(path, key->path, hdr->path_len) ||
+	    hdr->image_offset & 7 ||
+	    hdr->image_offset > m->len ||
+	    hdr->image_len != m->len - hdr->image_offset)
+		goto miss;
+
+	if (key_hash(key, in) < 0 || hdr->hash != key->hash)
+		goto miss;
+
+	if (stab_use_image(m->data + hdr->image_offset,
+			   hdr->image_len, release_map, m) < 0)
+		goto miss;
+
+	printc_dbg("Loaded symbols from cache\n");
+	return 0;
+
+miss:
+	release_map(m);
+	return 1;
+}
+
+static int write_cache(void *user_data, FILE *out)
+{
+	static const char zero[8];
+	const struct image_key *key = (const struct image_key *)user_data;
+	struct cache_header hdr;
+	long end;
+
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, cache_magic, sizeof(cache_magic));
+	hdr.size = key->size;
+	hdr.mtime = key->mtime;
+	hdr.hash = key->hash;
+	hdr.path_len = strlen(key->path);
+	hdr.image_offset = (sizeof(hdr) + hdr.path_len + 1 + 7) & ~7;
+
+	/* Write the table first, then go back and fill in its length */
+	if (fwrite(&hdr, sizeof(hdr), 1, out) != 1 ||
+	    fwrite(key->path, 1, hdr.path_len, out) != hdr.path_len ||
+	    fwrite(zero, 1, hdr.image_offset - sizeof(hdr) - hdr.path_len,
+		   out) != hdr.image_offset - sizeof(hdr) - hdr.path_len ||
+	    stab_save_image(out) < 0 ||
+	    (end = ftell(out)) < 0)
+		return -1;
+
+	hdr.image_len = end - hdr.image_offset;
+	if (fseek(out, 0, SEEK_SET) < 0 ||
+	    fwrite(&hdr, sizeof(hdr), 1, out) != 1)
+		return -1;
+
+	return 0;
+}
+
+static void cache_store(const char *filename, struct image_key *key,
+			FILE *in)
+{
+	if (key_hash(key, in) < 0)
+		return;
+
+	cachefile_write(filename, write_cache, key);
+}
+
+int symcache_syms(FILE *in, const char *path)
+{
+	struct image_key key;
+	char *filename = NULL;
+	int ret;
+
+	if (!*opdb_get_string("symcache_dir") ||
+	    key_init(&key, in, path) < 0)
+		return binfile_syms(in);
+
+	filename = cache_file_name(&key);
+	if (!filename) {
+		free(key.path);
+		return binfile_syms(in);
+	}
+
+	ret = cache_load(filename, &key, in);
+	if (ret > 0) {
+		rewind(in);
+		ret = binfile_syms(in);
+		if (!ret)
+			cache_store(filename, &key, in);
+	}
+
+	free(filename);
+	free(key.path);
+	return ret;
+}
@@ -0,0 +1,37 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef SYMCACHE_H_
+#define SYMCACHE_H_
+
+#include <stdio.h>
+
+/* Load symbols from an image file into an empty symbol table, as
+ * binfile_syms() does.
+ *
+ * If the "symcache_dir" option is set, the table is first looked up
+ * in the on-disk cache there, keyed by the image's path, size,
+ * modification time and content hash. A cached table is used in place
+ * without being parsed. On a miss, the image is parsed and the result
+ * written to the cache.
+ *
+ * Returns 0 on success or -1 if an error occurs.
+ */
+int symcache_syms(FILE *in, const char *path);
+
+#endif
@@ -18,41 +18,47 @@
 
 #include <ctype.h>
 #include <stdlib.h>
+#include <string.h>
 #include "titext.h"
+#include "hexrec.h"
+#include "fmap.h"
 #include "util.h"
 #include "output.h"
 
-static int is_address_line(const char *text)
+#define MAX_DATA_BYTES	64
+
+static int is_address_line(const char *text, int len)
 {
-	if (*text != '@')
+	int i = 1;
+
+	if (!len || *text != '@')
 		return 0;
 
-	text++;
-	if (!*text || isspace(*text))
+	if (i >= len || isspace(text[i]))
 		return 0;
 
-	while (*text && !isspace(*text)) {
-		if (!ishex(*text))
+	while (i < len && !isspace(text[i])) {
+		if (!ishex(text[i]))
 			return 0;
-		text++;
+		i++;
 	}
 
-	while (*text) {
-		if (!isspace(*text))
+	while (i < len) {
+		if (!isspace(text[i]))
 			return 0;
-		text++;
+		i++;
 	}
 
 	return 1;
 }
 
-static int is_data_line(const char *text)
+static int is_data_line(const char *text, int len)
 {
-	while (*text) {
-		if (!(ishex(*text) || isspace(*text)))
+	int i;
+
+	for (i = 0; i < len; i++)
+		if (!(ishex(text[i]) || isspace(text[i])))
 			return 0;
-		text++;
-	}
 
 	return 1;
 }
@@ -65,25 +71,69 @@ int titext_check(FILE *in)
 	if (!fgets(buf, sizeof(buf), in))
 		return 0;
 
-	return is_address_line(buf);
+	return is_address_line(buf, strlen(buf));
+}
+
+static address_t parse_address(const char *text, int len)
+{
+	address_t addr = 0;
+	int i;
+
+	for (i = 1; i < len && ishex(text[i]); i++)
+		addr = (addr << 4) | hexval(text[i]);
+
+	return addr;
+}
+
+/* Fast path for the usual layout, in which each byte is written as two
+ * digits followed by a single space. Returns the number of bytes, or -1
+ * if the line is laid out some other way.
+ */
+static int decode_regular(uint8_t *data, const char *text, int len)
+{
+	char digits[MAX_DATA_BYTES * 2];
+	int nbytes;
+	int i;
+
+	while (len && isspace(text[len - 1]))
+		len--;
+
+	nbytes = (len + 1) / 3;
+	if (nbytes > MAX_DATA_BYTES || len != nbytes * 3 - 1)
+		return -1;
+
+	for (i = 0; i < nbytes; i++) {
+		if (i + 1 < nbytes && text[i * 3 + 2] != ' ')
+			return -1;
+
+		digits[i * 2] = text[i * 3];
+		digits[i * 2 + 1] = text[i * 3 + 1];
+	}
+
+	if (hexrec_decode(data, digits, nbytes) < 0)
+		return -1;
+
+	return nbytes;
 }
 
-static int process_data_line(address_t address, const char *buf,
-			     binfile_imgcb_t cb, void *user_data)
+static int decode_data_line(uint8_t *data, const char *text, int len)
 {
-	uint8_t data[64];
 	int data_len = 0;
 	int value = 0;
 	int vc = 0;
-	struct binfile_chunk ch = {0};
+	int i;
+
+	i = decode_regular(data, text, len);
+	if (i >= 0)
+		return i;
 
-	while (*buf) {
-		int c = *(buf++);
+	for (i = 0; i < len; i++) {
+		int c = text[i];
 		int x;
 
 		if (isspace(c)) {
 			if (vc) {
-				if (data_len >= sizeof(data))
+				if (data_len >= MAX_DATA_BYTES)
 					goto too_long;
 				data[data_len++] = value;
 			}
@@ -114,17 +164,11 @@ static int process_data_line(address_t address, const char *buf,
 	}
 
 	if (vc) {
-		if (data_len >= sizeof(data))
+		if (data_len >= MAX_DATA_BYTES)
 			goto too_long;
 		data[data_len++] = value;
 	}
 
-	ch.addr = address;
-	ch.data = data;
-	ch.len = data_len;
-	if (cb(user_data, &ch) < 0)
-		return -1;
-
 	return data_len;
 
  too_long:
@@ -134,28 +178,54 @@ static int process_data_line(address_t address, const char *buf,
 
 int titext_extract(FILE *in, binfile_imgcb_t cb, void *user_data)
 {
+	struct fmap map;
+	struct hexrec_merge merge;
+	const char *text;
+	const char *end;
 	address_t address = 0;
 	int lno = 0;
-	char buf[128];
 
-	rewind(in);
-	while (fgets(buf, sizeof(buf), in)) {
+	if (fmap_map(&map, in, 0) < 0)
+		return -1;
+
+	hexrec_merge_init(&merge, cb, user_data);
+	text = (const char *)map.data;
+	end = text + map.len;
+
+	while (text < end) {
+		const char *line = text;
+		int len;
+
+		text = hexrec_line(text, end, &len);
 		lno++;
 
-		if (is_address_line(buf)) {
-			address = strtoul(buf + 1, NULL, 16);
-		} else if (is_data_line(buf)) {
-			int count = process_data_line(address, buf,
-						      cb, user_data);
-			if (count < 0) {
+		if (is_address_line(line, len)) {
+			address = parse_address(line, len);
+		} else if (is_data_line(line, len)) {
+			uint8_t data[MAX_DATA_BYTES];
+			int count = decode_data_line(data, line, len);
+
+			if (count < 0 ||
+			    hexrec_merge_feed(&merge, address,
+					      data, count) < 0) {
 				printc_err("titext: data error on line "
 					"%d\n", lno);
-				return -1;
+				goto fail;
 			}
 
 			address += count;
 		}
 	}
 
+	if (hexrec_merge_flush(&merge) < 0) {
+		printc_err("titext: data error on line %d\n", lno);
+		goto fail;
+	}
+
+	fmap_unmap(&map);
 	return 0;
+
+fail:
+	fmap_unmap(&map);
+	return -1;
 }
@@ -31,6 +31,7 @@
 #include "simio_hwmult.h"
 #include "simio_gpio.h"
 #include "simio_console.h"
+#include "simio_power.h"
 
 static const struct simio_class *const class_db[] = {
 	&simio_tracer,
@@ -38,7 +39,8 @@ static const struct simio_class *const class_db[] = {
 	&simio_wdt,
 	&simio_hwmult,
 	&simio_gpio,
-	&simio_console
+	&simio_console,
+	&simio_power
 };
 
 /* Simulator data. We keep a list of devices on the bus, and the special
@@ -431,6 +433,20 @@ void simio_ack_interrupt(int irq)
 	}
 }
 
+void simio_insn(address_t pc, simio_insn_t insn,
+		uint16_t status_register, int cycles)
+{
+	struct list_node *n;
+
+	for (n = device_list.next; n != &device_list; n = n->next) {
+		struct simio_device *dev = (struct simio_device *)n;
+		const struct simio_class *type = dev->type;
+
+		if (type->insn)
+			type->insn(dev, pc, insn, status_register, cycles);
+	}
+}
+
 void simio_step(uint16_t status_register, int cycles)
 {
 	int clocks[SIMIO_NUM_CLOCKS] = {0};
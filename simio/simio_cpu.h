@@ -52,6 +52,37 @@ int simio_check_interrupt(void);
  */
 void simio_ack_interrupt(int irq);
 
+/* Instruction classes, for energy accounting. */
+typedef enum {
+	/* No instruction: the CPU is off */
+	SIMIO_INSN_IDLE = 0,
+
+	/* Register and constant operands only */
+	SIMIO_INSN_REG,
+
+	/* At least one operand in memory, including the stack */
+	SIMIO_INSN_MEM,
+
+	/* Jumps */
+	SIMIO_INSN_JUMP,
+
+	/* Interrupt acceptance */
+	SIMIO_INSN_IRQ,
+
+	SIMIO_NUM_INSN
+} simio_insn_t;
+
+/* This should be called after executing an instruction (or accepting an
+ * interrupt, or waiting with the CPU off), before simio_step(). It gives
+ * the address of the instruction, its class, and the number of cycles
+ * it took.
+ *
+ * As for simio_step(), the status_register value should be the value of
+ * SR _before_ the instruction was executed.
+ */
+void simio_insn(address_t pc, simio_insn_t insn,
+		uint16_t status_register, int cycles);
+
 /* This should be called after executing an instruction to advance the system
  * clocks.
  *
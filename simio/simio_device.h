@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include "util.h"
 #include "list.h"
+#include "simio_cpu.h"
 
 /* Each system clock has a unique index. After each instruction, step()
  * is invoked on each device with an array of clock transition counts.
@@ -105,6 +106,13 @@ struct simio_class {
 	 */
 	void (*step)(struct simio_device *dev,
 		     uint16_t status_register, const int *clocks);
+
+	/* Account for the execution of an instruction. This is invoked
+	 * before step(), with the arguments given to simio_insn().
+	 */
+	void (*insn)(struct simio_device *dev, address_t pc,
+		     simio_insn_t insn, uint16_t status_register,
+		     int cycles);
 };
 
 #endif
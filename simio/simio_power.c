@@ -0,0 +1,378 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "simio_device.h"
+#include "simio_power.h"
+#include "device.h"
+#include "output.h"
+#include "expr.h"
+#include "dis.h"
+
+/* Energy model. Each instruction is assigned a current, according to its
+ * class, which is drawn for as long as it takes to execute. While the
+ * CPU is off, the current depends on the low-power mode instead. On top
+ * of that, peripherals draw a current while their clocks are running,
+ * and IO accesses cost extra.
+ *
+ * Currents are averaged over fixed intervals of simulated time and fed
+ * into a power buffer, as if they'd been sampled by a FET.
+ */
+#define DEFAULT_INTERVAL_US	10
+#define DEFAULT_MCLK_HZ		1000000
+
+#define NUM_LPMS		5
+
+struct power {
+	struct simio_device	base;
+
+	powerbuf_t		pb;
+	unsigned int		interval_us;
+
+	/* Model parameters, in uA */
+	unsigned int		mclk_hz;
+	unsigned int		insn_ua[SIMIO_NUM_INSN];
+	unsigned int		lpm_ua[NUM_LPMS];
+	unsigned int		smclk_ua;
+	unsigned int		aclk_ua;
+	unsigned int		io_ua;
+
+	/* Sample in progress */
+	unsigned int		cycles_per_sample;
+	unsigned int		elapsed;
+	unsigned long long	charge;
+	int			io_pending;
+
+	unsigned long long	samples;
+	unsigned long long	total_charge;
+};
+
+/* Rough figures for an F2xx part at 1 MHz */
+static const unsigned int default_insn_ua[SIMIO_NUM_INSN] = {
+	[SIMIO_INSN_REG]	= 250,
+	[SIMIO_INSN_MEM]	= 330,
+	[SIMIO_INSN_JUMP]	= 220,
+	[SIMIO_INSN_IRQ]	= 300
+};
+
+static const unsigned int default_lpm_ua[NUM_LPMS] = {
+	85, 80, 22, 1, 0
+};
+
+static const char *const insn_names[SIMIO_NUM_INSN] = {
+	[SIMIO_INSN_REG]	= "reg",
+	[SIMIO_INSN_MEM]	= "mem",
+	[SIMIO_INSN_JUMP]	= "jump",
+	[SIMIO_INSN_IRQ]	= "irq"
+};
+
+static void update_rate(struct power *p)
+{
+	p->cycles_per_sample = (unsigned long long)p->mclk_hz *
+		p->interval_us / 1000000;
+
+	if (!p->cycles_per_sample)
+		p->cycles_per_sample = 1;
+
+	p->elapsed = 0;
+	p->charge = 0;
+}
+
+static struct simio_device *power_create(char **arg_text)
+{
+	const char *interval_text = get_arg(arg_text);
+	unsigned int interval_us = DEFAULT_INTERVAL_US;
+	struct power *p;
+
+	if (!device_default) {
+		printc_err("power: no device is open\n");
+		return NULL;
+	}
+
+	if (device_default->power_buf) {
+		printc_err("power: device already has a power buffer\n");
+		return NULL;
+	}
+
+	if (interval_text) {
+		address_t value;
+
+		if (expr_eval(interval_text, &value) < 0) {
+			printc_err("power: can't parse interval: %s\n",
+				   interval_text);
+			return NULL;
+		}
+
+		if (!value) {
+			printc_err("power: invalid interval: %d\n", value);
+			return NULL;
+		}
+
+		interval_us = value;
+	}
+
+	p = malloc(sizeof(*p));
+	if (!p) {
+		pr_error("power: can't allocate memory");
+		return NULL;
+	}
+
+	memset(p, 0, sizeof(*p));
+	p->base.type = &simio_power;
+	p->interval_us = interval_us;
+	p->mclk_hz = DEFAULT_MCLK_HZ;
+	memcpy(p->insn_ua, default_insn_ua, sizeof(p->insn_ua));
+	memcpy(p->lpm_ua, default_lpm_ua, sizeof(p->lpm_ua));
+	update_rate(p);
+
+	p->pb = powerbuf_new(POWERBUF_DEFAULT_SAMPLES, interval_us);
+	if (!p->pb) {
+		printc_err("power: can't allocate power buffer\n");
+		free(p);
+		return NULL;
+	}
+
+	device_default->power_buf = p->pb;
+	return (struct simio_device *)p;
+}
+
+static void power_destroy(struct simio_device *dev)
+{
+	struct power *p = (struct power *)dev;
+
+	if (device_default && device_default->power_buf == p->pb)
+		device_default->power_buf = NULL;
+
+	powerbuf_free(p->pb);
+	free(p);
+}
+
+static int config_value(unsigned int *value, const char *param,
+			char **arg_text)
+{
+	char *text = get_arg(arg_text);
+	address_t v;
+
+	if (!text) {
+		printc_err("power: config: expected a value for %s\n", param);
+		return -1;
+	}
+
+	if (expr_eval(text, &v) < 0) {
+		printc_err("power: can't parse value: %s\n", text);
+		return -1;
+	}
+
+	*value = v;
+	return 0;
+}
+
+static int power_config(struct simio_device *dev,
+			const char *param, char **arg_text)
+{
+	struct power *p = (struct power *)dev;
+	int i;
+
+	if (!strcasecmp(param, "mclk")) {
+		if (config_value(&p->mclk_hz, param, arg_text) < 0)
+			return -1;
+
+		update_rate(p);
+		return 0;
+	}
+
+	for (i = 0; i < SIMIO_NUM_INSN; i++)
+		if (insn_names[i] && !strcasecmp(param, insn_names[i]))
+			return config_value(&p->insn_ua[i], param, arg_text);
+
+	if (!strncasecmp(param, "lpm", 3) && param[3] >= '0' &&
+	    param[3] < '0' + NUM_LPMS && !param[4])
+		return config_value(&p->lpm_ua[param[3] - '0'],
+				    param, arg_text);
+
+	if (!strcasecmp(param, "smclk"))
+		return config_value(&p->smclk_ua, param, arg_text);
+	if (!strcasecmp(param, "aclk"))
+		return config_value(&p->aclk_ua, param, arg_text);
+	if (!strcasecmp(param, "io"))
+		return config_value(&p->io_ua, param, arg_text);
+
+	printc_err("power: config: unknown parameter: %s\n", param);
+	return -1;
+}
+
+static int power_info(struct simio_device *dev)
+{
+	struct power *p = (struct power *)dev;
+	int i;
+
+	printc("Sample interval:   %d us (%d cycles)\n",
+	       p->interval_us, p->cycles_per_sample);
+	printc("MCLK:              %d Hz\n", p->mclk_hz);
+
+	for (i = 0; i < SIMIO_NUM_INSN; i++)
+		if (insn_names[i])
+			printc("Active (%-4s):     %d uA\n",
+			       insn_names[i], p->insn_ua[i]);
+
+	for (i = 0; i < NUM_LPMS; i++)
+		printc("LPM%d:              %d uA\n", i, p->lpm_ua[i]);
+
+	printc("SMCLK peripherals: %d uA\n", p->smclk_ua);
+	printc("ACLK peripherals:  %d uA\n", p->aclk_ua);
+	printc("IO access:         %d uA\n", p->io_ua);
+
+	printc("\nSamples:           %" LLFMT "\n", p->samples);
+	printc("Total charge:      %.01f uAs\n",
+	       (double)p->total_charge / (double)p->mclk_hz);
+
+	return 0;
+}
+
+static void power_reset(struct simio_device *dev)
+{
+	struct power *p = (struct power *)dev;
+
+	p->elapsed = 0;
+	p->charge = 0;
+	p->io_pending = 0;
+}
+
+static int power_write(struct simio_device *dev,
+		       address_t addr, uint16_t data)
+{
+	((struct power *)dev)->io_pending = 1;
+	return 1;
+}
+
+static int power_read(struct simio_device *dev,
+		      address_t addr, uint16_t *data)
+{
+	((struct power *)dev)->io_pending = 1;
+	return 1;
+}
+
+static int power_write_b(struct simio_device *dev,
+			 address_t addr, uint8_t data)
+{
+	((struct power *)dev)->io_pending = 1;
+	return 1;
+}
+
+static int power_read_b(struct simio_device *dev,
+			address_t addr, uint8_t *data)
+{
+	((struct power *)dev)->io_pending = 1;
+	return 1;
+}
+
+static unsigned int lpm_current(const struct power *p, uint16_t status)
+{
+	int lpm = 0;
+
+	if (status & MSP430_SR_OSCOFF)
+		lpm = 4;
+	else
+		lpm = ((status & MSP430_SR_SCG1) ? 2 : 0) |
+			((status & MSP430_SR_SCG0) ? 1 : 0);
+
+	return p->lpm_ua[lpm];
+}
+
+static void power_insn(struct simio_device *dev, address_t pc,
+		       simio_insn_t insn, uint16_t status_register,
+		       int cycles)
+{
+	struct power *p = (struct power *)dev;
+	unsigned int ua;
+
+	if (insn == SIMIO_INSN_IDLE)
+		ua = lpm_current(p, status_register);
+	else
+		ua = p->insn_ua[insn];
+
+	/* Clocks are gated as in simio_step() */
+	if (!(status_register & MSP430_SR_SCG1))
+		ua += p->smclk_ua;
+	if (!(status_register & MSP430_SR_OSCOFF))
+		ua += p->aclk_ua;
+
+	if (p->io_pending) {
+		ua += p->io_ua;
+		p->io_pending = 0;
+	}
+
+	p->total_charge += (unsigned long long)ua * cycles;
+
+	while (cycles > 0) {
+		unsigned int n = p->cycles_per_sample - p->elapsed;
+		unsigned int avg;
+
+		if (n > cycles)
+			n = cycles;
+
+		p->charge += (unsigned long long)ua * n;
+		p->elapsed += n;
+		cycles -= n;
+
+		if (p->elapsed < p->cycles_per_sample)
+			break;
+
+		avg = p->charge / p->cycles_per_sample;
+		powerbuf_add_samples(p->pb, 1, &avg, &pc);
+		p->samples++;
+
+		p->elapsed = 0;
+		p->charge = 0;
+	}
+}
+
+const struct simio_class simio_power = {
+	.name = "power",
+	.help =
+"This module models the current drawn by the simulated device, and feeds\n"
+"samples into a power buffer for use with the \"power\" command.\n"
+"\n"
+"Constructor arguments: [interval]\n"
+"    Set the sample interval in microseconds (default 10).\n"
+"\n"
+"Config arguments are:\n"
+"    mclk <hz>\n"
+"        Set the simulated MCLK frequency (default 1 MHz).\n"
+"    reg|mem|jump|irq <uA>\n"
+"        Set the current drawn by each class of instruction.\n"
+"    lpm0|lpm1|lpm2|lpm3|lpm4 <uA>\n"
+"        Set the current drawn in each low-power mode.\n"
+"    smclk|aclk <uA>\n"
+"        Set the current drawn by peripherals while each clock runs.\n"
+"    io <uA>\n"
+"        Set the extra current drawn by instructions which access\n"
+"        peripheral registers.\n",
+	.create			= power_create,
+	.destroy		= power_destroy,
+	.config			= power_config,
+	.info			= power_info,
+	.reset			= power_reset,
+	.write			= power_write,
+	.read			= power_read,
+	.write_b		= power_write_b,
+	.read_b			= power_read_b,
+	.insn			= power_insn
+};
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+#
+# MSPDebug - debugging tool for MSP430 MCUs
+# Copyright (C) 2009-2012 Daniel Beer
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+"""Convert a chip database to the shared-table layout used by chipinfo.h.
+
+chipinfo.db is generated outside the tree from MSP430.DLL. The generator
+writes each chip's memory map, clock map, function map and EEM, voltage
+and power parameters inline, and each funclet's code in a fixed-size
+array inside its struct. This script reads that layout on stdin and
+writes the layout which util/chipinfo.h expects on stdout:
+
+  - funclet code is moved into an array of exactly the right length;
+  - each distinct block of the kinds above is emitted once, as a static
+    table, and chip entries refer to it.
+
+Usage: python3 tools/chipinfo-dedup.py < generated.db > chipinfo.db
+"""
+
+import re
+import sys
+
+DB_START = 'const struct chipinfo chipinfo_db[]'
+GENERATED_NOTE = ' * THIS FILE WAS GENERATED FROM MSP430.DLL'
+
+# Kinds of shared table: declaration, and whether chip entries refer to
+# them by address (structs) or by name (arrays).
+KINDS = {
+    'memory':       ('static const struct chipinfo_memory %s[] = {', False),
+    'clock_map':    ('static const struct chipinfo_clockmap '
+                     '%s[CHIPINFO_NUM_CLOCKS] = {', False),
+    'v3_functions': ('static const uint8_t %s[CHIPINFO_NUM_FUNCTIONS] = {',
+                     False),
+    'eem':          ('static const struct chipinfo_eem %s = {', True),
+    'voltage':      ('static const struct chipinfo_voltage %s = {', True),
+    'power':        ('static const struct chipinfo_power %s = {', True),
+}
+
+ORDER = ['memory', 'clock_map', 'v3_functions', 'eem', 'voltage', 'power']
+
+
+def fail(msg):
+    sys.stderr.write('chipinfo-dedup: %s\n' % msg)
+    sys.exit(1)
+
+
+def add_note(lines):
+    """Record the conversion below the generator's own note."""
+    for i, l in enumerate(lines):
+        if l.startswith(GENERATED_NOTE):
+            lines.insert(i + 1,
+                         ' * AND CONVERTED BY tools/chipinfo-dedup.py')
+            return lines
+
+    return lines
+
+
+def convert_funclets(pre):
+    """Move funclet code out of the structs, into arrays of their own."""
+    out = []
+    i = 0
+
+    while i < len(pre):
+        m = re.match(r'static const struct chipinfo_funclet (\w+) = \{$',
+                     pre[i])
+        if not m:
+            out.append(pre[i])
+            i += 1
+            continue
+
+        name = m.group(1)
+        j = i
+        while not pre[j].startswith('};'):
+            j += 1
+        block = pre[i:j]
+
+        starts = [k for k, b in enumerate(block)
+                  if b.startswith('\t.code\t\t= {')]
+        if len(starts) != 1 or block[-1] != '\t}':
+            fail('unexpected layout for funclet %s' % name)
+
+        ci = starts[0]
+        out.append('static const uint16_t %s_code[] = {' % name)
+        out.extend(block[ci + 1:-1])
+        out.append('};')
+        out.append('')
+        out.extend(block[:ci])
+        out.append('\t.code\t\t= %s_code' % name)
+        out.append('};')
+        i = j + 1
+
+    return out
+
+
+def share_tables(body):
+    """Replace inline blocks in chip entries with shared tables."""
+    index = {k: {} for k in KINDS}
+    tables = {k: [] for k in KINDS}
+    out = []
+    i = 0
+
+    while i < len(body):
+        m = re.match(r'^\t\t\.(\w+)(\t+)= \{(.*)$', body[i])
+        if not (m and m.group(1) in KINDS):
+            out.append(body[i])
+            i += 1
+            continue
+
+        kind = m.group(1)
+        rest = m.group(3).strip()
+
+        if rest.endswith('},'):
+            inner = ['\t' + rest[:-2].strip()] if rest[:-2].strip() else []
+            i += 1
+        else:
+            j = i + 1
+            while body[j] != '\t\t},':
+                j += 1
+            inner = [x[2:] if x.startswith('\t\t') else x
+                     for x in body[i + 1:j]]
+            i = j + 1
+
+        key = '\n'.join(x.strip() for x in inner)
+        if key not in index[kind]:
+            name = 'chip_%s_%d' % (kind, len(tables[kind]))
+            index[kind][key] = name
+            tables[kind].append((name, inner))
+
+        name = index[kind][key]
+        ref = '&' + name if KINDS[kind][1] else name
+        out.append('\t\t.%s%s= %s,' % (kind, m.group(2), ref))
+
+    shared = ['/* Tables shared between chips */', '']
+    for kind in ORDER:
+        for name, inner in tables[kind]:
+            shared.append(KINDS[kind][0] % name)
+            shared.extend(inner)
+            shared.append('};')
+            shared.append('')
+        sys.stderr.write('%s: %d distinct\n' % (kind, len(tables[kind])))
+
+    return shared, out
+
+
+def main():
+    lines = sys.stdin.read().split('\n')
+
+    starts = [i for i, l in enumerate(lines) if l.startswith(DB_START)]
+    if len(starts) != 1:
+        fail('can\'t find the chip table')
+
+    pre = lines[:starts[0]]
+    body = lines[starts[0]:]
+
+    if not any(re.match(r'^\t\t\.memory\t+= \{', l) for l in body):
+        fail('input has no inline memory maps: already converted?')
+
+    shared, body = share_tables(body)
+    sys.stdout.write('\n'.join(add_note(convert_funclets(pre)) +
+                               shared + body))
+
+
+if __name__ == '__main__':
+    main()
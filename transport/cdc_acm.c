@@ -48,6 +48,9 @@ struct cdc_acm_transport {
 	int			rbuf_len;
 	int			rbuf_ptr;
 	char			rbuf[READ_BUFFER_SIZE];
+
+	/* Serial number of the device, or empty if it has none */
+	char			serial[128];
 };
 
 #define CDC_INTERFACE_CLASS		10
@@ -164,12 +167,25 @@ static int usbtr_set_modem(transport_t tr_base, transport_modem_t state)
 	return 0;
 }
 
+static int usbtr_get_serial(transport_t tr_base, char *buf, int max_len)
+{
+	struct cdc_acm_transport *tr = (struct cdc_acm_transport *)tr_base;
+
+	if (!tr->serial[0] || max_len < 1)
+		return -1;
+
+	strncpy(buf, tr->serial, max_len - 1);
+	buf[max_len - 1] = 0;
+	return 0;
+}
+
 static const struct transport_class cdc_acm_class = {
 	.destroy	= usbtr_destroy,
 	.send		= usbtr_send,
 	.recv		= usbtr_recv,
 	.flush		= usbtr_flush,
-	.set_modem	= usbtr_set_modem
+	.set_modem	= usbtr_set_modem,
+	.get_serial	= usbtr_get_serial
 };
 
 static int find_interface(struct cdc_acm_transport *tr,
@@ -317,6 +333,11 @@ transport_t cdc_acm_open(const char *devpath, const char *requested_serial,
 		return NULL;
 	}
 
+	if (dev->descriptor.iSerialNumber &&
+	    usb_get_string_simple(tr->handle, dev->descriptor.iSerialNumber,
+				  tr->serial, sizeof(tr->serial)) < 0)
+		tr->serial[0] = 0;
+
 	if (configure_port(tr, baud_rate) < 0) {
 		usb_release_interface(tr->handle, tr->int_number);
 		usb_close(tr->handle);
@@ -33,6 +33,7 @@
 #include "usbutil.h"
 #include "output.h"
 #include "ihex.h"
+#include "ti3410_fw.h"
 
 /************************************************************************
  * Definitions taken from drivers/usb/serial/ti_usb_3410_5052.h in the
@@ -376,40 +377,6 @@ struct firmware {
 	unsigned int	size;
 };
 
-static FILE *find_firmware(void)
-{
-	char path[256];
-	const char *env;
-	FILE *in;
-
-	printc_dbg("Searching for firmware for TI3410...\n");
-
-	env = getenv("MSPDEBUG_TI3410_FW");
-	if (env) {
-		snprintf(path, sizeof(path), "%s", env);
-		printc_dbg("    - checking %s\n", path);
-		in = fopen(path, "r");
-		if (in)
-			return in;
-	}
-
-	snprintf(path, sizeof(path), "%s",
-		 LIB_DIR "/mspdebug/ti_3410.fw.ihex");
-	printc_dbg("    - checking %s\n", path);
-	in = fopen(path, "r");
-	if (in)
-		return in;
-
-	snprintf(path, sizeof(path), "%s", "ti_3410.fw.ihex");
-	printc_dbg("    - checking %s\n", path);
-	in = fopen(path, "r");
-	if (in)
-		return in;
-
-	printc_err("ti3410: unable to locate firmware\n");
-	return NULL;
-}
-
 static int do_extract(void *user_data, const struct binfile_chunk *ch)
 {
 	struct firmware *f = (struct firmware *)user_data;
@@ -430,12 +397,17 @@ static int do_extract(void *user_data, const struct binfile_chunk *ch)
 	return 0;
 }
 
-static int load_firmware(struct firmware *f)
+static int load_firmware(const char *path, struct firmware *f)
 {
-	FILE *in = find_firmware();
+	FILE *in;
+
+	printc_dbg("Loading TI3410 firmware from %s...\n", path);
 
-	if (!in)
+	in = fopen(path, "r");
+	if (!in) {
+		printc_err("ti3410: can't open %s: %s\n", path, last_error());
 		return -1;
+	}
 
 	if (!ihex_check(in)) {
 		printc_err("ti3410: not a valid IHEX file\n");
@@ -471,7 +443,8 @@ static void prepare_firmware(struct firmware *f)
 		   f->size, cksum);
 }
 
-static int do_download(struct usb_device *dev, const struct firmware *f)
+static int do_download(struct usb_device *dev,
+		       const uint8_t *data, unsigned int size)
 {
 	struct usb_dev_handle *hnd;
 	int offset = 0;
@@ -496,15 +469,15 @@ static int do_download(struct usb_device *dev, const struct firmware *f)
 		return -1;
 	}
 
-	while (offset < f->size) {
-		int plen = f->size - offset;
+	while (offset < size) {
+		int plen = size - offset;
 		int r;
 
 		if (plen > TI_DOWNLOAD_MAX_PACKET_SIZE)
 			plen = TI_DOWNLOAD_MAX_PACKET_SIZE;
 
                 r = usb_bulk_write(hnd, USB_FDL_OUT_EP,
-				   (char *)f->buf + offset, plen, TIMEOUT);
+				   (char *)data + offset, plen, TIMEOUT);
 		if (r < 0) {
 			pr_error("ti3410: bulk write failed");
 			usb_close(hnd);
@@ -524,15 +497,26 @@ static int do_download(struct usb_device *dev, const struct firmware *f)
 
 static int download_firmware(struct usb_device *dev)
 {
-	struct firmware frm;
+	const char *path = getenv("MSPDEBUG_TI3410_FW");
 
-	if (load_firmware(&frm) < 0)
-		return -1;
+	/* The built-in image is used unless overridden */
+	if (path) {
+		struct firmware frm;
+
+		if (load_firmware(path, &frm) < 0)
+			return -1;
 
-	prepare_firmware(&frm);
+		prepare_firmware(&frm);
 
-	if (do_download(dev, &frm) < 0)
-		return -1;
+		if (do_download(dev, frm.buf, frm.size) < 0)
+			return -1;
+	} else {
+		printc_dbg("Using built-in TI3410 firmware (%d bytes)\n",
+			   ti3410_fw.size);
+
+		if (do_download(dev, ti3410_fw.data, ti3410_fw.size) < 0)
+			return -1;
+	}
 
 	printc_dbg("Waiting for TI3410 reset...\n");
 	delay_s(2);
@@ -0,0 +1,1739 @@
+/* TI3410 firmware image: FW3410_Special_StartWdogOnStartPort, 9/10/04.
+ * Copyright (C) 2004 Texas Instruments
+ *
+ * Generated from ti_3410.fw.ihex, which was obtained from the Linux
+ * kernel sources (see ti_3410.fw.txt for the original notes). The
+ * first three bytes hold the image size (excluding them) and checksum,
+ * as expected by the TI3410 boot loader.
+ */
+
+#include "ti3410_fw.h"
+
+static const uint8_t ti3410_fw_image[] = {
+	0xc2, 0x35, 0xb5, 0x02, 0x00, 0x1e, 0x02, 0x1a,
+	0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x32,
+	0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x33,
+	0x76, 0x75, 0x81, 0xce, 0x90, 0xfd, 0xe8, 0x85,
+	0x83, 0xa0, 0x12, 0x34, 0xea, 0xec, 0x4d, 0x60,
+	0x6a, 0x78, 0xab, 0x80, 0x03, 0x76, 0x00, 0x18,
+	0xb8, 0x9c, 0xfa, 0x78, 0x7f, 0x80, 0x03, 0x76,
+	0x00, 0x18, 0xb8, 0x65, 0xfa, 0x78, 0x20, 0x80,
+	0x03, 0x76, 0x00, 0x18, 0xb8, 0x20, 0xfa, 0x90,
+	0xfd, 0xdd, 0xae, 0x83, 0xaf, 0x82, 0x90, 0xfb,
+	0xf8, 0x12, 0x00, 0xa1, 0x60, 0x05, 0xe4, 0xf0,
+	0xa3, 0x80, 0xf6, 0x90, 0xfd, 0xe8, 0xa8, 0x82,
+	0x90, 0xfd, 0xe8, 0xa9, 0x82, 0xe8, 0xc3, 0x99,
+	0x50, 0x05, 0x76, 0x00, 0x08, 0x80, 0xf6, 0x90,
+	0x00, 0xff, 0x12, 0x00, 0xaa, 0x90, 0x01, 0x03,
+	0x12, 0x00, 0xaa, 0x90, 0x01, 0x07, 0x12, 0x00,
+	0xaa, 0x90, 0x01, 0x0b, 0x12, 0x00, 0xc8, 0x90,
+	0x01, 0x11, 0x12, 0x00, 0xc8, 0x90, 0x01, 0x17,
+	0x12, 0x00, 0xc8, 0x75, 0xd0, 0x00, 0x12, 0x33,
+	0xc8, 0x02, 0x01, 0x1d, 0xef, 0x65, 0x82, 0x70,
+	0x03, 0xee, 0x65, 0x83, 0x22, 0xe4, 0x93, 0xf8,
+	0x74, 0x01, 0x93, 0xf9, 0x74, 0x02, 0x93, 0xfe,
+	0x74, 0x03, 0x93, 0xf5, 0x82, 0x8e, 0x83, 0xe8,
+	0x69, 0x70, 0x01, 0x22, 0xe4, 0x93, 0xf6, 0xa3,
+	0x08, 0x80, 0xf4, 0xe4, 0x93, 0xfc, 0x74, 0x01,
+	0x93, 0xfd, 0x74, 0x02, 0x93, 0xfe, 0x74, 0x03,
+	0x93, 0xff, 0x74, 0x04, 0x93, 0xf8, 0x74, 0x05,
+	0x93, 0xf5, 0x82, 0x88, 0x83, 0x12, 0x00, 0xa1,
+	0x70, 0x01, 0x22, 0xe4, 0x93, 0xa3, 0xa8, 0x83,
+	0xa9, 0x82, 0x8c, 0x83, 0x8d, 0x82, 0xf0, 0xa3,
+	0xac, 0x83, 0xad, 0x82, 0x88, 0x83, 0x89, 0x82,
+	0x80, 0xe3, 0x21, 0x21, 0x04, 0x92, 0x80, 0x80,
+	0x04, 0x92, 0xac, 0xae, 0x04, 0x92, 0xfd, 0xe8,
+	0x04, 0x94, 0x04, 0x94, 0xfb, 0xf3, 0x04, 0x99,
+	0x04, 0x94, 0xfb, 0xf3, 0x04, 0xf9, 0x04, 0xf9,
+	0x80, 0xfe, 0xd0, 0xf0, 0x30, 0xf0, 0x09, 0x20,
+	0xf3, 0x03, 0xf6, 0x80, 0x10, 0xf7, 0x80, 0x0d,
+	0x30, 0xf1, 0x09, 0x20, 0xf3, 0x03, 0xf2, 0x80,
+	0x04, 0xf3, 0x80, 0x01, 0xf0, 0x20, 0xf4, 0x04,
+	0xfc, 0xd0, 0xe0, 0xcc, 0x22, 0xcc, 0xc0, 0xe0,
+	0x12, 0x01, 0x5a, 0x02, 0x01, 0x4b, 0xbc, 0x00,
+	0x05, 0xd0, 0xf0, 0xac, 0xf0, 0x22, 0xc3, 0x13,
+	0xdc, 0xfc, 0x02, 0x01, 0x21, 0xbf, 0x00, 0x09,
+	0xed, 0x25, 0x82, 0x75, 0xf0, 0x01, 0xf8, 0xe6,
+	0x22, 0xbf, 0x01, 0x0f, 0xed, 0x25, 0x82, 0xf5,
+	0x82, 0xee, 0x35, 0x83, 0xf5, 0x83, 0x75, 0xf0,
+	0x04, 0xe0, 0x22, 0xed, 0x25, 0x82, 0x75, 0xf0,
+	0x02, 0xf8, 0xe2, 0x22, 0xd0, 0x83, 0xd0, 0x82,
+	0xf5, 0xf0, 0xc3, 0xe4, 0x93, 0xa3, 0xc5, 0xf0,
+	0x95, 0xf0, 0xc0, 0xe0, 0xc3, 0xd0, 0xf0, 0xe4,
+	0x93, 0xa3, 0x95, 0xf0, 0x40, 0x12, 0xa3, 0xa3,
+	0xc3, 0xe5, 0xf0, 0x33, 0x50, 0x02, 0x05, 0x83,
+	0x25, 0x82, 0xf5, 0x82, 0x50, 0x02, 0x05, 0x83,
+	0x74, 0x01, 0x93, 0xc0, 0xe0, 0xe4, 0x93, 0xc0,
+	0xe0, 0x22, 0xd0, 0x83, 0xd0, 0x82, 0xf5, 0xf0,
+	0xe4, 0x93, 0x70, 0x09, 0x74, 0x01, 0x93, 0x70,
+	0x04, 0xa3, 0xa3, 0x80, 0x0c, 0x74, 0x02, 0x93,
+	0x65, 0xf0, 0x60, 0x05, 0xa3, 0xa3, 0xa3, 0x80,
+	0xe7, 0x74, 0x01, 0x93, 0xc0, 0xe0, 0xe4, 0x93,
+	0xc0, 0xe0, 0x22, 0x12, 0x02, 0x5b, 0x02, 0x01,
+	0xf2, 0x12, 0x02, 0xaf, 0x02, 0x01, 0xf2, 0x12,
+	0x02, 0xd3, 0x02, 0x01, 0xf2, 0x30, 0xe0, 0x07,
+	0x20, 0xe3, 0x02, 0xe6, 0x22, 0xe7, 0x22, 0x30,
+	0xe1, 0x07, 0x20, 0xe3, 0x02, 0xe2, 0x22, 0xe3,
+	0x22, 0x30, 0xe2, 0x02, 0xe0, 0x22, 0xe4, 0x93,
+	0x22, 0x12, 0x02, 0xd3, 0x02, 0x02, 0x1a, 0x12,
+	0x02, 0xaf, 0x02, 0x02, 0x1a, 0xab, 0xf0, 0x12,
+	0x02, 0x24, 0xcb, 0xc5, 0xf0, 0xcb, 0x22, 0x30,
+	0xe0, 0x10, 0x20, 0xe3, 0x06, 0xe6, 0xf5, 0xf0,
+	0x08, 0xe6, 0x22, 0xe7, 0xf5, 0xf0, 0x09, 0xe7,
+	0x19, 0x22, 0x30, 0xe1, 0x10, 0x20, 0xe3, 0x06,
+	0xe2, 0xf5, 0xf0, 0x08, 0xe2, 0x22, 0xe3, 0xf5,
+	0xf0, 0x09, 0xe3, 0x19, 0x22, 0x30, 0xe2, 0x06,
+	0xe0, 0xf5, 0xf0, 0xa3, 0xe0, 0x22, 0xe4, 0x93,
+	0xf5, 0xf0, 0x74, 0x01, 0x93, 0x22, 0xbb, 0x00,
+	0x03, 0x74, 0x09, 0x22, 0xbb, 0x01, 0x07, 0x89,
+	0x82, 0x8a, 0x83, 0x74, 0x04, 0x22, 0xbb, 0x02,
+	0x07, 0x89, 0x82, 0x8a, 0x83, 0x74, 0x10, 0x22,
+	0x74, 0x0a, 0x22, 0x02, 0x02, 0x7b, 0xbb, 0x00,
+	0x07, 0xe9, 0x25, 0x82, 0xf8, 0x74, 0x01, 0x22,
+	0xbb, 0x01, 0x0d, 0xe9, 0x25, 0x82, 0xf5, 0x82,
+	0xea, 0x35, 0x83, 0xf5, 0x83, 0x74, 0x04, 0x22,
+	0xbb, 0x02, 0x0d, 0xe9, 0x25, 0x82, 0xf5, 0x82,
+	0xea, 0x35, 0x83, 0xf5, 0x83, 0x74, 0x10, 0x22,
+	0xe9, 0x25, 0x82, 0xf8, 0x74, 0x02, 0x22, 0x02,
+	0x02, 0xaf, 0xbf, 0x00, 0x05, 0xed, 0xf8, 0x74,
+	0x01, 0x22, 0xbf, 0x01, 0x07, 0x8d, 0x82, 0x8e,
+	0x83, 0x74, 0x04, 0x22, 0xbf, 0x02, 0x07, 0x8d,
+	0x82, 0x8e, 0x83, 0x74, 0x10, 0x22, 0xed, 0xf8,
+	0x74, 0x02, 0x22, 0x02, 0x02, 0xd3, 0xbf, 0x00,
+	0x07, 0xed, 0x25, 0x82, 0xf8, 0x74, 0x01, 0x22,
+	0xbf, 0x01, 0x0d, 0xed, 0x25, 0x82, 0xf5, 0x82,
+	0xee, 0x35, 0x83, 0xf5, 0x83, 0x74, 0x04, 0x22,
+	0xbf, 0x02, 0x0d, 0xed, 0x25, 0x82, 0xf5, 0x82,
+	0xee, 0x35, 0x83, 0xf5, 0x83, 0x74, 0x10, 0x22,
+	0xed, 0x25, 0x82, 0xf8, 0x74, 0x02, 0x22, 0x02,
+	0x03, 0x07, 0xc0, 0xe0, 0x12, 0x02, 0x5b, 0x02,
+	0x03, 0x1f, 0xc0, 0xe0, 0x12, 0x02, 0xaf, 0x02,
+	0x03, 0x1f, 0xc0, 0xe0, 0x12, 0x02, 0xd3, 0x02,
+	0x03, 0x1f, 0x30, 0xe0, 0x0b, 0x20, 0xe3, 0x04,
+	0xd0, 0xe0, 0xf6, 0x22, 0xd0, 0xe0, 0xf7, 0x22,
+	0x30, 0xe1, 0x0b, 0x20, 0xe3, 0x04, 0xd0, 0xe0,
+	0xf2, 0x22, 0xd0, 0xe0, 0xf3, 0x22, 0xd0, 0xe0,
+	0xf0, 0x22, 0xc9, 0xcd, 0xc9, 0xca, 0xce, 0xca,
+	0xcb, 0xcf, 0xcb, 0x12, 0x03, 0x52, 0xed, 0xf9,
+	0xee, 0xfa, 0xef, 0xfb, 0x22, 0xbb, 0x00, 0x2f,
+	0xbf, 0x00, 0x0a, 0xfa, 0xed, 0xf8, 0xe7, 0xf6,
+	0x08, 0x09, 0xda, 0xfa, 0x22, 0xbf, 0x01, 0x12,
+	0x8d, 0x82, 0x8e, 0x83, 0xf8, 0x02, 0x03, 0x6f,
+	0x09, 0xa3, 0xe7, 0xf0, 0xd8, 0xfa, 0x22, 0x02,
+	0x03, 0x7a, 0xfa, 0xed, 0xf8, 0xe7, 0xf2, 0x08,
+	0x09, 0xda, 0xfa, 0x22, 0x02, 0x03, 0x84, 0xbb,
+	0x01, 0x4d, 0xbf, 0x00, 0x14, 0x89, 0x82, 0x8a,
+	0x83, 0xf9, 0xed, 0xf8, 0x02, 0x03, 0x96, 0x08,
+	0xa3, 0xe0, 0xf6, 0xd9, 0xfa, 0x22, 0x02, 0x03,
+	0xa7, 0xbf, 0x01, 0x22, 0x8d, 0x82, 0x8e, 0x83,
+	0xfb, 0x08, 0xc9, 0xc5, 0x82, 0xc9, 0xca, 0xc5,
+	0x83, 0xca, 0xe0, 0xa3, 0xc9, 0xc5, 0x82, 0xc9,
+	0xca, 0xc5, 0x83, 0xca, 0xf0, 0xa3, 0xdb, 0xea,
+	0xd8, 0xe8, 0x22, 0x02, 0x03, 0xca, 0x8d, 0x82,
+	0x8e, 0x83, 0xf9, 0xed, 0xf8, 0xe0, 0xf2, 0x08,
+	0xa3, 0xd9, 0xfa, 0x22, 0x02, 0x03, 0xd4, 0xbb,
+	0x02, 0x4d, 0xbf, 0x00, 0x12, 0x89, 0x82, 0x8a,
+	0x83, 0xf9, 0xed, 0xf8, 0x02, 0x03, 0xe6, 0x08,
+	0xa3, 0xe4, 0x93, 0xf6, 0xd9, 0xf9, 0x22, 0xbf,
+	0x01, 0x23, 0x8d, 0x82, 0x8e, 0x83, 0xfb, 0x08,
+	0xc9, 0xc5, 0x82, 0xc9, 0xca, 0xc5, 0x83, 0xca,
+	0xe4, 0x93, 0xa3, 0xc9, 0xc5, 0x82, 0xc9, 0xca,
+	0xc5, 0x83, 0xca, 0xf0, 0xa3, 0xdb, 0xe9, 0xd8,
+	0xe7, 0x22, 0x02, 0x04, 0x19, 0x89, 0x82, 0x8a,
+	0x83, 0xf9, 0xed, 0xf8, 0xe4, 0x93, 0xf2, 0x08,
+	0xa3, 0xd9, 0xf9, 0x22, 0x02, 0x04, 0x2a, 0xbf,
+	0x00, 0x0d, 0xfa, 0xed, 0xf8, 0xe3, 0xf6, 0x08,
+	0x09, 0xda, 0xfa, 0x22, 0x02, 0x04, 0x34, 0xbf,
+	0x01, 0x12, 0x8d, 0x82, 0x8e, 0x83, 0xf8, 0x02,
+	0x04, 0x41, 0x09, 0xa3, 0xe3, 0xf0, 0xd8, 0xfa,
+	0x22, 0x02, 0x04, 0x4c, 0xfa, 0xed, 0xf8, 0xe3,
+	0xf2, 0x08, 0x09, 0xda, 0xfa, 0x22, 0x02, 0x04,
+	0x56, 0xe6, 0xfb, 0x08, 0xe6, 0xfa, 0x08, 0xe6,
+	0xf9, 0x04, 0xf6, 0x18, 0x70, 0x01, 0x06, 0x22,
+	0xe6, 0xff, 0x08, 0xe6, 0xfe, 0x08, 0xe6, 0xfd,
+	0x22, 0xef, 0xf0, 0xa3, 0xee, 0xf0, 0xa3, 0xed,
+	0xf0, 0x22, 0xeb, 0xf0, 0xa3, 0xea, 0xf0, 0xa3,
+	0xe9, 0xf0, 0x22, 0xe0, 0xff, 0xa3, 0xe0, 0xfe,
+	0xa3, 0xe0, 0xfd, 0x22, 0xe0, 0xfb, 0xa3, 0xe0,
+	0xfa, 0xa3, 0xe0, 0xf9, 0x22, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x00, 0x61,
+	0x05, 0x68, 0x00, 0x26, 0x05, 0x8f, 0x00, 0x33,
+	0x0a, 0x00, 0x00, 0x61, 0x0a, 0x6c, 0x00, 0x66,
+	0x15, 0x1d, 0x00, 0x61, 0x0c, 0xf0, 0x00, 0x61,
+	0x09, 0xa0, 0x00, 0x61, 0x09, 0xd7, 0x00, 0x61,
+	0x0d, 0xb7, 0x00, 0x61, 0x0b, 0xe8, 0x00, 0x61,
+	0x0a, 0x13, 0x00, 0x61, 0x0a, 0x48, 0x00, 0x61,
+	0x17, 0x15, 0x00, 0x33, 0x17, 0x28, 0x00, 0x34,
+	0x1d, 0xf6, 0x00, 0x43, 0x1e, 0xa1, 0x00, 0x44,
+	0x20, 0x0e, 0x00, 0x44, 0x1f, 0xfc, 0x00, 0x47,
+	0x1e, 0xc8, 0x00, 0x47, 0x1f, 0x6d, 0x00, 0x4d,
+	0x1f, 0xbe, 0x00, 0x4f, 0x1e, 0xea, 0x00, 0x58,
+	0x32, 0x56, 0x00, 0x61, 0x7c, 0xcc, 0x7d, 0xff,
+	0x12, 0x1c, 0xa7, 0x22, 0x90, 0xff, 0xfc, 0xe0,
+	0x20, 0xe7, 0x2d, 0xc2, 0xaf, 0xae, 0x59, 0xaf,
+	0x58, 0x75, 0x5a, 0x20, 0xe5, 0x5a, 0x14, 0xc5,
+	0x5a, 0x60, 0x19, 0xe4, 0xfe, 0x7f, 0x05, 0xee,
+	0x4f, 0xce, 0x24, 0xff, 0xce, 0xcf, 0x34, 0xff,
+	0xcf, 0x60, 0x07, 0xe4, 0x90, 0xff, 0x92, 0xf0,
+	0x80, 0xed, 0x80, 0xe0, 0x8e, 0x59, 0x8f, 0x58,
+	0x22, 0x12, 0x05, 0x01, 0x7d, 0x07, 0x7c, 0xb7,
+	0x12, 0x32, 0x72, 0x7d, 0x0f, 0x7c, 0x6e, 0x12,
+	0x32, 0x8c, 0x78, 0x9d, 0x7a, 0x06, 0xe4, 0xf6,
+	0x08, 0xda, 0xfc, 0x7a, 0x06, 0x12, 0x05, 0xc4,
+	0x7c, 0x03, 0x12, 0x0e, 0x4c, 0x12, 0x21, 0x4a,
+	0xe4, 0xfe, 0xff, 0x7c, 0x0f, 0x12, 0x31, 0xfb,
+	0xd2, 0xa8, 0x22, 0x12, 0x30, 0xe6, 0xe4, 0x90,
+	0xfc, 0x38, 0xf0, 0x90, 0xff, 0xf0, 0xe0, 0x30,
+	0xe4, 0x08, 0x74, 0x01, 0x90, 0xfc, 0x39, 0xf0,
+	0x80, 0x05, 0xe4, 0x90, 0xfc, 0x39, 0xf0, 0x7d,
+	0x0a, 0x7c, 0x00, 0x12, 0x25, 0x26, 0x12, 0x31,
+	0x69, 0x22, 0x12, 0x30, 0xe6, 0x90, 0xfc, 0x39,
+	0xe0, 0x14, 0x70, 0x0e, 0x90, 0xff, 0xf0, 0xe0,
+	0x44, 0x10, 0xf0, 0x7c, 0x00, 0x12, 0x25, 0xbf,
+	0x80, 0x19, 0x90, 0xfc, 0x39, 0xe0, 0x70, 0x0e,
+	0x90, 0xff, 0xf0, 0xe0, 0x54, 0xef, 0xf0, 0x7c,
+	0x00, 0x12, 0x25, 0xbf, 0x80, 0x05, 0x7c, 0x17,
+	0x12, 0x25, 0xbf, 0x12, 0x31, 0x69, 0x22, 0x90,
+	0xff, 0xf0, 0xe0, 0x54, 0xab, 0xf0, 0x90, 0xff,
+	0xf0, 0xe0, 0x44, 0x20, 0xf0, 0x22, 0x8c, 0x37,
+	0x8d, 0x36, 0x78, 0x82, 0xed, 0xf6, 0x08, 0xec,
+	0xf6, 0xed, 0xfe, 0xec, 0xfd, 0x7f, 0x01, 0x90,
+	0x00, 0x05, 0x12, 0x01, 0xec, 0x78, 0x80, 0xf6,
+	0x78, 0x82, 0xe6, 0xfd, 0x08, 0xe6, 0xfc, 0xed,
+	0xfe, 0xec, 0xfd, 0x7f, 0x01, 0x90, 0x00, 0x04,
+	0x12, 0x01, 0xec, 0x54, 0x0f, 0xfc, 0x7d, 0x80,
+	0x12, 0x17, 0x46, 0x78, 0x80, 0xe6, 0x70, 0x0d,
+	0xad, 0x3a, 0xae, 0x39, 0xaf, 0x38, 0xe4, 0x12,
+	0x03, 0x0f, 0x7c, 0x08, 0x22, 0x90, 0xff, 0xf0,
+	0xe0, 0x54, 0xfe, 0xf0, 0x90, 0xff, 0xf0, 0xe0,
+	0x54, 0xfd, 0xf0, 0x80, 0x1e, 0x78, 0x82, 0xe6,
+	0xfd, 0x08, 0xe6, 0xfc, 0xed, 0xfe, 0xec, 0xfd,
+	0x7f, 0x01, 0x90, 0x00, 0x08, 0x12, 0x02, 0x0e,
+	0x25, 0xe0, 0x44, 0x01, 0x90, 0xff, 0xf3, 0xf0,
+	0x02, 0x06, 0xd0, 0x78, 0x82, 0xe6, 0xfd, 0x08,
+	0xe6, 0xfc, 0xed, 0xfe, 0xec, 0xfd, 0x7f, 0x01,
+	0x90, 0x00, 0x06, 0x12, 0x02, 0x0e, 0x54, 0xfe,
+	0x90, 0xff, 0xf3, 0xf0, 0x80, 0x2b, 0x78, 0x82,
+	0xe6, 0xfd, 0x08, 0xe6, 0xfc, 0xed, 0xfe, 0xec,
+	0xfd, 0x7f, 0x01, 0x90, 0x00, 0x08, 0x12, 0x02,
+	0x0e, 0xfa, 0xeb, 0x90, 0xff, 0xf1, 0xf0, 0x12,
+	0x08, 0xbf, 0x40, 0x0d, 0xad, 0x3a, 0xae, 0x39,
+	0xaf, 0x38, 0xe4, 0x12, 0x03, 0x0f, 0x7c, 0x18,
+	0x22, 0x78, 0x82, 0xe6, 0xfd, 0x08, 0xe6, 0xfc,
+	0xed, 0xfe, 0xec, 0xfd, 0x7f, 0x01, 0x90, 0x00,
+	0x08, 0x12, 0x02, 0x0e, 0x90, 0xff, 0xf1, 0xf0,
+	0x12, 0x08, 0xbf, 0x40, 0x0d, 0xad, 0x3a, 0xae,
+	0x39, 0xaf, 0x38, 0xe4, 0x12, 0x03, 0x0f, 0x7c,
+	0x18, 0x22, 0x78, 0x82, 0xe6, 0xfd, 0x08, 0xe6,
+	0xfc, 0xed, 0xfe, 0xec, 0xfd, 0x7f, 0x01, 0x90,
+	0x00, 0x06, 0x12, 0x02, 0x0e, 0x44, 0x01, 0x90,
+	0xff, 0xf3, 0xf0, 0x78, 0x83, 0xe6, 0x24, 0x03,
+	0xf6, 0x18, 0xe6, 0x34, 0x00, 0xf6, 0x78, 0x80,
+	0xe6, 0x24, 0xfe, 0x50, 0x09, 0x90, 0xff, 0xf0,
+	0xe0, 0x54, 0xfd, 0xf0, 0x80, 0x07, 0x90, 0xff,
+	0xf0, 0xe0, 0x44, 0x02, 0xf0, 0xe4, 0x90, 0xff,
+	0xf1, 0xf0, 0x78, 0x81, 0x76, 0x00, 0x78, 0x80,
+	0xe6, 0x24, 0xff, 0xfc, 0xe4, 0x34, 0xff, 0xfd,
+	0x78, 0x81, 0xe6, 0x7f, 0x00, 0xfe, 0xec, 0xd3,
+	0x9e, 0xef, 0x64, 0x80, 0xcd, 0x64, 0x80, 0x9d,
+	0x40, 0x2f, 0x12, 0x08, 0xa4, 0x40, 0x0f, 0x78,
+	0x81, 0xe6, 0xad, 0x3a, 0xae, 0x39, 0xaf, 0x38,
+	0x12, 0x03, 0x0f, 0x7c, 0x18, 0x22, 0x90, 0xff,
+	0xf2, 0xe0, 0xfc, 0x78, 0x82, 0x86, 0x83, 0x08,
+	0x86, 0x82, 0xec, 0xf0, 0x78, 0x81, 0x06, 0xa3,
+	0x78, 0x82, 0xa6, 0x83, 0x08, 0xa6, 0x82, 0x80,
+	0xb5, 0x12, 0x08, 0xa4, 0x40, 0x0f, 0x78, 0x81,
+	0xe6, 0xad, 0x3a, 0xae, 0x39, 0xaf, 0x38, 0x12,
+	0x03, 0x0f, 0x7c, 0x18, 0x22, 0x90, 0xff, 0xf2,
+	0xe0, 0xfc, 0x78, 0x82, 0x86, 0x83, 0x08, 0x86,
+	0x82, 0xec, 0xf0, 0x78, 0x80, 0xe6, 0xad, 0x3a,
+	0xae, 0x39, 0xaf, 0x38, 0x12, 0x03, 0x0f, 0x7c,
+	0x00, 0x22, 0x8c, 0x37, 0x8d, 0x36, 0x78, 0x82,
+	0xed, 0xf6, 0x08, 0xec, 0xf6, 0xed, 0xfe, 0xec,
+	0xfd, 0x7f, 0x01, 0x90, 0x00, 0x05, 0x12, 0x01,
+	0xec, 0x78, 0x81, 0xf6, 0x78, 0x82, 0xe6, 0xfd,
+	0x08, 0xe6, 0xfc, 0xed, 0xfe, 0xec, 0xfd, 0x7f,
+	0x01, 0x90, 0x00, 0x04, 0x12, 0x01, 0xec, 0x54,
+	0x0f, 0xfc, 0x7d, 0x81, 0x12, 0x17, 0x46, 0x78,
+	0x81, 0xe6, 0x70, 0x03, 0x7c, 0x08, 0x22, 0x90,
+	0xff, 0xf0, 0xe0, 0x54, 0xfe, 0xf0, 0x90, 0xff,
+	0xf0, 0xe0, 0x54, 0xfd, 0xf0, 0x80, 0x1b, 0x78,
+	0x82, 0xe6, 0xfd, 0x08, 0xe6, 0xfc, 0xed, 0xfe,
+	0xec, 0xfd, 0x7f, 0x01, 0x90, 0x00, 0x08, 0x12,
+	0x02, 0x0e, 0x25, 0xe0, 0x90, 0xff, 0xf3, 0xf0,
+	0x80, 0x5b, 0x78, 0x82, 0xe6, 0xfd, 0x08, 0xe6,
+	0xfc, 0xed, 0xfe, 0xec, 0xfd, 0x7f, 0x01, 0x90,
+	0x00, 0x06, 0x12, 0x02, 0x0e, 0x54, 0xfe, 0x90,
+	0xff, 0xf3, 0xf0, 0x80, 0x21, 0x78, 0x82, 0xe6,
+	0xfd, 0x08, 0xe6, 0xfc, 0xed, 0xfe, 0xec, 0xfd,
+	0x7f, 0x01, 0x90, 0x00, 0x08, 0x12, 0x02, 0x0e,
+	0xfa, 0xeb, 0x90, 0xff, 0xf1, 0xf0, 0x12, 0x08,
+	0xbf, 0x40, 0x03, 0x7c, 0x18, 0x22, 0x78, 0x82,
+	0xe6, 0xfd, 0x08, 0xe6, 0xfc, 0xed, 0xfe, 0xec,
+	0xfd, 0x7f, 0x01, 0x90, 0x00, 0x08, 0x12, 0x02,
+	0x0e, 0x90, 0xff, 0xf1, 0xf0, 0x12, 0x08, 0xbf,
+	0x40, 0x03, 0x7c, 0x18, 0x22, 0x78, 0x83, 0xe6,
+	0x24, 0x0a, 0xf6, 0x18, 0xe6, 0x34, 0x00, 0xf6,
+	0x78, 0x80, 0x76, 0x00, 0x78, 0x81, 0xe6, 0x24,
+	0xff, 0xfc, 0xe4, 0x34, 0xff, 0xfd, 0x78, 0x80,
+	0xe6, 0x7f, 0x00, 0xfe, 0xec, 0xd3, 0x9e, 0xef,
+	0x64, 0x80, 0xcd, 0x64, 0x80, 0x9d, 0x40, 0x21,
+	0x78, 0x82, 0x86, 0x83, 0x08, 0x86, 0x82, 0xe0,
+	0x90, 0xff, 0xf1, 0xf0, 0x12, 0x08, 0xbf, 0x40,
+	0x03, 0x7c, 0x18, 0x22, 0x78, 0x80, 0x06, 0x78,
+	0x83, 0x06, 0xe6, 0x18, 0x70, 0x01, 0x06, 0x80,
+	0xc3, 0x90, 0xff, 0xf0, 0xe0, 0x44, 0x01, 0xf0,
+	0x78, 0x82, 0x86, 0x83, 0x08, 0x86, 0x82, 0xe0,
+	0x90, 0xff, 0xf1, 0xf0, 0x12, 0x08, 0xbf, 0x40,
+	0x03, 0x7c, 0x18, 0x22, 0x7c, 0x00, 0x22, 0x90,
+	0xff, 0xf0, 0xe0, 0x20, 0xe7, 0x12, 0x90, 0xff,
+	0xf0, 0xe0, 0x30, 0xe5, 0x09, 0x90, 0xff, 0xf0,
+	0xe0, 0x44, 0x20, 0xf0, 0xc3, 0x22, 0x80, 0xe7,
+	0xd3, 0x22, 0x90, 0xff, 0xf0, 0xe0, 0x20, 0xe3,
+	0x12, 0x90, 0xff, 0xf0, 0xe0, 0x30, 0xe5, 0x09,
+	0x90, 0xff, 0xf0, 0xe0, 0x44, 0x20, 0xf0, 0xc3,
+	0x22, 0x80, 0xe7, 0xd3, 0x22, 0x8c, 0x42, 0x8d,
+	0x41, 0x7c, 0x00, 0xed, 0x54, 0xf0, 0xfd, 0xec,
+	0x70, 0x03, 0xed, 0x64, 0x30, 0x70, 0x05, 0x75,
+	0x3e, 0x03, 0x80, 0x03, 0x75, 0x3e, 0x04, 0xac,
+	0x3e, 0x12, 0x0f, 0x69, 0x75, 0x83, 0x00, 0x85,
+	0x83, 0x40, 0xe5, 0x41, 0x54, 0x0f, 0xf5, 0x3f,
+	0xe5, 0x40, 0x70, 0x04, 0xe5, 0x3f, 0x64, 0x03,
+	0x70, 0x35, 0xe5, 0x3e, 0x24, 0xfd, 0x75, 0xf0,
+	0x0a, 0xa4, 0x24, 0x02, 0xf5, 0x82, 0xe4, 0x34,
+	0xfc, 0xf5, 0x83, 0xe0, 0x30, 0xe6, 0x05, 0x12,
+	0x10, 0x4b, 0x80, 0x19, 0xe5, 0x3e, 0x24, 0x9d,
+	0xf8, 0xc6, 0x54, 0xfb, 0xf6, 0x78, 0xa9, 0xe6,
+	0x24, 0x05, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00,
+	0xf5, 0x83, 0x74, 0x0f, 0xf0, 0x80, 0x59, 0xe5,
+	0x40, 0x70, 0x04, 0xe5, 0x3f, 0x64, 0x04, 0x70,
+	0x48, 0xe5, 0x3e, 0x24, 0xfd, 0x75, 0xf0, 0x0a,
+	0xa4, 0x24, 0x02, 0xf5, 0x82, 0xe4, 0x34, 0xfc,
+	0xf5, 0x83, 0xe0, 0x30, 0xe5, 0x07, 0xac, 0x42,
+	0xad, 0x41, 0x12, 0x1c, 0x3c, 0xe5, 0x42, 0x30,
+	0xe2, 0x15, 0x78, 0xad, 0xe6, 0x30, 0xe0, 0x0f,
+	0x78, 0xad, 0xe6, 0x30, 0xe1, 0x09, 0xe4, 0xff,
+	0x04, 0xfe, 0x7c, 0x04, 0x12, 0x31, 0xfb, 0x78,
+	0xa9, 0xe6, 0x24, 0x06, 0xf5, 0x82, 0x18, 0xe6,
+	0x34, 0x00, 0xf5, 0x83, 0x74, 0x0f, 0xf0, 0x80,
+	0x07, 0xe4, 0xfc, 0x7d, 0xee, 0x12, 0x1c, 0x3c,
+	0xc2, 0x03, 0x22, 0x12, 0x30, 0xe6, 0x12, 0x0f,
+	0x69, 0x78, 0xa9, 0xe6, 0x24, 0x06, 0xf5, 0x82,
+	0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x90,
+	0xfc, 0x38, 0xf0, 0x78, 0xa9, 0xe6, 0x24, 0x05,
+	0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83,
+	0xe0, 0x90, 0xfc, 0x39, 0xf0, 0xc2, 0x03, 0x7d,
+	0x02, 0x7c, 0x00, 0x12, 0x25, 0x26, 0x12, 0x31,
+	0x69, 0x22, 0x12, 0x30, 0xe6, 0x78, 0x95, 0xec,
+	0xf6, 0xec, 0x24, 0x9d, 0xf8, 0xe6, 0x30, 0xe1,
+	0x07, 0x7c, 0x13, 0x12, 0x25, 0xbf, 0x80, 0x0f,
+	0x90, 0xfc, 0x39, 0xe0, 0xfd, 0x78, 0x95, 0xe6,
+	0xfc, 0x12, 0x13, 0xc8, 0x12, 0x25, 0xbf, 0x12,
+	0x31, 0x69, 0x22, 0x12, 0x30, 0xe6, 0x78, 0x95,
+	0xec, 0xf6, 0x7d, 0x00, 0x12, 0x0f, 0x09, 0x12,
+	0x25, 0xbf, 0x12, 0x31, 0x69, 0x22, 0x12, 0x30,
+	0xe6, 0x78, 0x95, 0xec, 0xf6, 0xec, 0x24, 0x9d,
+	0xf8, 0xe6, 0x30, 0xe2, 0x07, 0x7c, 0x13, 0x12,
+	0x25, 0xbf, 0x80, 0x1b, 0x78, 0x95, 0xe6, 0x24,
+	0x9d, 0xf8, 0xe6, 0x20, 0xe1, 0x07, 0x7c, 0x12,
+	0x12, 0x25, 0xbf, 0x80, 0x0a, 0x78, 0x95, 0xe6,
+	0xfc, 0x12, 0x13, 0xec, 0x12, 0x25, 0xbf, 0x12,
+	0x31, 0x69, 0x22, 0x12, 0x30, 0xe6, 0x78, 0x95,
+	0xec, 0xf6, 0xec, 0x24, 0x9d, 0xf8, 0xe6, 0x20,
+	0xe2, 0x07, 0x7c, 0x11, 0x12, 0x25, 0xbf, 0x80,
+	0x0a, 0x78, 0x95, 0xe6, 0xfc, 0x12, 0x14, 0xed,
+	0x12, 0x25, 0xbf, 0x12, 0x31, 0x69, 0x22, 0x12,
+	0x30, 0xe6, 0x78, 0x95, 0xec, 0xf6, 0x12, 0x0f,
+	0x69, 0x78, 0xa9, 0xe6, 0x24, 0x09, 0xf5, 0x82,
+	0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x90,
+	0xfc, 0x3f, 0xf0, 0x78, 0xa9, 0xe6, 0x24, 0x0a,
+	0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83,
+	0xe0, 0x90, 0xfc, 0x40, 0xf0, 0x78, 0xa9, 0xe6,
+	0x24, 0x03, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00,
+	0xf5, 0x83, 0xe0, 0xfc, 0x78, 0xa9, 0xe6, 0x24,
+	0x04, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5,
+	0x83, 0xe0, 0xf5, 0x62, 0x78, 0xa9, 0xe6, 0x24,
+	0x02, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5,
+	0x83, 0xe0, 0xf5, 0x63, 0x8c, 0x61, 0xe4, 0xec,
+	0x33, 0x33, 0x54, 0x01, 0x78, 0x95, 0xf6, 0x60,
+	0x08, 0xe5, 0x62, 0x30, 0xe1, 0x03, 0x78, 0x95,
+	0x06, 0x78, 0x95, 0xe6, 0x90, 0xfc, 0x41, 0xf0,
+	0x78, 0xa7, 0xe6, 0x24, 0x02, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0xfd, 0xa3,
+	0xe0, 0x54, 0x0c, 0xfc, 0xed, 0x54, 0xe6, 0x8c,
+	0x65, 0xf5, 0x64, 0xe5, 0x61, 0x30, 0xe5, 0x03,
+	0x43, 0x65, 0x01, 0xe5, 0x62, 0x20, 0xe5, 0x0e,
+	0xe5, 0x61, 0x54, 0x7f, 0x70, 0x08, 0xe5, 0x61,
+	0x20, 0xe7, 0x03, 0x43, 0x65, 0x02, 0xe5, 0x61,
+	0x30, 0xe3, 0x03, 0x43, 0x65, 0x10, 0xe5, 0x61,
+	0x30, 0xe2, 0x03, 0x43, 0x65, 0x20, 0xe5, 0x61,
+	0x54, 0x03, 0x60, 0x03, 0x43, 0x65, 0x40, 0xe5,
+	0x61, 0x30, 0xe1, 0x03, 0x43, 0x65, 0x80, 0xe5,
+	0x61, 0x30, 0xe4, 0x03, 0x43, 0x64, 0x01, 0xe5,
+	0x61, 0x30, 0xe6, 0x03, 0x43, 0x64, 0x08, 0xe5,
+	0x62, 0x20, 0xe4, 0x0e, 0xe5, 0x61, 0x54, 0x7f,
+	0x70, 0x08, 0xe5, 0x61, 0x20, 0xe7, 0x03, 0x43,
+	0x64, 0x10, 0x53, 0x65, 0xfb, 0x53, 0x64, 0x79,
+	0xad, 0x64, 0xe5, 0x65, 0x90, 0xfc, 0x3a, 0xcd,
+	0xf0, 0xa3, 0xcd, 0xf0, 0xe5, 0x63, 0x30, 0xe3,
+	0x0d, 0xe5, 0x63, 0x54, 0x30, 0xc4, 0x54, 0x0f,
+	0x90, 0xfc, 0x3d, 0xf0, 0x80, 0x05, 0xe4, 0x90,
+	0xfc, 0x3d, 0xf0, 0xe5, 0x63, 0x54, 0x03, 0x90,
+	0xfc, 0x3c, 0xf0, 0xe5, 0x63, 0x54, 0x04, 0xc3,
+	0x13, 0x90, 0xfc, 0x3e, 0xf0, 0x90, 0xfc, 0x3c,
+	0xe0, 0x70, 0x0e, 0x7d, 0x35, 0x7e, 0xfc, 0x7f,
+	0x01, 0x74, 0x01, 0x90, 0x00, 0x09, 0x12, 0x01,
+	0x42, 0x78, 0xa9, 0xe6, 0x24, 0x08, 0xf5, 0x82,
+	0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x7c,
+	0x00, 0xfd, 0x78, 0xa9, 0xe6, 0x24, 0x07, 0xf5,
+	0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0,
+	0x7f, 0x00, 0x4c, 0xfe, 0xef, 0x4d, 0x90, 0xfc,
+	0x38, 0xf0, 0xa3, 0xce, 0xf0, 0xce, 0xc2, 0x03,
+	0x7d, 0x0a, 0x7c, 0x00, 0x12, 0x25, 0x26, 0x12,
+	0x31, 0x69, 0x22, 0x12, 0x30, 0xe6, 0x78, 0x95,
+	0xec, 0xf6, 0x78, 0x9a, 0x76, 0x01, 0x08, 0x76,
+	0xfc, 0x08, 0x76, 0x38, 0x78, 0x97, 0x76, 0x0c,
+	0x78, 0x9a, 0x12, 0x04, 0x65, 0x12, 0x02, 0x14,
+	0x78, 0x98, 0xcb, 0xf6, 0xcb, 0x08, 0xf6, 0x7f,
+	0x00, 0xef, 0x24, 0xea, 0x40, 0x1f, 0xe4, 0xef,
+	0x25, 0xe0, 0x90, 0x35, 0x2c, 0xfd, 0x93, 0xcd,
+	0x04, 0x93, 0x78, 0x99, 0x66, 0x70, 0x03, 0xed,
+	0x18, 0x66, 0x70, 0x06, 0x78, 0x97, 0x76, 0x00,
+	0x80, 0x03, 0x0f, 0x80, 0xdc, 0x78, 0x96, 0xef,
+	0xf6, 0x78, 0x9a, 0x12, 0x04, 0x65, 0x90, 0x00,
+	0x02, 0x12, 0x02, 0x0e, 0x78, 0x98, 0xcb, 0xf6,
+	0xcb, 0x08, 0xf6, 0x54, 0x04, 0xcb, 0x54, 0x86,
+	0x4b, 0x60, 0x04, 0x78, 0x97, 0x76, 0x0b, 0x78,
+	0x99, 0xe6, 0x30, 0xe3, 0x13, 0x78, 0x9a, 0x12,
+	0x04, 0x65, 0x90, 0x00, 0x05, 0x12, 0x01, 0xec,
+	0x24, 0xfb, 0x50, 0x04, 0x78, 0x97, 0x76, 0x0d,
+	0x78, 0x99, 0xe6, 0x54, 0xc0, 0x7d, 0x00, 0x64,
+	0xc0, 0x4d, 0x70, 0x04, 0x78, 0x97, 0x76, 0x0b,
+	0x78, 0x9a, 0x12, 0x04, 0x65, 0x90, 0x00, 0x04,
+	0x12, 0x01, 0xec, 0x24, 0xfc, 0x50, 0x04, 0x78,
+	0x97, 0x76, 0x0f, 0x78, 0x9a, 0x12, 0x04, 0x65,
+	0x90, 0x00, 0x06, 0x12, 0x01, 0xec, 0x24, 0xfd,
+	0x50, 0x04, 0x78, 0x97, 0x76, 0x0e, 0x78, 0x9a,
+	0x12, 0x04, 0x65, 0x90, 0x00, 0x09, 0x12, 0x01,
+	0xec, 0x24, 0xfd, 0x50, 0x04, 0x78, 0x97, 0x76,
+	0x0a, 0x78, 0x97, 0xe6, 0x70, 0x2a, 0x78, 0x95,
+	0xe6, 0xfc, 0x12, 0x0f, 0x69, 0x78, 0x9a, 0x12,
+	0x04, 0x65, 0x78, 0xa7, 0xe6, 0xf9, 0x78, 0xa6,
+	0xe6, 0xfa, 0x7b, 0x01, 0x74, 0x0a, 0x78, 0x00,
+	0x12, 0x03, 0x3f, 0xc2, 0x03, 0x78, 0x95, 0xe6,
+	0xfc, 0x12, 0x11, 0x07, 0x78, 0x97, 0xec, 0xf6,
+	0x78, 0x97, 0xe6, 0xfc, 0x12, 0x25, 0xbf, 0x12,
+	0x31, 0x69, 0x22, 0x12, 0x30, 0xe6, 0x78, 0x95,
+	0xec, 0xf6, 0x12, 0x0f, 0x69, 0x78, 0x95, 0xe6,
+	0x24, 0xfd, 0x75, 0xf0, 0x0a, 0xa4, 0x24, 0x14,
+	0xf5, 0x82, 0xe4, 0x34, 0xfc, 0xf5, 0x83, 0xac,
+	0x82, 0xad, 0x83, 0x78, 0xa6, 0x86, 0x83, 0x08,
+	0x86, 0x82, 0xec, 0xf9, 0xed, 0xfa, 0x7b, 0x0a,
+	0x78, 0x01, 0x12, 0x03, 0xa7, 0xc2, 0x03, 0x78,
+	0x95, 0xe6, 0xfc, 0x12, 0x11, 0x07, 0x12, 0x31,
+	0x69, 0x22, 0x8d, 0x2b, 0x8c, 0x2a, 0xed, 0x60,
+	0x40, 0x75, 0x27, 0x01, 0x75, 0x29, 0x48, 0x75,
+	0x28, 0xff, 0xe5, 0x2a, 0x24, 0xfd, 0xfc, 0xe4,
+	0x34, 0xff, 0xfd, 0xec, 0x7c, 0x03, 0x25, 0xe0,
+	0xcd, 0x33, 0xcd, 0xdc, 0xf9, 0xfc, 0xe5, 0x29,
+	0x2c, 0xf5, 0x29, 0xe5, 0x28, 0x3d, 0xf5, 0x28,
+	0xad, 0x29, 0xae, 0x28, 0xaf, 0x27, 0x74, 0x80,
+	0x90, 0x00, 0x06, 0x12, 0x03, 0x17, 0x74, 0x80,
+	0x90, 0x00, 0x02, 0x12, 0x03, 0x17, 0x12, 0x0f,
+	0xb7, 0xe5, 0x2b, 0x14, 0x60, 0x3b, 0x75, 0x27,
+	0x01, 0x75, 0x29, 0x08, 0x75, 0x28, 0xff, 0xe5,
+	0x2a, 0x24, 0xfd, 0xfc, 0xe4, 0x34, 0xff, 0xfd,
+	0xec, 0x7c, 0x03, 0x25, 0xe0, 0xcd, 0x33, 0xcd,
+	0xdc, 0xf9, 0xfc, 0xe5, 0x29, 0x2c, 0xf5, 0x29,
+	0xe5, 0x28, 0x3d, 0xf5, 0x28, 0xad, 0x29, 0xae,
+	0x28, 0xaf, 0x27, 0xe4, 0x90, 0x00, 0x06, 0x12,
+	0x03, 0x17, 0xe4, 0x90, 0x00, 0x02, 0x12, 0x03,
+	0x17, 0x22, 0x12, 0x30, 0xe6, 0x78, 0x95, 0xec,
+	0xf6, 0xec, 0x24, 0x9d, 0xf8, 0xe6, 0x30, 0xe2,
+	0x09, 0x78, 0x95, 0xe6, 0xfc, 0x12, 0x14, 0xed,
+	0xd2, 0x00, 0x78, 0x95, 0xe6, 0xfc, 0x12, 0x0f,
+	0x69, 0x78, 0x96, 0x76, 0x00, 0x90, 0xfc, 0x39,
+	0xe0, 0x30, 0xe7, 0x04, 0x78, 0x96, 0x76, 0x01,
+	0x78, 0x96, 0xe6, 0xfd, 0x78, 0x95, 0xe6, 0xfc,
+	0x12, 0x0d, 0x2f, 0xc2, 0x03, 0x30, 0x00, 0x07,
+	0x78, 0x95, 0xe6, 0xfc, 0x12, 0x13, 0xec, 0x7c,
+	0x00, 0x12, 0x25, 0xbf, 0x12, 0x31, 0x69, 0x22,
+	0x78, 0xa9, 0xe6, 0x24, 0x04, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x44, 0x01,
+	0xf0, 0x78, 0xa9, 0xe6, 0x24, 0x04, 0xf5, 0x82,
+	0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x30,
+	0xe0, 0x02, 0x80, 0xed, 0x78, 0xa9, 0xe6, 0x24,
+	0x0b, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5,
+	0x83, 0xe0, 0x54, 0xf8, 0xf0, 0x78, 0xa9, 0xe6,
+	0x24, 0x02, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00,
+	0xf5, 0x83, 0xe0, 0x44, 0x80, 0xf0, 0x22, 0xc2,
+	0x03, 0x8c, 0x58, 0x12, 0x0f, 0x69, 0x78, 0xa6,
+	0x86, 0x83, 0x08, 0x86, 0x82, 0x79, 0x5d, 0x7a,
+	0x35, 0x7b, 0x0a, 0x78, 0x01, 0x12, 0x03, 0xf5,
+	0x12, 0x0e, 0x05, 0xac, 0x58, 0x7d, 0x02, 0x12,
+	0x0d, 0x2f, 0xc2, 0x03, 0xac, 0x58, 0x12, 0x11,
+	0x07, 0x22, 0x8d, 0x53, 0x8e, 0x52, 0x8f, 0x51,
+	0x8c, 0x50, 0x12, 0x0f, 0x69, 0x75, 0x4f, 0x00,
+	0x78, 0xa9, 0xe6, 0x24, 0x05, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x20, 0xe4,
+	0x1f, 0xe5, 0x4f, 0x24, 0xf6, 0x40, 0x19, 0x05,
+	0x4f, 0xc2, 0x03, 0x7c, 0x18, 0x12, 0x32, 0xa9,
+	0x90, 0xff, 0x93, 0xe0, 0x44, 0x01, 0xf0, 0xb2,
+	0xb3, 0xac, 0x50, 0x12, 0x0f, 0x69, 0x80, 0xd0,
+	0x78, 0xa9, 0xe6, 0x24, 0x05, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x20, 0xe4,
+	0x05, 0xc2, 0x03, 0x7c, 0x02, 0x22, 0x78, 0xa9,
+	0xe6, 0x24, 0x05, 0xf5, 0x82, 0x18, 0xe6, 0x34,
+	0x00, 0xf5, 0x83, 0xe0, 0x54, 0x0f, 0x60, 0x16,
+	0x78, 0xa9, 0xe6, 0x24, 0x05, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x54, 0x0f,
+	0xf0, 0xc2, 0x03, 0x7c, 0x01, 0x22, 0x78, 0xa8,
+	0x86, 0x83, 0x08, 0x86, 0x82, 0xe0, 0xad, 0x53,
+	0xae, 0x52, 0xaf, 0x51, 0x12, 0x03, 0x0f, 0xc2,
+	0x03, 0x7c, 0x00, 0x22, 0x8d, 0x31, 0x8c, 0x30,
+	0x12, 0x14, 0xed, 0xe5, 0x31, 0x60, 0x0f, 0xe5,
+	0x30, 0xb4, 0x03, 0x0a, 0x7c, 0x01, 0x12, 0x24,
+	0xee, 0x7c, 0x81, 0x12, 0x24, 0xee, 0xac, 0x30,
+	0x12, 0x0f, 0x69, 0xe5, 0x31, 0x60, 0x1a, 0x78,
+	0xaa, 0x86, 0x83, 0x08, 0x86, 0x82, 0xe0, 0x54,
+	0xe7, 0xf0, 0xa3, 0xa3, 0xa3, 0xa3, 0xe0, 0x54,
+	0xe7, 0xf0, 0xac, 0x30, 0x7d, 0x02, 0x12, 0x0d,
+	0x2f, 0x78, 0xa6, 0x86, 0x83, 0x08, 0x86, 0x82,
+	0x79, 0x67, 0x7a, 0x35, 0x7b, 0x0a, 0x78, 0x01,
+	0x12, 0x03, 0xf5, 0xc2, 0x03, 0xe5, 0x30, 0x24,
+	0x9d, 0xf8, 0xc6, 0x54, 0xfd, 0xf6, 0xac, 0x30,
+	0x12, 0x11, 0x07, 0x22, 0x8c, 0x26, 0x30, 0x03,
+	0x05, 0x12, 0x32, 0x48, 0x80, 0xf8, 0x7c, 0x0a,
+	0x12, 0x31, 0x5b, 0xd2, 0x03, 0xe5, 0x26, 0x24,
+	0xfd, 0x78, 0xa3, 0xf6, 0x70, 0x07, 0x78, 0xaa,
+	0x76, 0xff, 0x08, 0x76, 0xe0, 0x78, 0xa3, 0xe6,
+	0x75, 0xf0, 0x10, 0xa4, 0xad, 0xf0, 0xfc, 0x24,
+	0xa0, 0x78, 0xa9, 0xf6, 0xed, 0x34, 0xff, 0x18,
+	0xf6, 0x78, 0xa3, 0xe6, 0x75, 0xf0, 0x0a, 0xa4,
+	0x24, 0x00, 0xfc, 0xe4, 0x34, 0xfc, 0xfd, 0x78,
+	0xa6, 0xed, 0xf6, 0x08, 0xec, 0xf6, 0x12, 0x31,
+	0xf4, 0x22, 0x78, 0xa9, 0xe6, 0x24, 0x02, 0xf5,
+	0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0,
+	0x30, 0xe7, 0x22, 0x78, 0xa9, 0xe6, 0x24, 0x02,
+	0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83,
+	0xe0, 0x54, 0x7f, 0xf0, 0x78, 0xa9, 0xe6, 0x24,
+	0x02, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5,
+	0x83, 0xe0, 0x44, 0x80, 0xf0, 0x22, 0x78, 0xaa,
+	0x86, 0x83, 0x08, 0x86, 0x82, 0xe0, 0x54, 0x7f,
+	0xf0, 0xad, 0x83, 0xe5, 0x82, 0x24, 0x04, 0xfc,
+	0xe4, 0x3d, 0x8c, 0x82, 0xf5, 0x83, 0xe0, 0x54,
+	0x7f, 0xf0, 0x78, 0xa9, 0xe6, 0x24, 0x0b, 0xf5,
+	0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0,
+	0x54, 0xf8, 0xf0, 0x78, 0xab, 0xe6, 0x24, 0x01,
+	0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83,
+	0xe0, 0x44, 0x03, 0xf0, 0x78, 0xab, 0xe6, 0x24,
+	0x05, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5,
+	0x83, 0xe0, 0x44, 0x03, 0xf0, 0x78, 0xa9, 0xe6,
+	0x24, 0x05, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00,
+	0xf5, 0x83, 0x74, 0x0f, 0xf0, 0x22, 0x78, 0xaa,
+	0x86, 0x83, 0x08, 0x86, 0x82, 0xe0, 0x54, 0x3f,
+	0xf0, 0xad, 0x83, 0xe5, 0x82, 0x24, 0x04, 0xfc,
+	0xe4, 0x3d, 0x8c, 0x82, 0xf5, 0x83, 0xe0, 0x54,
+	0x3f, 0xf0, 0x78, 0xa3, 0xe6, 0x24, 0xa4, 0xf8,
+	0xe6, 0xfc, 0x78, 0xab, 0xe6, 0x24, 0x01, 0xf5,
+	0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xec,
+	0xf0, 0x78, 0xa3, 0xe6, 0x24, 0xa4, 0xf8, 0xe6,
+	0xfc, 0x78, 0xab, 0xe6, 0x24, 0x05, 0xf5, 0x82,
+	0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xec, 0xf0,
+	0x78, 0xa9, 0xe6, 0x24, 0x0b, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x54, 0xfb,
+	0x44, 0x02, 0xf5, 0x26, 0x78, 0xa7, 0xe6, 0x24,
+	0x02, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5,
+	0x83, 0xe0, 0x30, 0xe5, 0x03, 0x43, 0x26, 0x01,
+	0x78, 0xa9, 0xe6, 0x24, 0x05, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x30, 0xe0,
+	0x03, 0x12, 0x0f, 0xb7, 0xe5, 0x26, 0xfc, 0x78,
+	0xa9, 0xe6, 0x24, 0x0b, 0xf5, 0x82, 0x18, 0xe6,
+	0x34, 0x00, 0xf5, 0x83, 0xec, 0xf0, 0x78, 0xa9,
+	0xe6, 0x24, 0x05, 0xf5, 0x82, 0x18, 0xe6, 0x34,
+	0x00, 0xf5, 0x83, 0x74, 0x0f, 0xf0, 0x78, 0xaa,
+	0x86, 0x83, 0x08, 0x86, 0x82, 0xe0, 0x44, 0x80,
+	0xf0, 0xa3, 0xa3, 0xa3, 0xa3, 0xe0, 0x44, 0x80,
+	0xf0, 0x22, 0x8c, 0x2a, 0x12, 0x0f, 0x69, 0x78,
+	0xa7, 0xe6, 0x24, 0x08, 0xf5, 0x82, 0x18, 0xe6,
+	0x34, 0x00, 0xf5, 0x83, 0xe0, 0xfc, 0x78, 0xa9,
+	0xe6, 0x24, 0x0a, 0xf5, 0x82, 0x18, 0xe6, 0x34,
+	0x00, 0xf5, 0x83, 0xec, 0xf0, 0x78, 0xa7, 0xe6,
+	0x24, 0x07, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00,
+	0xf5, 0x83, 0xe0, 0xfc, 0x78, 0xa9, 0xe6, 0x24,
+	0x09, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5,
+	0x83, 0xec, 0xf0, 0x78, 0xa6, 0x86, 0x83, 0x08,
+	0x86, 0x82, 0xe0, 0xfd, 0xa3, 0xe0, 0xfc, 0xed,
+	0xfe, 0x78, 0xa9, 0xe6, 0x24, 0x08, 0xf5, 0x82,
+	0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xee, 0xf0,
+	0xec, 0xfe, 0x78, 0xa9, 0xe6, 0x24, 0x07, 0xf5,
+	0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xee,
+	0xf0, 0x8c, 0x29, 0x8d, 0x28, 0xc3, 0xec, 0x94,
+	0x05, 0xed, 0x94, 0x0c, 0x40, 0x05, 0x75, 0x27,
+	0x7c, 0x80, 0x33, 0xd3, 0xe5, 0x29, 0x94, 0x01,
+	0xe5, 0x28, 0x94, 0x03, 0x40, 0x05, 0x75, 0x27,
+	0x3c, 0x80, 0x23, 0xd3, 0xe5, 0x29, 0x94, 0x81,
+	0xe5, 0x28, 0x94, 0x01, 0x40, 0x05, 0x75, 0x27,
+	0x18, 0x80, 0x13, 0xd3, 0xe5, 0x29, 0x94, 0x60,
+	0xe5, 0x28, 0x94, 0x00, 0x40, 0x05, 0x75, 0x27,
+	0x0c, 0x80, 0x03, 0x75, 0x27, 0x08, 0xaf, 0x27,
+	0xe4, 0xef, 0x54, 0x7c, 0x44, 0x83, 0xff, 0x8f,
+	0x27, 0xe5, 0x27, 0xfc, 0x78, 0xab, 0xe6, 0x24,
+	0x01, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5,
+	0x83, 0xec, 0xf0, 0xe5, 0x27, 0xfc, 0x78, 0xab,
+	0xe6, 0x24, 0x05, 0xf5, 0x82, 0x18, 0xe6, 0x34,
+	0x00, 0xf5, 0x83, 0xec, 0xf0, 0xe5, 0x27, 0xfc,
+	0x78, 0xa3, 0xe6, 0x24, 0xa4, 0xf8, 0xec, 0xf6,
+	0x78, 0xa9, 0xe6, 0x24, 0x02, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0xf5, 0x27,
+	0x78, 0xa7, 0xe6, 0x24, 0x02, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xa3, 0xe0, 0x30,
+	0xe3, 0x17, 0x53, 0x27, 0xc7, 0x78, 0xa7, 0xe6,
+	0x24, 0x05, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00,
+	0xf5, 0x83, 0xe0, 0x90, 0x35, 0x58, 0x93, 0x42,
+	0x27, 0x53, 0x27, 0xfb, 0x78, 0xa7, 0xe6, 0x24,
+	0x06, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5,
+	0x83, 0xe0, 0x60, 0x03, 0x43, 0x27, 0x04, 0x53,
+	0x27, 0xfc, 0x78, 0xa7, 0xe6, 0x24, 0x04, 0xf5,
+	0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0,
+	0x42, 0x27, 0x43, 0x27, 0x80, 0xe5, 0x27, 0xfc,
+	0x78, 0xa9, 0xe6, 0x24, 0x02, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xec, 0xf0, 0x78,
+	0xa9, 0xe6, 0x24, 0x04, 0xf5, 0x82, 0x18, 0xe6,
+	0x34, 0x00, 0xf5, 0x83, 0xe0, 0xf5, 0x27, 0x78,
+	0xa7, 0xe6, 0x24, 0x02, 0xf5, 0x82, 0x18, 0xe6,
+	0x34, 0x00, 0xf5, 0x83, 0xa3, 0xe0, 0x30, 0xe1,
+	0x05, 0x53, 0x27, 0xdf, 0x80, 0x03, 0x43, 0x27,
+	0x20, 0x78, 0xa7, 0xe6, 0x24, 0x02, 0xf5, 0x82,
+	0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x30,
+	0xe4, 0x05, 0x53, 0x27, 0xef, 0x80, 0x03, 0x43,
+	0x27, 0x10, 0x78, 0xa7, 0xe6, 0x24, 0x09, 0xf5,
+	0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0,
+	0xb4, 0x02, 0x03, 0x43, 0x27, 0x02, 0xe5, 0x27,
+	0xfc, 0x78, 0xa9, 0xe6, 0x24, 0x04, 0xf5, 0x82,
+	0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xec, 0xf0,
+	0x78, 0xa9, 0xe6, 0x24, 0x03, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0xf5, 0x27,
+	0x78, 0xa7, 0xe6, 0x24, 0x09, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x70, 0x05,
+	0x53, 0x27, 0x7f, 0x80, 0x03, 0x43, 0x27, 0x80,
+	0x78, 0xa7, 0xe6, 0x24, 0x02, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xa3, 0xe0, 0x30,
+	0xe0, 0x05, 0x43, 0x27, 0x20, 0x80, 0x03, 0x53,
+	0x27, 0xdf, 0x78, 0xa7, 0xe6, 0x24, 0x02, 0xf5,
+	0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0,
+	0x30, 0xe3, 0x05, 0x43, 0x27, 0x40, 0x80, 0x03,
+	0x53, 0x27, 0xbf, 0x78, 0xa7, 0xe6, 0x24, 0x02,
+	0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83,
+	0xe0, 0x30, 0xe0, 0x05, 0x43, 0x27, 0x10, 0x80,
+	0x03, 0x53, 0x27, 0xef, 0x78, 0xa7, 0xe6, 0x24,
+	0x02, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5,
+	0x83, 0xa3, 0xe0, 0x30, 0xe4, 0x05, 0x43, 0x27,
+	0x08, 0x80, 0x03, 0x53, 0x27, 0xf7, 0x78, 0xa7,
+	0xe6, 0x24, 0x02, 0xf5, 0x82, 0x18, 0xe6, 0x34,
+	0x00, 0xf5, 0x83, 0xa3, 0xe0, 0x30, 0xe5, 0x05,
+	0x43, 0x27, 0x04, 0x80, 0x03, 0x53, 0x27, 0xfb,
+	0x78, 0xa7, 0xe6, 0x24, 0x02, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xa3, 0xe0, 0x30,
+	0xe6, 0x05, 0x43, 0x27, 0x01, 0x80, 0x03, 0x53,
+	0x27, 0xfe, 0x78, 0xa7, 0xe6, 0x24, 0x02, 0xf5,
+	0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xa3,
+	0xe0, 0x30, 0xe7, 0x05, 0x43, 0x27, 0x02, 0x80,
+	0x03, 0x53, 0x27, 0xfd, 0xe5, 0x27, 0xfc, 0x78,
+	0xa9, 0xe6, 0x24, 0x03, 0xf5, 0x82, 0x18, 0xe6,
+	0x34, 0x00, 0xf5, 0x83, 0xec, 0xf0, 0xc2, 0x03,
+	0x7c, 0x00, 0x22, 0x8d, 0x27, 0x8c, 0x26, 0xed,
+	0x54, 0x03, 0x14, 0x60, 0x03, 0x7c, 0x10, 0x22,
+	0xe5, 0x27, 0x54, 0x7c, 0x24, 0xfc, 0x40, 0x03,
+	0x7c, 0x0b, 0x22, 0xe5, 0x26, 0x24, 0x9d, 0xf8,
+	0xc6, 0x44, 0x02, 0xf6, 0x7c, 0x00, 0x22, 0x8c,
+	0x30, 0x12, 0x0f, 0x69, 0xe5, 0x30, 0x24, 0x9d,
+	0xf8, 0xe6, 0x20, 0xe2, 0x4f, 0xac, 0x30, 0x7d,
+	0x02, 0x12, 0x0d, 0x2f, 0xe5, 0x30, 0x24, 0xfe,
+	0x44, 0x28, 0xfc, 0x78, 0xaa, 0x86, 0x83, 0x08,
+	0x86, 0x82, 0xec, 0xf0, 0xaf, 0x83, 0xe5, 0x82,
+	0x24, 0x04, 0xfe, 0xe4, 0x3f, 0xff, 0xec, 0x8e,
+	0x82, 0x8f, 0x83, 0xf0, 0x7c, 0x03, 0x8c, 0x2c,
+	0xe5, 0x2c, 0xfc, 0x78, 0xab, 0xe6, 0x24, 0x01,
+	0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83,
+	0xec, 0xf0, 0xe5, 0x2c, 0xfc, 0x78, 0xab, 0xe6,
+	0x24, 0x05, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00,
+	0xf5, 0x83, 0xec, 0xf0, 0x75, 0x2d, 0x01, 0x75,
+	0x2f, 0x48, 0x75, 0x2e, 0xff, 0xe5, 0x30, 0x24,
+	0xfd, 0xfc, 0xe4, 0x34, 0xff, 0xfd, 0xec, 0x7c,
+	0x03, 0x25, 0xe0, 0xcd, 0x33, 0xcd, 0xdc, 0xf9,
+	0xfc, 0xe5, 0x2f, 0x2c, 0xf5, 0x2f, 0xe5, 0x2e,
+	0x3d, 0xf5, 0x2e, 0x78, 0xab, 0xe6, 0x24, 0x04,
+	0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83,
+	0xe0, 0x54, 0xe7, 0xf5, 0x2c, 0xad, 0x2f, 0xae,
+	0x2e, 0xaf, 0x2d, 0xe4, 0x90, 0x00, 0x02, 0x12,
+	0x03, 0x17, 0xe4, 0x90, 0x00, 0x06, 0x12, 0x03,
+	0x17, 0x12, 0x01, 0xe6, 0x30, 0xe5, 0x03, 0x43,
+	0x2c, 0x10, 0xe5, 0x2c, 0xfc, 0x78, 0xab, 0xe6,
+	0x24, 0x04, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00,
+	0xf5, 0x83, 0xec, 0xf0, 0x12, 0x10, 0x4b, 0x78,
+	0xa9, 0xe6, 0x24, 0x06, 0xf5, 0x82, 0x18, 0xe6,
+	0x34, 0x00, 0xf5, 0x83, 0xe0, 0xc2, 0x03, 0xfc,
+	0xe5, 0x30, 0x24, 0x9d, 0xf8, 0xc6, 0x44, 0x04,
+	0xf6, 0x8c, 0x2c, 0xe5, 0x30, 0x54, 0x0f, 0xc4,
+	0x54, 0xf0, 0x7e, 0x00, 0xff, 0xee, 0xef, 0x44,
+	0x04, 0x7d, 0x00, 0xff, 0xec, 0x4e, 0xfc, 0xed,
+	0x4f, 0xfd, 0x12, 0x1c, 0xa7, 0x7c, 0x00, 0x22,
+	0x8c, 0x2f, 0x12, 0x0f, 0x69, 0x12, 0x0f, 0xeb,
+	0x78, 0xaa, 0x86, 0x83, 0x08, 0x86, 0x82, 0xe0,
+	0x54, 0x08, 0xf0, 0xa3, 0xa3, 0xa3, 0xa3, 0xe0,
+	0x54, 0x08, 0xf0, 0xac, 0x2f, 0x7d, 0x02, 0x12,
+	0x0d, 0x2f, 0xc2, 0x03, 0xe5, 0x2f, 0x24, 0x9d,
+	0xf8, 0xc6, 0x54, 0xfb, 0xf6, 0x7c, 0x00, 0x22,
+	0x12, 0x30, 0xe6, 0x78, 0x96, 0xec, 0xf6, 0xec,
+	0x24, 0x9d, 0xf8, 0xe6, 0x30, 0xe1, 0x0a, 0x7d,
+	0x00, 0x7c, 0x13, 0x12, 0x25, 0x26, 0x12, 0x31,
+	0x69, 0x78, 0x96, 0xe6, 0x24, 0x9d, 0xf8, 0xc6,
+	0x44, 0x01, 0xf6, 0x78, 0x96, 0xe6, 0xfc, 0x12,
+	0x0f, 0x69, 0x78, 0x96, 0xe6, 0x24, 0xfd, 0x75,
+	0xf0, 0x0a, 0xa4, 0x24, 0x14, 0xf5, 0x82, 0xe4,
+	0x34, 0xfc, 0xf5, 0x83, 0x78, 0xa6, 0xe6, 0xfa,
+	0x08, 0xe6, 0xf9, 0x7b, 0x0a, 0x78, 0x01, 0x12,
+	0x03, 0xa7, 0x78, 0xa6, 0x86, 0x83, 0x08, 0x86,
+	0x82, 0x79, 0x67, 0x7a, 0x35, 0x7b, 0x0a, 0x78,
+	0x01, 0x12, 0x03, 0xf5, 0x12, 0x0f, 0xb7, 0xc2,
+	0x03, 0x78, 0x96, 0xe6, 0xfc, 0x12, 0x11, 0x07,
+	0x78, 0x95, 0xec, 0xf6, 0xec, 0x60, 0x0a, 0x7d,
+	0x00, 0x7c, 0x08, 0x12, 0x25, 0x26, 0x12, 0x31,
+	0x69, 0x78, 0x96, 0xe6, 0xfc, 0x12, 0x0f, 0x69,
+	0x78, 0xa9, 0xe6, 0x24, 0x04, 0xf5, 0x82, 0x18,
+	0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x44, 0x10,
+	0x54, 0xdf, 0xfc, 0x78, 0xa9, 0xe6, 0x24, 0x04,
+	0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83,
+	0xec, 0xf0, 0x78, 0x95, 0xec, 0xf6, 0xc2, 0x03,
+	0x7c, 0xc8, 0x12, 0x32, 0xa9, 0x78, 0x96, 0xe6,
+	0xfc, 0x12, 0x0f, 0x69, 0x78, 0xa9, 0xe6, 0x24,
+	0x04, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5,
+	0x83, 0xe0, 0x54, 0xef, 0xf0, 0xc2, 0x03, 0x7c,
+	0xc8, 0x12, 0x32, 0xa9, 0x78, 0x96, 0xe6, 0xfc,
+	0x12, 0x0f, 0x69, 0x78, 0xa9, 0xe6, 0x24, 0x04,
+	0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83,
+	0xe0, 0x44, 0x10, 0xf0, 0xc2, 0x03, 0x7c, 0xc8,
+	0x12, 0x32, 0xa9, 0x78, 0x96, 0xe6, 0xfc, 0x12,
+	0x0f, 0x69, 0x78, 0xa9, 0xe6, 0x24, 0x04, 0xf5,
+	0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0,
+	0x44, 0x20, 0xf0, 0xc2, 0x03, 0x7c, 0xf0, 0x12,
+	0x32, 0xa9, 0x78, 0x96, 0xe6, 0xfc, 0x12, 0x0f,
+	0x69, 0x78, 0xa9, 0xe6, 0x24, 0x05, 0xf5, 0x82,
+	0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0, 0x30,
+	0xe4, 0x15, 0xc2, 0x03, 0x78, 0x96, 0xe6, 0x44,
+	0x10, 0x7f, 0x00, 0xfe, 0x7c, 0x07, 0x12, 0x31,
+	0xfb, 0x12, 0x31, 0x69, 0x02, 0x17, 0x14, 0x78,
+	0xa9, 0xe6, 0x24, 0x04, 0xf5, 0x82, 0x18, 0xe6,
+	0x34, 0x00, 0xf5, 0x83, 0xe0, 0x54, 0xcf, 0xf0,
+	0xc2, 0x03, 0x7c, 0xc8, 0x12, 0x32, 0xa9, 0x78,
+	0x96, 0xe6, 0xfc, 0x12, 0x0f, 0x69, 0x78, 0xa9,
+	0xe6, 0x24, 0x04, 0xf5, 0x82, 0x18, 0xe6, 0x34,
+	0x00, 0xf5, 0x83, 0xe0, 0x44, 0x30, 0xf0, 0xc2,
+	0x03, 0x7c, 0xf0, 0x12, 0x32, 0xa9, 0x78, 0x96,
+	0xe6, 0xfc, 0x12, 0x0f, 0x69, 0x78, 0xa9, 0xe6,
+	0x24, 0x05, 0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00,
+	0xf5, 0x83, 0xe0, 0x30, 0xe4, 0x14, 0xc2, 0x03,
+	0x78, 0x96, 0xe6, 0x44, 0x10, 0x7f, 0x00, 0xfe,
+	0x7c, 0x07, 0x12, 0x31, 0xfb, 0x12, 0x31, 0x69,
+	0x80, 0x5d, 0x78, 0xa9, 0xe6, 0x24, 0x04, 0xf5,
+	0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83, 0xe0,
+	0x54, 0xef, 0xf0, 0x78, 0xa9, 0xe6, 0x24, 0x04,
+	0xf5, 0x82, 0x18, 0xe6, 0x34, 0x00, 0xf5, 0x83,
+	0xe0, 0x54, 0xdf, 0xf0, 0x78, 0x96, 0xe6, 0x24,
+	0xfd, 0x75, 0xf0, 0x0a, 0xa4, 0x24, 0x14, 0xf5,
+	0x82, 0xe4, 0x34, 0xfc, 0xf5, 0x83, 0xac, 0x82,
+	0xad, 0x83, 0x78, 0xa6, 0x86, 0x83, 0x08, 0x86,
+	0x82, 0xec, 0xf9, 0xed, 0xfa, 0x7b, 0x0a, 0x78,
+	0x01, 0x12, 0x03, 0xa7, 0xc2, 0x03, 0x78, 0x96,
+	0xe6, 0xfc, 0x12, 0x11, 0x07, 0x7d, 0x00, 0x7c,
+	0x0b, 0x12, 0x25, 0x26, 0x12, 0x31, 0x69, 0x22,
+	0x12, 0x30, 0xe6, 0xe4, 0x90, 0xfc, 0x39, 0xf0,
+	0x7d, 0x02, 0x7c, 0x00, 0x12, 0x25, 0x26, 0x12,
+	0x31, 0x69, 0x22, 0x12, 0x30, 0xe6, 0x7c, 0x00,
+	0x12, 0x25, 0xbf, 0x12, 0x31, 0x69, 0x22, 0x74,
+	0x3c, 0x90, 0xfb, 0xe0, 0xf0, 0x74, 0x3e, 0x90,
+	0xfb, 0xe0, 0xf0, 0xe4, 0x90, 0xfc, 0x28, 0xf0,
+	0x22, 0x8d, 0x35, 0x8c, 0x34, 0xec, 0xb4, 0x01,
+	0x02, 0x80, 0x03, 0xd3, 0x40, 0x02, 0x80, 0x28,
+	0xb4, 0x02, 0x02, 0x80, 0x03, 0xd3, 0x40, 0x08,
+	0xa8, 0x35, 0xc6, 0x25, 0xe0, 0xf6, 0x80, 0x18,
+	0xb4, 0x04, 0x02, 0x80, 0x03, 0xd3, 0x40, 0x0a,
+	0xa8, 0x35, 0xc6, 0x25, 0xe0, 0x25, 0xe0, 0xf6,
+	0x80, 0x06, 0xa8, 0x35, 0x76, 0x00, 0x80, 0x00,
+	0x22, 0x8c, 0x3c, 0x8d, 0x3b, 0xed, 0xfe, 0xec,
+	0xfd, 0x7f, 0x01, 0x75, 0x66, 0x06, 0x75, 0x67,
+	0x00, 0x90, 0xfc, 0x29, 0x12, 0x04, 0x6e, 0x12,
+	0x01, 0xe6, 0xb4, 0x80, 0x02, 0x80, 0x06, 0xd3,
+	0x50, 0x03, 0x02, 0x18, 0x47, 0x90, 0xfc, 0x29,
+	0x12, 0x04, 0x80, 0x90, 0x00, 0x03, 0x12, 0x01,
+	0xec, 0x54, 0xf0, 0xb4, 0x30, 0x02, 0x80, 0x03,
+	0xd3, 0x40, 0x5f, 0x90, 0xfc, 0x29, 0x12, 0x04,
+	0x80, 0x90, 0x00, 0x08, 0x12, 0x02, 0x0e, 0xfa,
+	0xfd, 0xeb, 0xfe, 0x7f, 0x01, 0x90, 0xfc, 0x2c,
+	0x12, 0x04, 0x6e, 0xee, 0xcd, 0x90, 0x35, 0x71,
+	0xfc, 0xe4, 0x93, 0xff, 0x74, 0x01, 0x93, 0xfe,
+	0xf9, 0xef, 0xfa, 0x7b, 0x01, 0xea, 0xff, 0xe9,
+	0xfe, 0xec, 0xc3, 0x9e, 0xed, 0x9f, 0x40, 0x25,
+	0x90, 0x35, 0x73, 0xe4, 0x93, 0xfd, 0x74, 0x01,
+	0x93, 0xfc, 0xed, 0xfe, 0xec, 0xfd, 0x7f, 0x01,
+	0xee, 0xcd, 0xfc, 0x90, 0xfc, 0x2e, 0xe0, 0xd3,
+	0x9c, 0x90, 0xfc, 0x2d, 0xe0, 0x9d, 0x50, 0x05,
+	0x75, 0x66, 0x80, 0x80, 0x33, 0x12, 0x19, 0x65,
+	0x80, 0x2e, 0xb4, 0x60, 0x02, 0x80, 0x03, 0xd3,
+	0x40, 0x0b, 0xac, 0x3c, 0xad, 0x3b, 0x12, 0x07,
+	0x77, 0x8c, 0x66, 0x80, 0x1b, 0xb4, 0x10, 0x03,
+	0xb3, 0x40, 0x10, 0xc3, 0xb4, 0x20, 0x03, 0xb3,
+	0x40, 0x09, 0xc3, 0xb4, 0x40, 0x02, 0x80, 0x03,
+	0xd3, 0x40, 0x00, 0x75, 0x66, 0x81, 0x80, 0x00,
+	0x80, 0x75, 0xb4, 0x81, 0x02, 0x80, 0x03, 0xd3,
+	0x40, 0x6b, 0x90, 0xfc, 0x29, 0x12, 0x04, 0x80,
+	0x90, 0x00, 0x03, 0x12, 0x01, 0xec, 0x54, 0xf0,
+	0xb4, 0x30, 0x02, 0x80, 0x03, 0xd3, 0x40, 0x1d,
+	0x90, 0xfc, 0x29, 0x12, 0x04, 0x80, 0x90, 0x00,
+	0x08, 0x12, 0x02, 0x0e, 0xfa, 0xfd, 0xeb, 0xfe,
+	0x7f, 0x01, 0x90, 0xfc, 0x2f, 0x12, 0x04, 0x6e,
+	0x12, 0x18, 0xcf, 0x80, 0x36, 0xb4, 0x60, 0x02,
+	0x80, 0x03, 0xd3, 0x40, 0x13, 0x75, 0x3a, 0x67,
+	0xe4, 0xf5, 0x39, 0xf5, 0x38, 0xac, 0x3c, 0xad,
+	0x3b, 0x12, 0x05, 0xd3, 0x8c, 0x66, 0x80, 0x1b,
+	0xb4, 0x10, 0x03, 0xb3, 0x40, 0x10, 0xc3, 0xb4,
+	0x20, 0x03, 0xb3, 0x40, 0x09, 0xc3, 0xb4, 0x40,
+	0x02, 0x80, 0x03, 0xd3, 0x40, 0x00, 0x75, 0x66,
+	0x81, 0x80, 0x00, 0x80, 0x02, 0x80, 0x00, 0xe5,
+	0x66, 0xfc, 0x90, 0xfc, 0x29, 0x12, 0x04, 0x80,
+	0xec, 0x90, 0x00, 0x02, 0x12, 0x03, 0x17, 0xac,
+	0x67, 0x22, 0x90, 0xfc, 0x29, 0x12, 0x04, 0x80,
+	0x90, 0x00, 0x04, 0x12, 0x01, 0xec, 0x60, 0x04,
+	0x74, 0x01, 0x80, 0x01, 0xe4, 0xa2, 0xe0, 0x92,
+	0x01, 0x90, 0xfc, 0x29, 0x12, 0x04, 0x80, 0xed,
+	0x24, 0x03, 0xfd, 0x50, 0x01, 0x0e, 0x90, 0xfc,
+	0x2c, 0x12, 0x04, 0x6e, 0x90, 0xfc, 0x29, 0x12,
+	0x04, 0x80, 0x90, 0x00, 0x05, 0x12, 0x01, 0xec,
+	0xf5, 0x67, 0x90, 0x00, 0x04, 0x12, 0x01, 0xec,
+	0x54, 0x0f, 0xfc, 0x7d, 0x67, 0x12, 0x17, 0x46,
+	0xe5, 0x67, 0x70, 0x04, 0x75, 0x66, 0x08, 0x22,
+	0x75, 0x66, 0x00, 0x78, 0x84, 0x76, 0x00, 0x78,
+	0x84, 0xe6, 0xc3, 0x95, 0x67, 0x50, 0x38, 0x90,
+	0xfc, 0x2f, 0x12, 0x04, 0x80, 0x12, 0x01, 0xe6,
+	0xfc, 0x90, 0xfc, 0x2c, 0x12, 0x04, 0x80, 0xec,
+	0x12, 0x03, 0x0f, 0x30, 0x01, 0x0e, 0x90, 0xfc,
+	0x31, 0xe0, 0x04, 0xf0, 0x90, 0xfc, 0x30, 0x70,
+	0x03, 0xe0, 0x04, 0xf0, 0x78, 0x84, 0x06, 0x90,
+	0xfc, 0x2e, 0xe0, 0x04, 0xf0, 0x90, 0xfc, 0x2d,
+	0x70, 0x03, 0xe0, 0x04, 0xf0, 0x80, 0xc0, 0x22,
+	0x90, 0xfc, 0x2a, 0xe0, 0xfd, 0xa3, 0xe0, 0xfc,
+	0xed, 0xfe, 0xec, 0xfd, 0x7f, 0x01, 0xed, 0x24,
+	0x0a, 0xfd, 0x50, 0x01, 0x0e, 0x90, 0xfc, 0x32,
+	0x12, 0x04, 0x6e, 0x90, 0xfc, 0x29, 0x12, 0x04,
+	0x80, 0x90, 0x00, 0x04, 0x12, 0x01, 0xec, 0x54,
+	0x0f, 0xb4, 0x01, 0x02, 0x80, 0x03, 0xd3, 0x40,
+	0x17, 0x90, 0xfc, 0x32, 0x12, 0x04, 0x80, 0x0d,
+	0xed, 0x70, 0x01, 0x0e, 0x90, 0xfc, 0x2f, 0x12,
+	0x04, 0x6e, 0x78, 0x88, 0x76, 0x01, 0x80, 0x4e,
+	0xb4, 0x02, 0x02, 0x80, 0x03, 0xd3, 0x40, 0x19,
+	0x90, 0xfc, 0x32, 0x12, 0x04, 0x80, 0xed, 0x24,
+	0x02, 0xfd, 0x50, 0x01, 0x0e, 0x90, 0xfc, 0x2f,
+	0x12, 0x04, 0x6e, 0x78, 0x88, 0x76, 0x02, 0x80,
+	0x2d, 0xb4, 0x04, 0x02, 0x80, 0x03, 0xd3, 0x40,
+	0x19, 0x90, 0xfc, 0x32, 0x12, 0x04, 0x80, 0xed,
+	0x24, 0x04, 0xfd, 0x50, 0x01, 0x0e, 0x90, 0xfc,
+	0x2f, 0x12, 0x04, 0x6e, 0x78, 0x88, 0x76, 0x04,
+	0x80, 0x0c, 0xb4, 0x00, 0x02, 0x80, 0x03, 0xd3,
+	0x40, 0x00, 0x75, 0x66, 0x08, 0x22, 0x90, 0xfc,
+	0x29, 0x12, 0x04, 0x80, 0x90, 0x00, 0x05, 0x12,
+	0x01, 0xec, 0xf5, 0x67, 0x78, 0x85, 0x76, 0x00,
+	0x78, 0x85, 0xe6, 0xc3, 0x95, 0x67, 0x40, 0x03,
+	0x02, 0x1a, 0xcd, 0x78, 0x86, 0x76, 0x00, 0x78,
+	0x86, 0xe6, 0xc3, 0x78, 0x88, 0x96, 0x50, 0x76,
+	0x90, 0xfc, 0x2c, 0x12, 0x04, 0x80, 0x12, 0x01,
+	0xe6, 0xfc, 0x90, 0xfc, 0x32, 0x12, 0x04, 0x89,
+	0x12, 0x01, 0xe0, 0xf4, 0x5c, 0xfc, 0x12, 0x01,
+	0xe0, 0xf8, 0x90, 0xfc, 0x2f, 0x12, 0x04, 0x80,
+	0xe8, 0xc0, 0xe0, 0x12, 0x01, 0xe6, 0xc8, 0xd0,
+	0xe0, 0xc8, 0x58, 0x4c, 0xfc, 0x90, 0xfc, 0x2c,
+	0x12, 0x04, 0x80, 0xec, 0x12, 0x03, 0x0f, 0x78,
+	0x87, 0xec, 0xf6, 0x90, 0xfc, 0x31, 0xe0, 0x04,
+	0xf0, 0x90, 0xfc, 0x30, 0x70, 0x03, 0xe0, 0x04,
+	0xf0, 0x09, 0xe9, 0x70, 0x01, 0x0a, 0x90, 0xfc,
+	0x32, 0x12, 0x04, 0x77, 0x90, 0xfc, 0x29, 0x12,
+	0x04, 0x80, 0x90, 0x00, 0x04, 0x12, 0x01, 0xec,
+	0x30, 0xe4, 0x0e, 0x90, 0xfc, 0x2e, 0xe0, 0x04,
+	0xf0, 0x90, 0xfc, 0x2d, 0x70, 0x03, 0xe0, 0x04,
+	0xf0, 0x78, 0x86, 0x06, 0x80, 0x81, 0x78, 0x88,
+	0xe6, 0xfd, 0xe4, 0xfe, 0xff, 0xee, 0xcd, 0xfc,
+	0x90, 0xfc, 0x31, 0xe0, 0x2c, 0xf0, 0x90, 0xfc,
+	0x30, 0xe0, 0x3d, 0xf0, 0x78, 0x88, 0xe6, 0xfd,
+	0xe4, 0xfe, 0xff, 0xee, 0xcd, 0xfc, 0x90, 0xfc,
+	0x34, 0xe0, 0x2c, 0xf0, 0x90, 0xfc, 0x33, 0xe0,
+	0x3d, 0xf0, 0x78, 0x85, 0x06, 0x02, 0x1a, 0x0d,
+	0x75, 0x66, 0x00, 0x22, 0xe5, 0x3d, 0x05, 0x3d,
+	0x04, 0x70, 0x02, 0xb2, 0xb0, 0x22, 0xc0, 0xe0,
+	0xc0, 0xf0, 0xc0, 0x82, 0xc0, 0x83, 0xc0, 0xd0,
+	0xe8, 0xc0, 0xe0, 0xe9, 0xc0, 0xe0, 0xea, 0xc0,
+	0xe0, 0xeb, 0xc0, 0xe0, 0xec, 0xc0, 0xe0, 0xed,
+	0xc0, 0xe0, 0xee, 0xc0, 0xe0, 0xef, 0xc0, 0xe0,
+	0x90, 0xff, 0x92, 0xe0, 0x12, 0x01, 0xb7, 0x1b,
+	0x29, 0x30, 0x1b, 0x29, 0x32, 0x1b, 0x38, 0x38,
+	0x1b, 0x4a, 0x3a, 0x1b, 0x5c, 0x3e, 0x1b, 0x74,
+	0x44, 0x1b, 0x68, 0x46, 0x1b, 0x80, 0x50, 0x1b,
+	0xc2, 0x52, 0x1b, 0xa1, 0x54, 0x1b, 0xe3, 0x56,
+	0x00, 0x00, 0x1c, 0x04, 0x90, 0xff, 0x92, 0xe0,
+	0x7f, 0x00, 0xfe, 0x7c, 0x01, 0x12, 0x31, 0xfb,
+	0x02, 0x1c, 0x14, 0xe4, 0xff, 0x04, 0xfe, 0x7c,
+	0x03, 0x12, 0x31, 0xfb, 0x74, 0x20, 0x90, 0xff,
+	0xfe, 0xf0, 0x02, 0x1c, 0x14, 0xe4, 0xff, 0x04,
+	0xfe, 0x7c, 0x02, 0x12, 0x31, 0xfb, 0x74, 0x40,
+	0x90, 0xff, 0xfe, 0xf0, 0x02, 0x1c, 0x14, 0xe4,
+	0xff, 0x04, 0xfe, 0x7c, 0x04, 0x12, 0x31, 0xfb,
+	0x02, 0x1c, 0x14, 0xe4, 0xff, 0x04, 0xfe, 0x7c,
+	0x05, 0x12, 0x31, 0xfb, 0x02, 0x1c, 0x14, 0xe4,
+	0xff, 0x04, 0xfe, 0x7c, 0x06, 0x12, 0x31, 0xfb,
+	0x02, 0x1c, 0x14, 0x90, 0xff, 0xa5, 0xe0, 0x7d,
+	0x00, 0x90, 0xfb, 0xf8, 0xcd, 0xf0, 0xa3, 0xcd,
+	0xf0, 0x90, 0xfb, 0xf9, 0xe0, 0xfc, 0xf5, 0x83,
+	0x90, 0xfb, 0xf8, 0xe0, 0x44, 0x33, 0xfd, 0x12,
+	0x1c, 0xa7, 0x80, 0x73, 0x90, 0xff, 0xb5, 0xe0,
+	0x7d, 0x00, 0x90, 0xfb, 0xfa, 0xcd, 0xf0, 0xa3,
+	0xcd, 0xf0, 0x90, 0xfb, 0xfb, 0xe0, 0xfc, 0xf5,
+	0x83, 0x90, 0xfb, 0xfa, 0xe0, 0x44, 0x43, 0xfd,
+	0x12, 0x1c, 0xa7, 0x80, 0x52, 0x90, 0xff, 0xa6,
+	0xe0, 0x7d, 0x00, 0x90, 0xfb, 0xfc, 0xcd, 0xf0,
+	0xa3, 0xcd, 0xf0, 0x90, 0xfb, 0xfd, 0xe0, 0xfc,
+	0xf5, 0x83, 0x90, 0xfb, 0xfc, 0xe0, 0x44, 0x34,
+	0xfd, 0x12, 0x1c, 0xa7, 0x80, 0x31, 0x90, 0xff,
+	0xb6, 0xe0, 0x7d, 0x00, 0x90, 0xfb, 0xfe, 0xcd,
+	0xf0, 0xa3, 0xcd, 0xf0, 0x90, 0xfb, 0xff, 0xe0,
+	0xfc, 0xf5, 0x83, 0x90, 0xfb, 0xfe, 0xe0, 0x44,
+	0x44, 0xfd, 0x12, 0x1c, 0xa7, 0x80, 0x10, 0x90,
+	0xff, 0x92, 0xe0, 0x7d, 0x00, 0xfc, 0xed, 0x44,
+	0xaa, 0xfd, 0x12, 0x1c, 0xa7, 0x80, 0x00, 0xe4,
+	0x90, 0xff, 0x92, 0xf0, 0xd0, 0xe0, 0xff, 0xd0,
+	0xe0, 0xfe, 0xd0, 0xe0, 0xfd, 0xd0, 0xe0, 0xfc,
+	0xd0, 0xe0, 0xfb, 0xd0, 0xe0, 0xfa, 0xd0, 0xe0,
+	0xf9, 0xd0, 0xe0, 0xf8, 0xd0, 0xd0, 0xd0, 0x83,
+	0xd0, 0x82, 0xd0, 0xf0, 0xd0, 0xe0, 0x32, 0x05,
+	0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0xa8,
+	0x81, 0x18, 0x18, 0x18, 0xed, 0xf6, 0x08, 0xec,
+	0xf6, 0x90, 0xff, 0x5a, 0xe0, 0x20, 0xe7, 0x02,
+	0x80, 0xf7, 0x90, 0xff, 0x59, 0xe0, 0x7d, 0x00,
+	0xa8, 0x81, 0x18, 0xcd, 0xf6, 0xcd, 0x08, 0xf6,
+	0x7d, 0x03, 0xa8, 0x81, 0xe6, 0x18, 0xfc, 0xe6,
+	0xcc, 0x25, 0xe0, 0xcc, 0x33, 0xcc, 0xdd, 0xf9,
+	0xcc, 0xf6, 0xcc, 0x08, 0xf6, 0xa8, 0x81, 0x18,
+	0xe6, 0x44, 0xf8, 0xf6, 0xa8, 0x81, 0x18, 0x18,
+	0x18, 0xe6, 0xfd, 0x08, 0xe6, 0xfc, 0xa8, 0x81,
+	0x18, 0x86, 0x83, 0x08, 0x86, 0x82, 0xed, 0xf0,
+	0xa3, 0xec, 0xf0, 0x74, 0x02, 0x90, 0xff, 0x5a,
+	0xf0, 0x15, 0x81, 0x15, 0x81, 0x15, 0x81, 0x15,
+	0x81, 0x22, 0xe5, 0x81, 0x24, 0x05, 0xf5, 0x81,
+	0xe4, 0xa8, 0x81, 0x18, 0xf6, 0xa8, 0x81, 0x18,
+	0x18, 0x18, 0x18, 0xed, 0xf6, 0x08, 0xec, 0xf6,
+	0x90, 0xfb, 0xf5, 0xe0, 0x24, 0xf8, 0x50, 0x03,
+	0x02, 0x1d, 0xc8, 0xe4, 0xa8, 0x81, 0x18, 0x18,
+	0xf6, 0xa8, 0x81, 0x18, 0xe6, 0xfe, 0xa8, 0x81,
+	0x18, 0x18, 0x18, 0x18, 0xe6, 0xfd, 0x08, 0xe6,
+	0xfc, 0x7f, 0x00, 0xef, 0x24, 0xf8, 0x40, 0x4d,
+	0xe4, 0xef, 0x25, 0xe0, 0x24, 0x7d, 0xf5, 0x82,
+	0xe4, 0x34, 0xfc, 0xf5, 0x83, 0xe0, 0xfb, 0xa3,
+	0xe0, 0x6c, 0x70, 0x03, 0xfa, 0xeb, 0x6d, 0x70,
+	0x09, 0x74, 0x01, 0xa8, 0x81, 0x18, 0x18, 0xf6,
+	0x80, 0x2b, 0xe4, 0xef, 0x25, 0xe0, 0x24, 0x7d,
+	0xf5, 0x82, 0xe4, 0x34, 0xfc, 0xf5, 0x83, 0x7a,
+	0x00, 0xe0, 0x54, 0xf0, 0xcc, 0xf8, 0xcc, 0xcd,
+	0xf9, 0xcd, 0xfb, 0x78, 0x00, 0xe9, 0x54, 0xf0,
+	0xf9, 0xea, 0x68, 0x70, 0x02, 0xeb, 0x69, 0x70,
+	0x01, 0x0e, 0x0f, 0x80, 0xae, 0xa8, 0x81, 0x18,
+	0xee, 0xf6, 0xa8, 0x81, 0x18, 0x18, 0x18, 0x18,
+	0xed, 0xf6, 0x08, 0xec, 0xf6, 0xa8, 0x81, 0xef,
+	0xf6, 0xa8, 0x81, 0x18, 0x18, 0xe6, 0x70, 0x79,
+	0xa8, 0x81, 0x18, 0xe6, 0x24, 0xf7, 0x40, 0x71,
+	0xa8, 0x81, 0x18, 0x18, 0x18, 0x18, 0xe6, 0x54,
+	0x0f, 0xa8, 0x81, 0xf6, 0x64, 0x04, 0x60, 0x17,
+	0xa8, 0x81, 0xe6, 0x64, 0x03, 0x60, 0x10, 0xa8,
+	0x81, 0x18, 0x18, 0x18, 0x18, 0xe6, 0xfd, 0x08,
+	0xe6, 0xfc, 0x12, 0x1c, 0x3c, 0x80, 0x4a, 0x7c,
+	0x0a, 0x12, 0x31, 0x5b, 0xa8, 0x81, 0x18, 0x18,
+	0x18, 0x18, 0xe6, 0xfd, 0x08, 0xe6, 0xfc, 0x90,
+	0xfb, 0xf4, 0xe0, 0x25, 0xe0, 0x24, 0x7d, 0xf5,
+	0x82, 0xe4, 0x34, 0xfc, 0xf5, 0x83, 0xed, 0xf0,
+	0xa3, 0xec, 0xf0, 0x90, 0xfb, 0xf4, 0xe0, 0xff,
+	0xe4, 0xef, 0x04, 0x54, 0x07, 0xff, 0x90, 0xfb,
+	0xf4, 0xf0, 0x90, 0xfb, 0xf5, 0xe0, 0x04, 0xf0,
+	0x12, 0x31, 0xf4, 0x90, 0xfb, 0xf6, 0xe0, 0x70,
+	0x08, 0xe4, 0xfe, 0xff, 0x7c, 0x0f, 0x12, 0x31,
+	0xfb, 0x80, 0x27, 0x90, 0xfb, 0xf7, 0xe0, 0x04,
+	0xf0, 0x54, 0x3f, 0x70, 0x1d, 0x90, 0xfb, 0xf7,
+	0xe0, 0x44, 0xfe, 0x7d, 0x00, 0xfc, 0x90, 0xfb,
+	0xf4, 0xe0, 0x25, 0xe0, 0x24, 0x7d, 0xf5, 0x82,
+	0xe4, 0x34, 0xfc, 0xf5, 0x83, 0xed, 0xf0, 0xa3,
+	0xec, 0xf0, 0xe5, 0x81, 0x24, 0xfb, 0xf5, 0x81,
+	0x22, 0x78, 0x8b, 0x76, 0x00, 0x78, 0x8c, 0x76,
+	0x00, 0x74, 0x01, 0x90, 0xfb, 0xf6, 0xf0, 0x12,
+	0x30, 0xe6, 0x90, 0xfb, 0xf5, 0xe0, 0x60, 0x57,
+	0x7c, 0x0a, 0x12, 0x31, 0x5b, 0x90, 0xfb, 0xf3,
+	0xe0, 0x25, 0xe0, 0x24, 0x7d, 0xf5, 0x82, 0xe4,
+	0x34, 0xfc, 0xf5, 0x83, 0xe0, 0xfd, 0xa3, 0xe0,
+	0xfc, 0x90, 0xfb, 0xf3, 0xe0, 0x25, 0xe0, 0x24,
+	0x7d, 0xf5, 0x82, 0xe4, 0x34, 0xfc, 0xf5, 0x83,
+	0xe4, 0xf0, 0xa3, 0xf0, 0x90, 0xfb, 0xf3, 0xe0,
+	0xff, 0xe4, 0xef, 0x04, 0x54, 0x07, 0xff, 0x90,
+	0xfb, 0xf3, 0xf0, 0x90, 0xfb, 0xf5, 0xe0, 0x14,
+	0xf0, 0x78, 0x89, 0xed, 0xf6, 0x08, 0xec, 0xf6,
+	0x12, 0x31, 0xf4, 0x78, 0x89, 0xe6, 0xfd, 0x08,
+	0xe6, 0xfc, 0x12, 0x08, 0xda, 0x80, 0xa3, 0x12,
+	0x32, 0x48, 0x90, 0xff, 0x93, 0xe0, 0x44, 0x01,
+	0xf0, 0xb2, 0xb3, 0x78, 0x8b, 0x06, 0xb6, 0x00,
+	0x11, 0x78, 0x8b, 0x76, 0x00, 0x78, 0x8c, 0xe6,
+	0xf4, 0x04, 0x04, 0xa2, 0xe0, 0x92, 0xb4, 0x78,
+	0x8c, 0xf6, 0x02, 0x1e, 0x07, 0xe4, 0x90, 0xfb,
+	0xf6, 0xf0, 0x90, 0xfb, 0xf5, 0xe0, 0x7d, 0x00,
+	0xfc, 0xed, 0x44, 0xcf, 0xfd, 0x12, 0x1c, 0x3c,
+	0x12, 0x31, 0x69, 0x22, 0x12, 0x30, 0xe6, 0xe5,
+	0x70, 0x64, 0x49, 0x45, 0x6f, 0x60, 0x15, 0x90,
+	0xff, 0x83, 0xe0, 0x54, 0x0f, 0x7d, 0x00, 0xd3,
+	0x95, 0x70, 0xed, 0x95, 0x6f, 0x50, 0x05, 0x12,
+	0x2f, 0x2f, 0x80, 0x03, 0x12, 0x2f, 0xff, 0x12,
+	0x31, 0x69, 0x22, 0x12, 0x30, 0xe6, 0xe5, 0x70,
+	0x64, 0x49, 0x45, 0x6f, 0x60, 0x05, 0x12, 0x30,
+	0x39, 0x80, 0x0e, 0x90, 0xff, 0x80, 0xe0, 0x44,
+	0x08, 0xf0, 0x90, 0xff, 0x83, 0xe0, 0x54, 0x7f,
+	0xf0, 0x12, 0x31, 0x69, 0x22, 0x12, 0x30, 0xe6,
+	0x8c, 0x54, 0xec, 0x54, 0xf0, 0xb4, 0x10, 0x15,
+	0x75, 0x6a, 0x35, 0x75, 0x69, 0xfc, 0x75, 0x68,
+	0x01, 0xe5, 0x6a, 0x24, 0x03, 0xf5, 0x6a, 0xe5,
+	0x69, 0x34, 0x00, 0xf5, 0x69, 0xe4, 0xf5, 0x57,
+	0xf5, 0x56, 0xe5, 0x56, 0xc3, 0x94, 0x01, 0x50,
+	0x27, 0xe5, 0x54, 0x54, 0x0f, 0xfc, 0xad, 0x6a,
+	0xae, 0x69, 0xaf, 0x68, 0x12, 0x0e, 0x77, 0x8c,
+	0x55, 0xec, 0x60, 0x02, 0x80, 0x12, 0x05, 0x6a,
+	0xe5, 0x6a, 0x70, 0x02, 0x05, 0x69, 0x05, 0x57,
+	0xe5, 0x57, 0x70, 0x02, 0x05, 0x56, 0x80, 0xd2,
+	0xe5, 0x54, 0x54, 0x0f, 0x24, 0x9d, 0xf8, 0xc6,
+	0x54, 0xfe, 0xf6, 0xe5, 0x54, 0x54, 0x0f, 0x7f,
+	0x00, 0xfe, 0x7c, 0x12, 0x12, 0x31, 0xfb, 0xe5,
+	0x55, 0x14, 0x70, 0x09, 0x7d, 0x00, 0x7c, 0x09,
+	0x12, 0x25, 0x26, 0x80, 0x07, 0xad, 0x57, 0x7c,
+	0x00, 0x12, 0x25, 0x26, 0x12, 0x31, 0x69, 0x22,
+	0x12, 0x30, 0xe6, 0x90, 0xff, 0xfc, 0xe0, 0x44,
+	0x02, 0xf0, 0x90, 0xff, 0x00, 0xe0, 0x30, 0xe7,
+	0x13, 0x90, 0xff, 0x83, 0xe0, 0x44, 0x80, 0xf0,
+	0x43, 0x6d, 0x80, 0x90, 0xff, 0xfc, 0xe0, 0x44,
+	0x01, 0xf0, 0x80, 0x11, 0x90, 0xff, 0x82, 0xe0,
+	0x44, 0x08, 0xf0, 0x53, 0x6d, 0x7f, 0x90, 0xff,
+	0xfc, 0xe0, 0x54, 0xfe, 0xf0, 0x90, 0xff, 0x81,
+	0xe0, 0x44, 0x80, 0xf0, 0x12, 0x25, 0xd9, 0x90,
+	0xff, 0xfe, 0xe0, 0x44, 0x05, 0xf0, 0x90, 0xff,
+	0xfc, 0xe0, 0x54, 0xfd, 0xf0, 0x12, 0x31, 0x69,
+	0x22, 0x12, 0x30, 0xe6, 0x7c, 0x01, 0x12, 0x32,
+	0xa9, 0x78, 0xad, 0xe6, 0x44, 0x02, 0xf6, 0x74,
+	0xfe, 0xfc, 0x04, 0xfd, 0x12, 0x1c, 0xa7, 0x90,
+	0xff, 0x5a, 0xe0, 0x30, 0xe7, 0x02, 0x80, 0xf7,
+	0xe4, 0xf5, 0x4e, 0x75, 0x4d, 0x10, 0xac, 0x4e,
+	0xad, 0x4d, 0xe5, 0x4e, 0x15, 0x4e, 0x70, 0x02,
+	0x15, 0x4d, 0xec, 0x4d, 0x60, 0x02, 0x80, 0xee,
+	0x43, 0x87, 0x01, 0x12, 0x31, 0x69, 0x22, 0x12,
+	0x30, 0xe6, 0x7c, 0x02, 0x12, 0x31, 0x75, 0x78,
+	0xad, 0xe6, 0x54, 0xfd, 0xf6, 0x12, 0x31, 0x69,
+	0x22, 0x12, 0x30, 0xe6, 0x78, 0xad, 0xe6, 0x30,
+	0xe0, 0x2c, 0x78, 0xad, 0xe6, 0x30, 0xe1, 0x26,
+	0x78, 0xad, 0xe6, 0xfc, 0xf5, 0x83, 0x18, 0xe6,
+	0x44, 0xf0, 0xfd, 0x12, 0x1c, 0x3c, 0x90, 0xff,
+	0xfc, 0xe0, 0x44, 0x20, 0xf0, 0x7c, 0x02, 0x12,
+	0x32, 0xa9, 0x78, 0xad, 0xe6, 0x54, 0xfd, 0xf6,
+	0x74, 0x1a, 0x90, 0xff, 0xfe, 0xf0, 0x78, 0xad,
+	0xe6, 0xfc, 0xf5, 0x83, 0x18, 0xe6, 0x44, 0xf1,
+	0xfd, 0x12, 0x1c, 0x3c, 0x12, 0x31, 0x69, 0x22,
+	0x75, 0x6d, 0x00, 0x90, 0xff, 0xff, 0xe0, 0x60,
+	0x03, 0x43, 0x6d, 0x01, 0x75, 0x6e, 0x00, 0xe4,
+	0xf5, 0x6c, 0xf5, 0x6b, 0xe4, 0xf5, 0x6f, 0x75,
+	0x70, 0x49, 0x74, 0x84, 0x90, 0xff, 0x82, 0xf0,
+	0x74, 0x84, 0x90, 0xff, 0x80, 0xf0, 0x74, 0x80,
+	0x90, 0xff, 0x58, 0xf0, 0x74, 0x80, 0x90, 0xff,
+	0x5a, 0xf0, 0xad, 0x46, 0xaf, 0x45, 0x7e, 0x00,
+	0xee, 0x24, 0xfe, 0x50, 0x03, 0x02, 0x21, 0x24,
+	0xe4, 0xee, 0x75, 0xf0, 0x07, 0xa4, 0x24, 0x7f,
+	0xf5, 0x82, 0xe4, 0x34, 0xf8, 0xf5, 0x83, 0xe0,
+	0xff, 0xe4, 0xef, 0x54, 0x80, 0xfd, 0xe4, 0xef,
+	0x54, 0x0f, 0x14, 0xff, 0xed, 0x60, 0x38, 0xe4,
+	0xef, 0x75, 0xf0, 0x08, 0xa4, 0x24, 0x48, 0xf5,
+	0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83, 0x74, 0x90,
+	0xf0, 0xe4, 0xef, 0x75, 0xf0, 0x08, 0xa4, 0x24,
+	0x4a, 0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83,
+	0x74, 0x80, 0xf0, 0xe4, 0xef, 0x75, 0xf0, 0x08,
+	0xa4, 0x24, 0x4e, 0xf5, 0x82, 0xe4, 0x34, 0xff,
+	0xf5, 0x83, 0x74, 0x80, 0xf0, 0x80, 0x34, 0xe4,
+	0xef, 0x75, 0xf0, 0x08, 0xa4, 0x24, 0x08, 0xf5,
+	0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83, 0x74, 0x90,
+	0xf0, 0xe4, 0xef, 0x75, 0xf0, 0x08, 0xa4, 0x24,
+	0x0a, 0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83,
+	0xe4, 0xf0, 0xe4, 0xef, 0x75, 0xf0, 0x08, 0xa4,
+	0x24, 0x0e, 0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5,
+	0x83, 0xe4, 0xf0, 0x0e, 0x02, 0x20, 0x8d, 0x8d,
+	0x46, 0x8e, 0x44, 0x8f, 0x45, 0x74, 0x7f, 0x90,
+	0xff, 0xfd, 0xf0, 0x74, 0x90, 0x90, 0xff, 0xfc,
+	0xf0, 0x22, 0x8c, 0x58, 0xec, 0x24, 0xf6, 0x50,
+	0x06, 0xe5, 0x58, 0x24, 0x37, 0xfc, 0x22, 0xe5,
+	0x58, 0x24, 0x30, 0xfc, 0x22, 0x12, 0x25, 0x23,
+	0xec, 0x70, 0x03, 0x02, 0x22, 0x5e, 0x75, 0x5c,
+	0x03, 0xae, 0x5b, 0x7f, 0x00, 0xe5, 0x5c, 0x15,
+	0x5c, 0x64, 0x80, 0x24, 0x7f, 0x50, 0x35, 0xef,
+	0x24, 0x00, 0xf5, 0x82, 0xe4, 0x34, 0xfb, 0xf5,
+	0x83, 0xe0, 0xfe, 0x24, 0xfe, 0x50, 0x1e, 0xef,
+	0x7d, 0x00, 0xfc, 0xe4, 0xfb, 0x74, 0x74, 0xc3,
+	0x9c, 0xfa, 0xeb, 0x9d, 0xfb, 0xee, 0x7d, 0x00,
+	0xfc, 0xea, 0xc3, 0x9c, 0xed, 0x64, 0x80, 0xcb,
+	0x64, 0x80, 0x9b, 0x50, 0x02, 0x80, 0x05, 0xef,
+	0x2e, 0xff, 0x80, 0xc1, 0x8e, 0x5b, 0x8f, 0x5a,
+	0xe5, 0x5c, 0x64, 0x80, 0x24, 0x7f, 0x50, 0x03,
+	0x02, 0x22, 0x5e, 0xe5, 0x5a, 0x24, 0x8e, 0x50,
+	0x03, 0x02, 0x22, 0x5e, 0x85, 0x5a, 0x5d, 0x75,
+	0x5b, 0x00, 0xae, 0x5a, 0xaf, 0x5b, 0x90, 0x35,
+	0x9c, 0xe4, 0x93, 0xf5, 0x5c, 0xe5, 0x5c, 0x15,
+	0x5c, 0x64, 0x80, 0x24, 0x7f, 0x50, 0x18, 0xee,
+	0x24, 0x00, 0xf5, 0x82, 0xe4, 0x34, 0xfb, 0xf5,
+	0x83, 0xe0, 0xfc, 0xef, 0x90, 0x35, 0x9c, 0x93,
+	0x6c, 0x70, 0x04, 0x0e, 0x0f, 0x80, 0xde, 0x8e,
+	0x5a, 0x8f, 0x5b, 0xe5, 0x5c, 0x64, 0x80, 0x24,
+	0x7f, 0x40, 0x6e, 0x75, 0x5e, 0x01, 0x75, 0x60,
+	0xe8, 0x75, 0x5f, 0xff, 0xe5, 0x5d, 0x24, 0x02,
+	0xf5, 0x5a, 0x75, 0x5c, 0x07, 0xe5, 0x5c, 0x33,
+	0x40, 0x57, 0xad, 0x60, 0xae, 0x5f, 0xaf, 0x5e,
+	0xe5, 0x5c, 0xf5, 0x82, 0x33, 0x95, 0xe0, 0xf5,
+	0x83, 0x12, 0x01, 0xec, 0xc4, 0x54, 0x0f, 0xfc,
+	0x12, 0x21, 0x37, 0xe5, 0x5a, 0x24, 0x00, 0xf5,
+	0x82, 0xe4, 0x34, 0xfb, 0xf5, 0x83, 0xec, 0xf0,
+	0x05, 0x5a, 0x05, 0x5a, 0xad, 0x60, 0xae, 0x5f,
+	0xaf, 0x5e, 0xe5, 0x5c, 0xf5, 0x82, 0x33, 0x95,
+	0xe0, 0xf5, 0x83, 0x12, 0x01, 0xec, 0x54, 0x0f,
+	0xfc, 0x12, 0x21, 0x37, 0xe5, 0x5a, 0x24, 0x00,
+	0xf5, 0x82, 0xe4, 0x34, 0xfb, 0xf5, 0x83, 0xec,
+	0xf0, 0x05, 0x5a, 0x05, 0x5a, 0x15, 0x5c, 0x80,
+	0xa4, 0x74, 0x02, 0x90, 0xf8, 0x51, 0xf0, 0x90,
+	0xf8, 0x6b, 0x79, 0x75, 0x7a, 0x35, 0x7b, 0x27,
+	0x78, 0x01, 0x12, 0x03, 0xf5, 0x75, 0x6a, 0x35,
+	0x75, 0x69, 0xfc, 0x75, 0x68, 0x01, 0xe4, 0x90,
+	0xff, 0x83, 0xf0, 0x74, 0x80, 0x90, 0xff, 0x81,
+	0xf0, 0x75, 0x59, 0x02, 0xe5, 0x59, 0x75, 0xf0,
+	0x07, 0xa4, 0x24, 0x7f, 0xf5, 0x82, 0xe4, 0x34,
+	0xf8, 0xf5, 0x83, 0xe0, 0x78, 0x8f, 0xf6, 0xfc,
+	0x54, 0x0f, 0x14, 0xfc, 0x78, 0x8f, 0xec, 0xf6,
+	0xe5, 0x59, 0x75, 0xf0, 0x07, 0xa4, 0x24, 0x81,
+	0xf5, 0x82, 0xe4, 0x34, 0xf8, 0xf5, 0x83, 0xe0,
+	0x78, 0x92, 0x76, 0xfd, 0x08, 0x76, 0xe8, 0xfc,
+	0x78, 0x8f, 0xe6, 0x75, 0xf0, 0x08, 0xa4, 0x24,
+	0x48, 0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83,
+	0xe4, 0xf0, 0x78, 0x8f, 0xe6, 0x75, 0xf0, 0x08,
+	0xa4, 0x24, 0x4f, 0xf5, 0x82, 0xe4, 0x34, 0xff,
+	0xf5, 0x83, 0xec, 0xf0, 0x78, 0x92, 0xe6, 0xff,
+	0x08, 0xe6, 0x7e, 0x03, 0xcf, 0xc3, 0x13, 0xcf,
+	0x13, 0xde, 0xf9, 0xfe, 0x78, 0x8f, 0xe6, 0x75,
+	0xf0, 0x08, 0xa4, 0x24, 0x49, 0xf5, 0x82, 0xe4,
+	0x34, 0xff, 0xf5, 0x83, 0xee, 0xf0, 0x78, 0x8f,
+	0xe6, 0x75, 0xf0, 0x08, 0xa4, 0x24, 0x4a, 0xf5,
+	0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83, 0x74, 0x80,
+	0xf0, 0x78, 0x90, 0xec, 0xf6, 0x7d, 0x00, 0x78,
+	0x93, 0xe6, 0x2c, 0xf6, 0x18, 0xe6, 0x3d, 0xf6,
+	0x78, 0x92, 0xe6, 0xfd, 0x08, 0xe6, 0x7c, 0x03,
+	0xcd, 0xc3, 0x13, 0xcd, 0x13, 0xdc, 0xf9, 0xfc,
+	0x78, 0x8f, 0xe6, 0x75, 0xf0, 0x08, 0xa4, 0x24,
+	0x4d, 0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83,
+	0xec, 0xf0, 0x78, 0x8f, 0xe6, 0x75, 0xf0, 0x08,
+	0xa4, 0x24, 0x4e, 0xf5, 0x82, 0xe4, 0x34, 0xff,
+	0xf5, 0x83, 0xe4, 0xf0, 0x78, 0x92, 0xe6, 0xfd,
+	0x08, 0xe6, 0xfc, 0x78, 0x8f, 0xe6, 0xff, 0x7e,
+	0x00, 0xee, 0x24, 0xfe, 0x50, 0x03, 0x02, 0x24,
+	0xdd, 0xe4, 0xee, 0x75, 0xf0, 0x07, 0xa4, 0x24,
+	0x7f, 0xf5, 0x82, 0xe4, 0x34, 0xf8, 0xf5, 0x83,
+	0xe0, 0xff, 0xe4, 0xef, 0x54, 0x80, 0xfa, 0xe4,
+	0xef, 0x54, 0x0f, 0x14, 0xff, 0xe4, 0xee, 0x75,
+	0xf0, 0x07, 0xa4, 0x24, 0x81, 0xf5, 0x82, 0xe4,
+	0x34, 0xf8, 0xf5, 0x83, 0xe0, 0x78, 0x90, 0xf6,
+	0xe4, 0xee, 0x13, 0x13, 0x54, 0x80, 0x24, 0xf0,
+	0xf8, 0xe4, 0x34, 0xfd, 0xf9, 0xe8, 0xfc, 0xe9,
+	0xfd, 0x8a, 0x5a, 0xea, 0x70, 0x03, 0x02, 0x24,
+	0x4a, 0xe4, 0xef, 0x75, 0xf0, 0x08, 0xa4, 0x24,
+	0x48, 0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83,
+	0xe4, 0xf0, 0x78, 0x90, 0xe6, 0xfa, 0xe4, 0xef,
+	0x75, 0xf0, 0x08, 0xa4, 0x24, 0x4f, 0xf5, 0x82,
+	0xe4, 0x34, 0xff, 0xf5, 0x83, 0xea, 0xf0, 0xed,
+	0xfb, 0xec, 0x7a, 0x03, 0xcb, 0xc3, 0x13, 0xcb,
+	0x13, 0xda, 0xf9, 0xfa, 0xe4, 0xef, 0x75, 0xf0,
+	0x08, 0xa4, 0x24, 0x49, 0xf5, 0x82, 0xe4, 0x34,
+	0xff, 0xf5, 0x83, 0xea, 0xf0, 0x78, 0x90, 0xe6,
+	0x7b, 0x00, 0xfa, 0xec, 0x2a, 0xfc, 0xed, 0x3b,
+	0xfd, 0xfb, 0xec, 0x7a, 0x03, 0xcb, 0xc3, 0x13,
+	0xcb, 0x13, 0xda, 0xf9, 0xfa, 0xe4, 0xef, 0x75,
+	0xf0, 0x08, 0xa4, 0x24, 0x4d, 0xf5, 0x82, 0xe4,
+	0x34, 0xff, 0xf5, 0x83, 0xea, 0xf0, 0xe4, 0xef,
+	0x75, 0xf0, 0x08, 0xa4, 0x24, 0x4a, 0xf5, 0x82,
+	0xe4, 0x34, 0xff, 0xf5, 0x83, 0x74, 0x80, 0xf0,
+	0xe4, 0xef, 0x75, 0xf0, 0x08, 0xa4, 0x24, 0x4e,
+	0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83, 0x74,
+	0x80, 0xf0, 0x02, 0x24, 0xd9, 0xe4, 0xef, 0x75,
+	0xf0, 0x08, 0xa4, 0x24, 0x08, 0xf5, 0x82, 0xe4,
+	0x34, 0xff, 0xf5, 0x83, 0xe4, 0xf0, 0x78, 0x90,
+	0xe6, 0xfa, 0xe4, 0xef, 0x75, 0xf0, 0x08, 0xa4,
+	0x24, 0x0f, 0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5,
+	0x83, 0xea, 0xf0, 0xed, 0xfb, 0xec, 0x7a, 0x03,
+	0xcb, 0xc3, 0x13, 0xcb, 0x13, 0xda, 0xf9, 0xfa,
+	0xe4, 0xef, 0x75, 0xf0, 0x08, 0xa4, 0x24, 0x09,
+	0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83, 0xea,
+	0xf0, 0x78, 0x90, 0xe6, 0x7b, 0x00, 0xfa, 0xec,
+	0x2a, 0xfc, 0xed, 0x3b, 0xfd, 0xfb, 0xec, 0x7a,
+	0x03, 0xcb, 0xc3, 0x13, 0xcb, 0x13, 0xda, 0xf9,
+	0xfa, 0xe4, 0xef, 0x75, 0xf0, 0x08, 0xa4, 0x24,
+	0x0d, 0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83,
+	0xea, 0xf0, 0xe4, 0xef, 0x75, 0xf0, 0x08, 0xa4,
+	0x24, 0x0a, 0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5,
+	0x83, 0xe4, 0xf0, 0xe4, 0xef, 0x75, 0xf0, 0x08,
+	0xa4, 0x24, 0x0e, 0xf5, 0x82, 0xe4, 0x34, 0xff,
+	0xf5, 0x83, 0xe4, 0xf0, 0x0e, 0x02, 0x23, 0x66,
+	0x8e, 0x59, 0x78, 0x92, 0xed, 0xf6, 0x08, 0xec,
+	0xf6, 0x78, 0x8f, 0xef, 0xf6, 0x12, 0x20, 0x55,
+	0x22, 0x8c, 0x26, 0xec, 0x30, 0xe7, 0x18, 0xe5,
+	0x26, 0x54, 0x0f, 0x14, 0x75, 0xf0, 0x08, 0xa4,
+	0x24, 0x48, 0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5,
+	0x83, 0xe0, 0x54, 0xdf, 0xf0, 0x80, 0x16, 0xe5,
+	0x26, 0x54, 0x0f, 0x14, 0x75, 0xf0, 0x08, 0xa4,
+	0x24, 0x08, 0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5,
+	0x83, 0xe0, 0x54, 0xdf, 0xf0, 0x22, 0x7c, 0x00,
+	0x22, 0xec, 0x90, 0xfc, 0x37, 0xf0, 0x8c, 0x24,
+	0xed, 0x24, 0x03, 0xf5, 0x25, 0x7d, 0x00, 0xd3,
+	0x95, 0x72, 0xed, 0x95, 0x71, 0x40, 0x03, 0x85,
+	0x72, 0x25, 0xe5, 0x25, 0x24, 0xb7, 0x50, 0x09,
+	0x75, 0x25, 0x03, 0x74, 0x02, 0x90, 0xfc, 0x37,
+	0xf0, 0xac, 0x25, 0x12, 0x30, 0x24, 0x22, 0xe4,
+	0xf5, 0x6c, 0xf5, 0x6b, 0x12, 0x25, 0x5d, 0x22,
+	0x90, 0xfc, 0x35, 0xe0, 0x65, 0x73, 0x60, 0x0e,
+	0x74, 0x04, 0x90, 0xfc, 0x37, 0xf0, 0xe4, 0xf5,
+	0x6b, 0x75, 0x6c, 0x03, 0x80, 0x46, 0x7d, 0x73,
+	0xe4, 0xfe, 0xff, 0x79, 0x35, 0x7a, 0xfc, 0x7b,
+	0x01, 0x74, 0x05, 0x78, 0x00, 0x12, 0x03, 0x3f,
+	0xe5, 0x6c, 0x24, 0x03, 0xf5, 0x6c, 0xe5, 0x6b,
+	0x34, 0x00, 0xf5, 0x6b, 0xe5, 0x6c, 0xd3, 0x95,
+	0x72, 0xe5, 0x6b, 0x95, 0x71, 0x40, 0x06, 0x85,
+	0x72, 0x6c, 0x85, 0x71, 0x6b, 0xd3, 0xe5, 0x6c,
+	0x94, 0x48, 0xe5, 0x6b, 0x94, 0x00, 0x40, 0x0c,
+	0x74, 0x02, 0x90, 0xfc, 0x37, 0xf0, 0xe4, 0xf5,
+	0x6b, 0x75, 0x6c, 0x03, 0xac, 0x6c, 0x12, 0x30,
+	0x24, 0x22, 0xec, 0x90, 0xfc, 0x37, 0xf0, 0xe4,
+	0xf5, 0x6c, 0xf5, 0x6b, 0x8c, 0x32, 0xec, 0x60,
+	0x05, 0x12, 0x30, 0x15, 0x80, 0x05, 0x7c, 0x00,
+	0x12, 0x30, 0x24, 0x22, 0x90, 0xff, 0x93, 0xe0,
+	0x44, 0x01, 0xf0, 0xb2, 0xb3, 0x90, 0xff, 0x04,
+	0xe0, 0xf5, 0x4a, 0x90, 0xff, 0x06, 0xe0, 0xfd,
+	0xa3, 0xe0, 0xed, 0x7d, 0x00, 0xfc, 0x7d, 0x00,
+	0xfc, 0x90, 0xff, 0x06, 0xe0, 0xff, 0xa3, 0xe0,
+	0x7e, 0x00, 0xff, 0xe4, 0xfe, 0xec, 0x4e, 0xfc,
+	0xed, 0x4f, 0xfd, 0xc3, 0xec, 0x94, 0x48, 0xed,
+	0x94, 0x00, 0x50, 0x22, 0x90, 0xff, 0x06, 0xe0,
+	0xfd, 0xa3, 0xe0, 0xed, 0x7d, 0x00, 0xfc, 0x7d,
+	0x00, 0xfc, 0x90, 0xff, 0x06, 0xe0, 0xff, 0xa3,
+	0xe0, 0x7e, 0x00, 0xff, 0xe4, 0xfe, 0xec, 0x4e,
+	0xfc, 0xed, 0x4f, 0xfd, 0x80, 0x04, 0xe4, 0xfd,
+	0x7c, 0x48, 0x8c, 0x72, 0x8d, 0x71, 0x90, 0xff,
+	0x02, 0xe0, 0xfd, 0xa3, 0xe0, 0xed, 0x7d, 0x00,
+	0xfc, 0x7d, 0x00, 0xfc, 0x90, 0xff, 0x02, 0xe0,
+	0xff, 0xa3, 0xe0, 0x7e, 0x00, 0xff, 0xe4, 0xfe,
+	0xec, 0x4e, 0xf5, 0x4c, 0xed, 0x4f, 0xf5, 0x4b,
+	0x75, 0x6a, 0x35, 0x75, 0x69, 0xfc, 0x75, 0x68,
+	0x01, 0x7d, 0x35, 0x7e, 0xfc, 0x7f, 0x01, 0x79,
+	0x73, 0xe4, 0xfa, 0xfb, 0x74, 0x05, 0x78, 0x00,
+	0x12, 0x03, 0x3f, 0x75, 0x49, 0x00, 0xe5, 0x49,
+	0x24, 0xfe, 0x40, 0x19, 0xad, 0x6a, 0xae, 0x69,
+	0xaf, 0x68, 0xe4, 0x12, 0x03, 0x0f, 0x05, 0x49,
+	0x0d, 0xed, 0x70, 0x01, 0x0e, 0x8d, 0x6a, 0x8e,
+	0x69, 0x8f, 0x68, 0x80, 0xe1, 0x75, 0x6a, 0x35,
+	0x75, 0x69, 0xfc, 0x75, 0x68, 0x01, 0x90, 0xff,
+	0x00, 0xe0, 0x54, 0x60, 0xb4, 0x00, 0x02, 0x80,
+	0x06, 0xd3, 0x50, 0x03, 0x02, 0x2c, 0x6d, 0xe5,
+	0x4a, 0x54, 0x0f, 0xf5, 0x49, 0xe5, 0x4a, 0x54,
+	0x80, 0xa2, 0xe0, 0x92, 0x02, 0x90, 0xff, 0x01,
+	0xe0, 0x12, 0x01, 0x81, 0x00, 0x0b, 0x2c, 0x68,
+	0x26, 0xe5, 0x28, 0x03, 0x2c, 0x68, 0x29, 0x0f,
+	0x2c, 0x68, 0x29, 0xf2, 0x2a, 0x26, 0x2b, 0x8d,
+	0x2b, 0x90, 0x2b, 0xd0, 0x2c, 0x11, 0x2c, 0x3f,
+	0xe5, 0x6d, 0x30, 0xe7, 0x0e, 0xe5, 0x4c, 0x45,
+	0x4b, 0x70, 0x08, 0xe5, 0x72, 0x64, 0x02, 0x45,
+	0x71, 0x60, 0x03, 0x02, 0x2c, 0x6a, 0x90, 0xff,
+	0x00, 0xe0, 0x54, 0x1f, 0xb4, 0x00, 0x02, 0x80,
+	0x03, 0xd3, 0x40, 0x29, 0xe5, 0x4a, 0x60, 0x03,
+	0x02, 0x28, 0x00, 0xad, 0x6a, 0xae, 0x69, 0xaf,
+	0x68, 0x74, 0x01, 0x12, 0x03, 0x0f, 0x78, 0xad,
+	0xe6, 0x30, 0xe0, 0x0b, 0xad, 0x6a, 0xae, 0x69,
+	0xaf, 0x68, 0x74, 0x02, 0x12, 0x03, 0x0f, 0x7c,
+	0x02, 0x12, 0x30, 0x24, 0x22, 0xb4, 0x01, 0x02,
+	0x80, 0x03, 0xd3, 0x40, 0x1b, 0xe5, 0x6d, 0x20,
+	0xe1, 0x07, 0xe5, 0x4a, 0x60, 0x03, 0x02, 0x28,
+	0x00, 0xe5, 0x4a, 0x24, 0xfe, 0x50, 0x03, 0x02,
+	0x28, 0x00, 0x7c, 0x02, 0x12, 0x30, 0x24, 0x22,
+	0xb4, 0x02, 0x02, 0x80, 0x06, 0xd3, 0x50, 0x03,
+	0x02, 0x27, 0xfe, 0xe5, 0x6d, 0x20, 0xe1, 0x0d,
+	0xe5, 0x4a, 0x60, 0x09, 0xe5, 0x4a, 0x64, 0x80,
+	0x60, 0x03, 0x02, 0x28, 0x00, 0xac, 0x4a, 0x12,
+	0x30, 0xab, 0x40, 0x03, 0x02, 0x28, 0x00, 0xe5,
+	0x49, 0x70, 0x25, 0x30, 0x02, 0x11, 0x90, 0xff,
+	0x80, 0xe0, 0x54, 0x08, 0xad, 0x6a, 0xae, 0x69,
+	0xaf, 0x68, 0x12, 0x03, 0x0f, 0x80, 0x0f, 0x90,
+	0xff, 0x82, 0xe0, 0x54, 0x08, 0xad, 0x6a, 0xae,
+	0x69, 0xaf, 0x68, 0x12, 0x03, 0x0f, 0x80, 0x3d,
+	0x15, 0x49, 0x30, 0x02, 0x1d, 0xe5, 0x49, 0x75,
+	0xf0, 0x08, 0xa4, 0x24, 0x48, 0xf5, 0x82, 0xe4,
+	0x34, 0xff, 0xf5, 0x83, 0xe0, 0x54, 0x08, 0xad,
+	0x6a, 0xae, 0x69, 0xaf, 0x68, 0x12, 0x03, 0x0f,
+	0x80, 0x1b, 0xe5, 0x49, 0x75, 0xf0, 0x08, 0xa4,
+	0x24, 0x08, 0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5,
+	0x83, 0xe0, 0x54, 0x08, 0xad, 0x6a, 0xae, 0x69,
+	0xaf, 0x68, 0x12, 0x03, 0x0f, 0xad, 0x6a, 0xae,
+	0x69, 0xaf, 0x68, 0x12, 0x01, 0xe6, 0x60, 0x0b,
+	0xad, 0x6a, 0xae, 0x69, 0xaf, 0x68, 0x74, 0x01,
+	0x12, 0x03, 0x0f, 0x7c, 0x02, 0x12, 0x30, 0x24,
+	0x22, 0x80, 0x00, 0x02, 0x2c, 0x6a, 0xe5, 0x6d,
+	0x20, 0xe7, 0x06, 0xe5, 0x72, 0x45, 0x71, 0x60,
+	0x03, 0x02, 0x2c, 0x6a, 0x90, 0xff, 0x00, 0xe0,
+	0x54, 0x1f, 0xb4, 0x00, 0x02, 0x80, 0x03, 0xd3,
+	0x40, 0x1a, 0xe5, 0x4c, 0x14, 0x45, 0x4b, 0x70,
+	0x04, 0xe5, 0x4a, 0x60, 0x03, 0x02, 0x29, 0x0c,
+	0x78, 0xad, 0xe6, 0x54, 0xfe, 0xf6, 0x7c, 0x00,
+	0x12, 0x30, 0x24, 0x22, 0xb4, 0x01, 0x02, 0x80,
+	0x03, 0xd3, 0x40, 0x2a, 0xe5, 0x6d, 0x20, 0xe1,
+	0x08, 0xe5, 0x6d, 0x20, 0xe0, 0x03, 0x02, 0x29,
+	0x0c, 0xe5, 0x6d, 0x30, 0xe0, 0x04, 0xe5, 0x4a,
+	0x70, 0x0b, 0xe5, 0x6d, 0x30, 0xe1, 0x09, 0xe5,
+	0x4a, 0x24, 0xfe, 0x50, 0x03, 0x02, 0x29, 0x0c,
+	0x7c, 0x00, 0x12, 0x30, 0x24, 0x22, 0xb4, 0x02,
+	0x02, 0x80, 0x06, 0xd3, 0x50, 0x03, 0x02, 0x29,
+	0x0a, 0xe5, 0x4c, 0x45, 0x4b, 0x60, 0x03, 0x02,
+	0x29, 0x0c, 0xac, 0x4a, 0x12, 0x30, 0xab, 0x40,
+	0x03, 0x02, 0x29, 0x0c, 0xe5, 0x6d, 0x20, 0xe1,
+	0x07, 0xe5, 0x6d, 0x20, 0xe0, 0x02, 0x80, 0x77,
+	0xe5, 0x6d, 0x30, 0xe0, 0x06, 0xe5, 0x49, 0x60,
+	0x02, 0x80, 0x6c, 0xe5, 0x49, 0x70, 0x0f, 0x90,
+	0xff, 0x82, 0xe0, 0x54, 0xf7, 0xf0, 0x90, 0xff,
+	0x80, 0xe0, 0x54, 0xf7, 0xf0, 0x22, 0xe5, 0x49,
+	0xb4, 0x01, 0x02, 0x80, 0x03, 0xd3, 0x40, 0x09,
+	0x7d, 0x01, 0x7c, 0x03, 0x12, 0x0f, 0x09, 0x80,
+	0x11, 0xb4, 0x02, 0x02, 0x80, 0x03, 0xd3, 0x40,
+	0x09, 0x7d, 0x01, 0x7c, 0x04, 0x12, 0x0f, 0x09,
+	0x80, 0x00, 0x15, 0x49, 0x30, 0x02, 0x15, 0xe5,
+	0x49, 0x75, 0xf0, 0x08, 0xa4, 0x24, 0x48, 0xf5,
+	0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83, 0xe0, 0x54,
+	0xf7, 0xf0, 0x80, 0x13, 0xe5, 0x49, 0x75, 0xf0,
+	0x08, 0xa4, 0x24, 0x08, 0xf5, 0x82, 0xe4, 0x34,
+	0xff, 0xf5, 0x83, 0xe0, 0x54, 0xf7, 0xf0, 0x7c,
+	0x00, 0x12, 0x30, 0x24, 0x22, 0x80, 0x00, 0x02,
+	0x2c, 0x6a, 0xe5, 0x6d, 0x20, 0xe7, 0x06, 0xe5,
+	0x72, 0x45, 0x71, 0x60, 0x03, 0x02, 0x2c, 0x6a,
+	0x90, 0xff, 0x00, 0xe0, 0x54, 0x1f, 0xb4, 0x00,
+	0x02, 0x80, 0x03, 0xd3, 0x40, 0x1a, 0xe5, 0x4c,
+	0x14, 0x45, 0x4b, 0x70, 0x04, 0xe5, 0x4a, 0x60,
+	0x03, 0x02, 0x29, 0xef, 0x78, 0xad, 0xe6, 0x44,
+	0x01, 0xf6, 0x7c, 0x00, 0x12, 0x30, 0x24, 0x22,
+	0xb4, 0x01, 0x02, 0x80, 0x03, 0xd3, 0x40, 0x29,
+	0xe5, 0x6d, 0x20, 0xe1, 0x08, 0xe5, 0x6d, 0x20,
+	0xe0, 0x03, 0x02, 0x29, 0xef, 0xe5, 0x6d, 0x30,
+	0xe0, 0x04, 0xe5, 0x49, 0x70, 0x0b, 0xe5, 0x6d,
+	0x30, 0xe1, 0x08, 0xe5, 0x49, 0x24, 0xfe, 0x50,
+	0x02, 0x80, 0x7f, 0x7c, 0x00, 0x12, 0x30, 0x24,
+	0x22, 0xb4, 0x02, 0x02, 0x80, 0x03, 0xd3, 0x40,
+	0x6f, 0xe5, 0x4c, 0x45, 0x4b, 0x60, 0x02, 0x80,
+	0x69, 0xac, 0x4a, 0x12, 0x30, 0xab, 0x40, 0x02,
+	0x80, 0x60, 0xe5, 0x6d, 0x20, 0xe1, 0x07, 0xe5,
+	0x6d, 0x20, 0xe0, 0x02, 0x80, 0x54, 0xe5, 0x49,
+	0x70, 0x14, 0x30, 0x02, 0x09, 0x90, 0xff, 0x80,
+	0xe0, 0x44, 0x08, 0xf0, 0x80, 0x07, 0x90, 0xff,
+	0x82, 0xe0, 0x44, 0x08, 0xf0, 0x22, 0xe5, 0x6d,
+	0x30, 0xe1, 0x33, 0x15, 0x49, 0x30, 0x02, 0x15,
+	0xe5, 0x49, 0x75, 0xf0, 0x08, 0xa4, 0x24, 0x48,
+	0xf5, 0x82, 0xe4, 0x34, 0xff, 0xf5, 0x83, 0xe0,
+	0x44, 0x08, 0xf0, 0x80, 0x13, 0xe5, 0x49, 0x75,
+	0xf0, 0x08, 0xa4, 0x24, 0x08, 0xf5, 0x82, 0xe4,
+	0x34, 0xff, 0xf5, 0x83, 0xe0, 0x44, 0x08, 0xf0,
+	0x7c, 0x00, 0x12, 0x30, 0x24, 0x22, 0x80, 0x02,
+	0x80, 0x00, 0x02, 0x2c, 0x6a, 0xe5, 0x6d, 0x20,
+	0xe7, 0x12, 0xe5, 0x72, 0x45, 0x71, 0x70, 0x0c,
+	0xe5, 0x4a, 0x70, 0x08, 0x90, 0xff, 0x00, 0xe0,
+	0x54, 0x1f, 0x60, 0x03, 0x02, 0x2c, 0x6a, 0xe5,
+	0x4c, 0x90, 0xff, 0xff, 0xf0, 0x90, 0xff, 0xff,
+	0xe0, 0x60, 0x05, 0x43, 0x6d, 0x01, 0x80, 0x03,
+	0x53, 0x6d, 0xfe, 0x7c, 0x00, 0x12, 0x30, 0x24,
+	0x22, 0xe5, 0x6d, 0x30, 0xe7, 0x0e, 0xe5, 0x72,
+	0x45, 0x71, 0x60, 0x08, 0x90, 0xff, 0x00, 0xe0,
+	0x54, 0x1f, 0x60, 0x03, 0x02, 0x2c, 0x6a, 0xad,
+	0x4b, 0xe5, 0x4c, 0xed, 0x7d, 0x00, 0xfc, 0x7d,
+	0x00, 0xfc, 0xbd, 0x00, 0x02, 0x80, 0x03, 0x02,
+	0x2b, 0x88, 0xb4, 0x01, 0x02, 0x80, 0x03, 0xd3,
+	0x40, 0x32, 0xe5, 0x4a, 0x70, 0x05, 0xe5, 0x4c,
+	0xfc, 0x60, 0x03, 0x02, 0x2b, 0x8a, 0x75, 0x6a,
+	0x40, 0x75, 0x69, 0xf8, 0x75, 0x68, 0x01, 0xd3,
+	0xe5, 0x72, 0x94, 0x12, 0xe5, 0x71, 0x94, 0x00,
+	0x40, 0x06, 0xe4, 0xfd, 0x7c, 0x12, 0x80, 0x04,
+	0xac, 0x72, 0xad, 0x71, 0x8c, 0x70, 0x8d, 0x6f,
+	0x12, 0x30, 0x39, 0x22, 0xb4, 0x02, 0x02, 0x80,
+	0x03, 0xd3, 0x40, 0x59, 0xe5, 0x4a, 0x60, 0x03,
+	0x02, 0x2b, 0x8a, 0xe5, 0x4c, 0xfc, 0x70, 0x27,
+	0x75, 0x6a, 0x52, 0x75, 0x69, 0xf8, 0x75, 0x68,
+	0x01, 0xd3, 0xe5, 0x72, 0x94, 0x19, 0xe5, 0x71,
+	0x94, 0x00, 0x40, 0x06, 0xe4, 0xfd, 0x7c, 0x19,
+	0x80, 0x04, 0xac, 0x72, 0xad, 0x71, 0x8c, 0x70,
+	0x8d, 0x6f, 0x12, 0x30, 0x39, 0x80, 0x25, 0x75,
+	0x6a, 0x6b, 0x75, 0x69, 0xf8, 0x75, 0x68, 0x01,
+	0xd3, 0xe5, 0x72, 0x94, 0x27, 0xe5, 0x71, 0x94,
+	0x00, 0x40, 0x06, 0xe4, 0xfd, 0x7c, 0x27, 0x80,
+	0x04, 0xac, 0x72, 0xad, 0x71, 0x8c, 0x70, 0x8d,
+	0x6f, 0x12, 0x30, 0x39, 0x22, 0xb4, 0x03, 0x02,
+	0x80, 0x06, 0xd3, 0x50, 0x03, 0x02, 0x2b, 0x88,
+	0xe5, 0x4c, 0xf5, 0x49, 0x70, 0x0f, 0x90, 0xff,
+	0x04, 0xe0, 0xfd, 0xa3, 0xe0, 0x4d, 0x60, 0x03,
+	0x02, 0x2b, 0x8a, 0x80, 0x18, 0x90, 0xfb, 0x02,
+	0xe0, 0xfd, 0xa3, 0xe0, 0xfc, 0x90, 0xff, 0x05,
+	0xe0, 0x6c, 0x70, 0x07, 0x90, 0xff, 0x04, 0xe0,
+	0x6d, 0x60, 0x02, 0x80, 0x68, 0xe4, 0xf5, 0x70,
+	0xf5, 0x6f, 0x7f, 0x00, 0xe5, 0x49, 0x14, 0xc5,
+	0x49, 0x60, 0x0f, 0xef, 0x24, 0x00, 0xf5, 0x82,
+	0xe4, 0x34, 0xfb, 0xf5, 0x83, 0xe0, 0x2f, 0xff,
+	0x80, 0xea, 0x8f, 0x4a, 0xe5, 0x4a, 0x24, 0x00,
+	0xf5, 0x82, 0xe4, 0x34, 0xfb, 0xf5, 0x83, 0xe0,
+	0x7d, 0x00, 0xd3, 0x95, 0x72, 0xed, 0x95, 0x71,
+	0x40, 0x06, 0xac, 0x72, 0xad, 0x71, 0x80, 0x0f,
+	0xe5, 0x4a, 0x24, 0x00, 0xf5, 0x82, 0xe4, 0x34,
+	0xfb, 0xf5, 0x83, 0xe0, 0x7d, 0x00, 0xfc, 0x8c,
+	0x70, 0x8d, 0x6f, 0xe5, 0x4a, 0x24, 0x00, 0xfc,
+	0xe4, 0x34, 0xfb, 0xfd, 0xfe, 0xec, 0xfd, 0x7f,
+	0x01, 0x8d, 0x6a, 0x8e, 0x69, 0x8f, 0x68, 0x12,
+	0x30, 0x39, 0x22, 0x80, 0x00, 0x02, 0x2c, 0x6a,
+	0x02, 0x2c, 0x6a, 0xe5, 0x6d, 0x30, 0xe7, 0x19,
+	0xe5, 0x72, 0x14, 0x45, 0x71, 0x70, 0x12, 0xe5,
+	0x4a, 0x70, 0x0e, 0xe5, 0x4c, 0x45, 0x4b, 0x70,
+	0x08, 0x90, 0xff, 0x00, 0xe0, 0x54, 0x1f, 0x60,
+	0x03, 0x02, 0x2c, 0x6a, 0xe5, 0x6d, 0x20, 0xe0,
+	0x08, 0xe5, 0x6d, 0x20, 0xe1, 0x03, 0x02, 0x2c,
+	0x6a, 0x75, 0x6a, 0x6e, 0xe4, 0xf5, 0x69, 0xf5,
+	0x68, 0xe4, 0xf5, 0x6f, 0x04, 0xf5, 0x70, 0x12,
+	0x30, 0x39, 0x22, 0xe5, 0x6d, 0x20, 0xe7, 0x12,
+	0xe5, 0x72, 0x45, 0x71, 0x70, 0x0c, 0xe5, 0x4a,
+	0x70, 0x08, 0x90, 0xff, 0x00, 0xe0, 0x54, 0x1f,
+	0x60, 0x03, 0x02, 0x2c, 0x6a, 0xe5, 0x6d, 0x20,
+	0xe0, 0x07, 0xe5, 0x6d, 0x20, 0xe1, 0x02, 0x80,
+	0x74, 0x85, 0x4c, 0x6e, 0xe5, 0x6e, 0x70, 0x08,
+	0x43, 0x6d, 0x01, 0x53, 0x6d, 0xfd, 0x80, 0x06,
+	0x53, 0x6d, 0xfe, 0x43, 0x6d, 0x02, 0x7c, 0x00,
+	0x12, 0x30, 0x24, 0x22, 0xe5, 0x6d, 0x30, 0xe7,
+	0x1a, 0xe5, 0x72, 0x14, 0x45, 0x71, 0x70, 0x13,
+	0xe5, 0x4a, 0x70, 0x0f, 0xe5, 0x4c, 0x45, 0x4b,
+	0x70, 0x09, 0x90, 0xff, 0x00, 0xe0, 0x54, 0x1f,
+	0x14, 0x60, 0x02, 0x80, 0x38, 0xe5, 0x6d, 0x20,
+	0xe1, 0x02, 0x80, 0x31, 0x7c, 0x01, 0x12, 0x30,
+	0x24, 0x22, 0xe5, 0x6d, 0x20, 0xe7, 0x15, 0xe5,
+	0x72, 0x45, 0x71, 0x70, 0x0f, 0xe5, 0x4c, 0x45,
+	0x4b, 0x70, 0x09, 0x90, 0xff, 0x00, 0xe0, 0x54,
+	0x1f, 0x14, 0x60, 0x02, 0x80, 0x0f, 0xe5, 0x6d,
+	0x20, 0xe1, 0x02, 0x80, 0x08, 0x7c, 0x00, 0x12,
+	0x30, 0x24, 0x22, 0x80, 0x00, 0x02, 0x2f, 0x2b,
+	0xb4, 0x40, 0x02, 0x80, 0x06, 0xd3, 0x50, 0x03,
+	0x02, 0x2f, 0x21, 0x90, 0xff, 0x01, 0xe0, 0x90,
+	0xfc, 0x35, 0xf0, 0xe5, 0x4a, 0x90, 0xfc, 0x36,
+	0xf0, 0xe4, 0x90, 0xfc, 0x37, 0xf0, 0xe5, 0x6a,
+	0x24, 0x03, 0xf5, 0x6a, 0xe5, 0x69, 0x34, 0x00,
+	0xf5, 0x69, 0xad, 0x4b, 0xe5, 0x4c, 0x85, 0x6a,
+	0x82, 0x85, 0x69, 0x83, 0xcd, 0xf0, 0xa3, 0xcd,
+	0xf0, 0x90, 0xff, 0x01, 0xe0, 0x12, 0x01, 0xb7,
+	0x2c, 0xd8, 0x01, 0x2c, 0xfe, 0x02, 0x2d, 0x28,
+	0x03, 0x2d, 0x52, 0x04, 0x2d, 0xa0, 0x05, 0x2d,
+	0xdd, 0x06, 0x2e, 0x03, 0x07, 0x2e, 0x29, 0x08,
+	0x2e, 0x55, 0x09, 0x2e, 0x7b, 0x0b, 0x2e, 0xa1,
+	0x0c, 0x2e, 0xb0, 0x80, 0x2e, 0xb0, 0x81, 0x00,
+	0x00, 0x2f, 0x0e, 0xe5, 0x6d, 0x20, 0xe7, 0x06,
+	0x7c, 0x05, 0x12, 0x25, 0xbf, 0x22, 0x7d, 0x24,
+	0x7e, 0x35, 0x7f, 0x02, 0x79, 0x38, 0x7a, 0xfc,
+	0x7b, 0x01, 0x74, 0x08, 0x78, 0x00, 0x12, 0x03,
+	0x3f, 0x7d, 0x08, 0x7c, 0x00, 0x12, 0x25, 0x26,
+	0x22, 0xe5, 0x6d, 0x20, 0xe7, 0x06, 0x7c, 0x05,
+	0x12, 0x25, 0xbf, 0x22, 0xe5, 0x4a, 0xb4, 0x03,
+	0x00, 0x40, 0x10, 0xb4, 0x05, 0x00, 0x50, 0x0b,
+	0xe5, 0x4a, 0x7f, 0x00, 0xfe, 0x7c, 0x10, 0x12,
+	0x31, 0xfb, 0x22, 0x7d, 0x00, 0x7c, 0x07, 0x12,
+	0x25, 0x26, 0x22, 0xe5, 0x6d, 0x20, 0xe7, 0x06,
+	0x7c, 0x05, 0x12, 0x25, 0xbf, 0x22, 0xe5, 0x4a,
+	0xb4, 0x03, 0x00, 0x40, 0x10, 0xb4, 0x05, 0x00,
+	0x50, 0x0b, 0xe5, 0x4a, 0x7f, 0x00, 0xfe, 0x7c,
+	0x11, 0x12, 0x31, 0xfb, 0x22, 0x7d, 0x00, 0x7c,
+	0x07, 0x12, 0x25, 0x26, 0x22, 0xe5, 0x6d, 0x20,
+	0xe7, 0x06, 0x7c, 0x05, 0x12, 0x25, 0xbf, 0x22,
+	0xe5, 0x4a, 0xb4, 0x05, 0x02, 0x80, 0x03, 0xd3,
+	0x40, 0x0a, 0xe4, 0xff, 0x04, 0xfe, 0x7c, 0x0a,
+	0x12, 0x31, 0xfb, 0x22, 0xb4, 0x01, 0x02, 0x80,
+	0x03, 0xd3, 0x40, 0x0a, 0xe4, 0xff, 0x04, 0xfe,
+	0x7c, 0x08, 0x12, 0x31, 0xfb, 0x22, 0xb4, 0x03,
+	0x00, 0x40, 0x10, 0xb4, 0x05, 0x00, 0x50, 0x0b,
+	0xe5, 0x4a, 0x7f, 0x00, 0xfe, 0x7c, 0x13, 0x12,
+	0x31, 0xfb, 0x22, 0x7d, 0x00, 0x7c, 0x07, 0x12,
+	0x25, 0x26, 0x22, 0xe5, 0x6d, 0x20, 0xe7, 0x34,
+	0xd3, 0xe5, 0x72, 0x94, 0x48, 0xe5, 0x71, 0x94,
+	0x00, 0x50, 0x06, 0xe5, 0x72, 0x45, 0x71, 0x70,
+	0x06, 0x7c, 0x02, 0x12, 0x25, 0xbf, 0x22, 0xe5,
+	0x4a, 0xb4, 0x01, 0x03, 0xb3, 0x40, 0x0b, 0xc3,
+	0xb4, 0x03, 0x00, 0x40, 0x09, 0xb4, 0x06, 0x00,
+	0x50, 0x04, 0x12, 0x30, 0xd1, 0x22, 0x7c, 0x07,
+	0x12, 0x25, 0xbf, 0x22, 0x12, 0x25, 0x5d, 0x22,
+	0xe5, 0x6d, 0x20, 0xe7, 0x1d, 0xe5, 0x4a, 0xb4,
+	0x03, 0x00, 0x40, 0x10, 0xb4, 0x05, 0x00, 0x50,
+	0x0b, 0xe5, 0x4a, 0x7f, 0x00, 0xfe, 0x7c, 0x16,
+	0x12, 0x31, 0xfb, 0x22, 0x7c, 0x07, 0x12, 0x25,
+	0xbf, 0x22, 0x12, 0x25, 0x5d, 0x22, 0xe5, 0x6d,
+	0x20, 0xe7, 0x1d, 0xe5, 0x4a, 0xb4, 0x03, 0x00,
+	0x40, 0x10, 0xb4, 0x05, 0x00, 0x50, 0x0b, 0xe5,
+	0x4a, 0x7f, 0x00, 0xfe, 0x7c, 0x19, 0x12, 0x31,
+	0xfb, 0x22, 0x7c, 0x07, 0x12, 0x25, 0xbf, 0x22,
+	0x12, 0x25, 0x5d, 0x22, 0xe5, 0x6d, 0x20, 0xe7,
+	0x23, 0x74, 0x81, 0x90, 0xff, 0x93, 0xf0, 0xe5,
+	0x4a, 0xb4, 0x03, 0x00, 0x40, 0x10, 0xb4, 0x05,
+	0x00, 0x50, 0x0b, 0xe5, 0x4a, 0x7f, 0x00, 0xfe,
+	0x7c, 0x17, 0x12, 0x31, 0xfb, 0x22, 0x7c, 0x07,
+	0x12, 0x25, 0xbf, 0x22, 0x12, 0x25, 0x5d, 0x22,
+	0xe5, 0x6d, 0x20, 0xe7, 0x1d, 0xe5, 0x4a, 0xb4,
+	0x03, 0x00, 0x40, 0x10, 0xb4, 0x05, 0x00, 0x50,
+	0x0b, 0xe5, 0x4a, 0x7f, 0x00, 0xfe, 0x7c, 0x18,
+	0x12, 0x31, 0xfb, 0x22, 0x7c, 0x07, 0x12, 0x25,
+	0xbf, 0x22, 0x12, 0x25, 0x5d, 0x22, 0xe5, 0x6d,
+	0x20, 0xe7, 0x1d, 0xe5, 0x4a, 0xb4, 0x03, 0x00,
+	0x40, 0x10, 0xb4, 0x05, 0x00, 0x50, 0x0b, 0xe5,
+	0x4a, 0x7f, 0x00, 0xfe, 0x7c, 0x15, 0x12, 0x31,
+	0xfb, 0x22, 0x7c, 0x07, 0x12, 0x25, 0xbf, 0x22,
+	0x12, 0x25, 0x5d, 0x22, 0xe5, 0x6d, 0x20, 0xe7,
+	0x06, 0x7c, 0x07, 0x12, 0x25, 0xbf, 0x22, 0x12,
+	0x25, 0x5d, 0x22, 0xe5, 0x6d, 0x30, 0xe7, 0x20,
+	0x90, 0xff, 0x00, 0xe0, 0x54, 0x1f, 0x70, 0x10,
+	0x90, 0xff, 0x01, 0xe0, 0xb4, 0x80, 0x05, 0x12,
+	0x25, 0x54, 0x80, 0x03, 0x12, 0x25, 0x5d, 0x22,
+	0x7d, 0x00, 0x7c, 0x05, 0x12, 0x25, 0x26, 0x22,
+	0x90, 0xff, 0x00, 0xe0, 0x54, 0x1f, 0x60, 0x06,
+	0x7c, 0x05, 0x12, 0x25, 0xbf, 0x22, 0xd3, 0xe5,
+	0x72, 0x94, 0x48, 0xe5, 0x71, 0x94, 0x00, 0x50,
+	0x0b, 0xc3, 0xe5, 0x72, 0x94, 0x07, 0xe5, 0x71,
+	0x94, 0x00, 0x50, 0x06, 0x7c, 0x03, 0x12, 0x25,
+	0xbf, 0x22, 0xe5, 0x4a, 0xb4, 0x05, 0x04, 0x12,
+	0x30, 0xd1, 0x22, 0x7c, 0x07, 0x12, 0x25, 0xbf,
+	0x22, 0xe5, 0x6d, 0x30, 0xe7, 0x08, 0x7d, 0x00,
+	0x7c, 0x05, 0x12, 0x25, 0x26, 0x22, 0x7c, 0x05,
+	0x12, 0x25, 0xbf, 0x22, 0xb4, 0x20, 0x02, 0x80,
+	0x03, 0xd3, 0x40, 0x00, 0x80, 0x00, 0x12, 0x2f,
+	0xff, 0x22, 0x75, 0x43, 0x00, 0x90, 0xff, 0x83,
+	0xe0, 0x54, 0x0f, 0xd3, 0x95, 0x43, 0x40, 0x24,
+	0xe5, 0x43, 0x24, 0xf0, 0xf5, 0x82, 0xe4, 0x34,
+	0xfe, 0xf5, 0x83, 0xe0, 0xad, 0x6a, 0xae, 0x69,
+	0xaf, 0x68, 0x12, 0x03, 0x0f, 0x05, 0x43, 0x0d,
+	0xed, 0x70, 0x01, 0x0e, 0x8d, 0x6a, 0x8e, 0x69,
+	0x8f, 0x68, 0x80, 0xd1, 0xe5, 0x43, 0x7d, 0x00,
+	0xfc, 0xc3, 0xe5, 0x70, 0x9c, 0xf5, 0x70, 0xe5,
+	0x6f, 0x9d, 0xf5, 0x6f, 0xe5, 0x70, 0x45, 0x6f,
+	0x60, 0x06, 0xe4, 0x90, 0xff, 0x83, 0xf0, 0x22,
+	0x90, 0xff, 0x82, 0xe0, 0x44, 0x08, 0xf0, 0xe4,
+	0xf5, 0x6f, 0x75, 0x70, 0x49, 0x90, 0xfc, 0x35,
+	0xe0, 0xb4, 0x05, 0x02, 0x80, 0x03, 0xd3, 0x40,
+	0x40, 0x90, 0xfc, 0x36, 0xe0, 0xf5, 0x43, 0xb4,
+	0x05, 0x02, 0x80, 0x03, 0xd3, 0x40, 0x0a, 0xe4,
+	0xff, 0x04, 0xfe, 0x7c, 0x0b, 0x12, 0x31, 0xfb,
+	0x22, 0xb4, 0x01, 0x02, 0x80, 0x03, 0xd3, 0x40,
+	0x0a, 0xe4, 0xff, 0x04, 0xfe, 0x7c, 0x09, 0x12,
+	0x31, 0xfb, 0x22, 0xb4, 0x03, 0x00, 0x40, 0x10,
+	0xb4, 0x05, 0x00, 0x50, 0x0b, 0xe5, 0x43, 0x7f,
+	0x00, 0xfe, 0x7c, 0x14, 0x12, 0x31, 0xfb, 0x22,
+	0x22, 0xb4, 0x80, 0x00, 0x40, 0x23, 0xb4, 0x82,
+	0x00, 0x50, 0x1e, 0x7c, 0x35, 0x7d, 0xfc, 0x12,
+	0x17, 0x7e, 0x7d, 0x00, 0x8c, 0x6c, 0x8d, 0x6b,
+	0x90, 0xfc, 0x37, 0xe0, 0x60, 0x05, 0x12, 0x2f,
+	0xff, 0x80, 0x05, 0x7c, 0x00, 0x12, 0x30, 0x24,
+	0x22, 0x22, 0x90, 0xff, 0x83, 0xe0, 0x54, 0x7f,
+	0xf0, 0x90, 0xff, 0x82, 0xe0, 0x44, 0x08, 0xf0,
+	0x90, 0xff, 0x80, 0xe0, 0x44, 0x08, 0xf0, 0x22,
+	0x90, 0xff, 0x82, 0xe0, 0x44, 0x08, 0xf0, 0x90,
+	0xff, 0x80, 0xe0, 0x44, 0x08, 0xf0, 0x22, 0x8c,
+	0x23, 0x7d, 0x00, 0x8c, 0x70, 0x8d, 0x6f, 0x75,
+	0x6a, 0x35, 0x75, 0x69, 0xfc, 0x75, 0x68, 0x01,
+	0x12, 0x30, 0x39, 0x22, 0x90, 0xff, 0x83, 0xe0,
+	0x54, 0x7f, 0xf0, 0xe5, 0x70, 0x64, 0x49, 0x45,
+	0x6f, 0x70, 0x01, 0x22, 0xc3, 0xe5, 0x70, 0x94,
+	0x08, 0xe5, 0x6f, 0x94, 0x00, 0x40, 0x15, 0x75,
+	0x21, 0x08, 0xe5, 0x21, 0x7d, 0x00, 0xfc, 0xc3,
+	0xe5, 0x70, 0x9c, 0xf5, 0x70, 0xe5, 0x6f, 0x9d,
+	0xf5, 0x6f, 0x80, 0x09, 0x85, 0x70, 0x21, 0xe4,
+	0xf5, 0x6f, 0x75, 0x70, 0x49, 0x75, 0x22, 0x00,
+	0xe5, 0x22, 0xc3, 0x95, 0x21, 0x50, 0x26, 0xad,
+	0x6a, 0xae, 0x69, 0xaf, 0x68, 0x12, 0x01, 0xe6,
+	0xfc, 0xe5, 0x22, 0x24, 0xf8, 0xf5, 0x82, 0xe4,
+	0x34, 0xfe, 0xf5, 0x83, 0xec, 0xf0, 0x05, 0x22,
+	0x0d, 0xed, 0x70, 0x01, 0x0e, 0x8d, 0x6a, 0x8e,
+	0x69, 0x8f, 0x68, 0x80, 0xd3, 0xe5, 0x21, 0x54,
+	0x7f, 0x90, 0xff, 0x81, 0xf0, 0x22, 0x8c, 0x48,
+	0x7f, 0x00, 0xef, 0x24, 0xfd, 0x40, 0x19, 0xe4,
+	0xef, 0x75, 0xf0, 0x07, 0xa4, 0x24, 0x7f, 0xf5,
+	0x82, 0xe4, 0x34, 0xf8, 0xf5, 0x83, 0xe0, 0x65,
+	0x48, 0x70, 0x02, 0xd3, 0x22, 0x0f, 0x80, 0xe2,
+	0x8f, 0x47, 0xc3, 0x22, 0x85, 0x72, 0x70, 0x85,
+	0x71, 0x6f, 0x90, 0xff, 0x82, 0xe0, 0x54, 0xf7,
+	0xf0, 0x90, 0xff, 0x83, 0xe0, 0x54, 0x7f, 0xf0,
+	0x22, 0xc0, 0x00, 0xc0, 0x01, 0xc0, 0x02, 0xc0,
+	0x06, 0xc0, 0x07, 0xe5, 0x78, 0x24, 0x08, 0xf8,
+	0x86, 0x06, 0x53, 0x06, 0x7f, 0x7c, 0xff, 0x12,
+	0x31, 0x5b, 0x7c, 0x00, 0x7d, 0x00, 0xe5, 0x7b,
+	0x60, 0x46, 0xff, 0x90, 0xfd, 0x95, 0xe0, 0x54,
+	0x7f, 0x6e, 0x70, 0x0f, 0xc0, 0x83, 0xc0, 0x82,
+	0xa3, 0xe0, 0xfd, 0xa3, 0xe0, 0xfc, 0xa3, 0x15,
+	0x7b, 0x80, 0x07, 0xa3, 0xa3, 0xa3, 0xdf, 0xe6,
+	0x80, 0x26, 0xdf, 0x06, 0xd0, 0x82, 0xd0, 0x83,
+	0x80, 0x1e, 0xe0, 0xf8, 0xa3, 0xe0, 0xf9, 0xa3,
+	0xe0, 0xfa, 0xd0, 0x82, 0xd0, 0x83, 0xe8, 0xf0,
+	0xa3, 0xe9, 0xf0, 0xa3, 0xea, 0xf0, 0xa3, 0xc0,
+	0x83, 0xc0, 0x82, 0xa3, 0xa3, 0xa3, 0x80, 0xda,
+	0x12, 0x31, 0xf4, 0xd0, 0x07, 0xd0, 0x06, 0xd0,
+	0x02, 0xd0, 0x01, 0xd0, 0x00, 0x22, 0x85, 0xa8,
+	0x7a, 0x75, 0xa8, 0x88, 0xec, 0x70, 0x02, 0x7c,
+	0x3f, 0x8c, 0x79, 0x22, 0xe5, 0x78, 0x24, 0x08,
+	0xf8, 0x76, 0x00, 0x12, 0x32, 0x48, 0x80, 0xfb,
+	0xc0, 0x00, 0xc0, 0x01, 0xc0, 0x02, 0xc0, 0x06,
+	0xc0, 0x07, 0xae, 0x04, 0x7c, 0xff, 0x12, 0x31,
+	0x5b, 0xe5, 0x7b, 0x60, 0x42, 0xff, 0x90, 0xfd,
+	0x95, 0xe0, 0x54, 0x7f, 0x6e, 0x70, 0x0b, 0xc0,
+	0x83, 0xc0, 0x82, 0xa3, 0xa3, 0xa3, 0x15, 0x7b,
+	0x80, 0x07, 0xa3, 0xa3, 0xa3, 0xdf, 0xea, 0x80,
+	0x26, 0xdf, 0x06, 0xd0, 0x82, 0xd0, 0x83, 0x80,
+	0xd8, 0xe0, 0xf8, 0xa3, 0xe0, 0xf9, 0xa3, 0xe0,
+	0xfa, 0xd0, 0x82, 0xd0, 0x83, 0xe8, 0xf0, 0xa3,
+	0xe9, 0xf0, 0xa3, 0xea, 0xf0, 0xa3, 0xc0, 0x83,
+	0xc0, 0x82, 0xa3, 0xa3, 0xa3, 0x80, 0xda, 0x78,
+	0x08, 0x08, 0x79, 0x18, 0x09, 0x7c, 0x01, 0xe6,
+	0x54, 0x7f, 0x6e, 0x70, 0x06, 0x76, 0x00, 0x77,
+	0x00, 0x80, 0x06, 0x08, 0x09, 0x0c, 0xbc, 0x08,
+	0xee, 0x12, 0x31, 0xf4, 0xd0, 0x07, 0xd0, 0x06,
+	0xd0, 0x02, 0xd0, 0x01, 0xd0, 0x00, 0x22, 0x75,
+	0x79, 0x00, 0x85, 0x7a, 0xa8, 0x22, 0xc0, 0xf0,
+	0xc0, 0x82, 0xc0, 0x83, 0xc3, 0xe5, 0x7b, 0x24,
+	0xe8, 0x50, 0x05, 0x12, 0x32, 0x48, 0x80, 0xf4,
+	0xec, 0x60, 0x31, 0x90, 0x35, 0x23, 0xe4, 0x93,
+	0xc3, 0x9c, 0x40, 0x28, 0xc0, 0x04, 0x7c, 0xff,
+	0x12, 0x31, 0x5b, 0xd0, 0x04, 0x43, 0x04, 0x80,
+	0xe5, 0x7b, 0x75, 0xf0, 0x03, 0xa4, 0x24, 0x95,
+	0xf5, 0x82, 0xe4, 0x34, 0xfd, 0xf5, 0x83, 0xec,
+	0xf0, 0xef, 0xa3, 0xf0, 0xee, 0xa3, 0xf0, 0x05,
+	0x7b, 0x12, 0x31, 0xf4, 0xd0, 0x83, 0xd0, 0x82,
+	0xd0, 0xf0, 0x22, 0xc0, 0x04, 0x7c, 0x20, 0xd2,
+	0x8c, 0xd2, 0x8d, 0xd5, 0x04, 0xfd, 0xd0, 0x04,
+	0x22, 0x75, 0xa8, 0x00, 0x75, 0x88, 0x00, 0x75,
+	0xb8, 0x00, 0x75, 0xf0, 0x00, 0x75, 0xd0, 0x00,
+	0xe4, 0xf8, 0x90, 0x00, 0x00, 0xf6, 0x08, 0xb8,
+	0x00, 0xfb, 0x02, 0x00, 0x00, 0xc3, 0xed, 0x94,
+	0x02, 0x50, 0x04, 0x7d, 0x03, 0x7c, 0xe8, 0xec,
+	0xf4, 0xfc, 0xed, 0xf4, 0xfd, 0x0c, 0xbc, 0x00,
+	0x01, 0x0d, 0x8c, 0x7f, 0x8d, 0x7e, 0x22, 0xc3,
+	0xec, 0x94, 0xbc, 0xed, 0x94, 0x02, 0x50, 0x04,
+	0x7d, 0x07, 0x7c, 0xd0, 0xec, 0xf4, 0xfc, 0xed,
+	0xf4, 0xfd, 0x0c, 0xbc, 0x00, 0x01, 0x0d, 0x8c,
+	0x7d, 0x8d, 0x7c, 0x22, 0xec, 0x70, 0x01, 0x22,
+	0xc0, 0x00, 0xe5, 0x78, 0x24, 0x18, 0xf8, 0xa6,
+	0x04, 0xe5, 0x78, 0x24, 0x08, 0xf8, 0xc6, 0x54,
+	0x7f, 0xf6, 0xe6, 0x30, 0xe7, 0x03, 0xd0, 0x00,
+	0x22, 0x12, 0x32, 0x48, 0x80, 0xf4, 0xc2, 0x8c,
+	0x85, 0x7c, 0x8c, 0x85, 0x7d, 0x8a, 0xd2, 0x8c,
+	0xc0, 0xe0, 0xc0, 0xd0, 0xc0, 0xf0, 0xc0, 0x82,
+	0xc0, 0x83, 0xc0, 0x00, 0xc0, 0x01, 0xc0, 0x02,
+	0xc0, 0x03, 0xc0, 0x04, 0xc0, 0x05, 0xc0, 0x06,
+	0xc0, 0x07, 0x12, 0x1a, 0xd1, 0xe5, 0x78, 0x24,
+	0x08, 0xf8, 0xe6, 0x60, 0x24, 0xe5, 0x78, 0x24,
+	0x10, 0xf8, 0xa6, 0x81, 0xe5, 0x78, 0x75, 0xf0,
+	0x21, 0xa4, 0x24, 0x8d, 0xf5, 0x82, 0xe4, 0x34,
+	0xfc, 0xf5, 0x83, 0x78, 0xae, 0xe5, 0x81, 0x04,
+	0xc3, 0x98, 0xf9, 0xe6, 0xf0, 0x08, 0xa3, 0xd9,
+	0xfa, 0x74, 0x08, 0x25, 0x78, 0xf8, 0x05, 0x78,
+	0x08, 0xe6, 0x54, 0x80, 0x70, 0x0c, 0xe5, 0x78,
+	0xb4, 0x07, 0xf3, 0x78, 0x08, 0x75, 0x78, 0x00,
+	0x80, 0xef, 0xe5, 0x78, 0x24, 0x10, 0xf8, 0x86,
+	0x81, 0xe5, 0x78, 0x75, 0xf0, 0x21, 0xa4, 0x24,
+	0x8d, 0xf5, 0x82, 0xe4, 0x34, 0xfc, 0xf5, 0x83,
+	0x78, 0xae, 0xe5, 0x81, 0x04, 0xc3, 0x98, 0xf9,
+	0xe0, 0xf6, 0x08, 0xa3, 0xd9, 0xfa, 0xd0, 0x07,
+	0xd0, 0x06, 0xd0, 0x05, 0xd0, 0x04, 0xd0, 0x03,
+	0xd0, 0x02, 0xd0, 0x01, 0xd0, 0x00, 0xd0, 0x83,
+	0xd0, 0x82, 0xd0, 0xf0, 0xd0, 0xd0, 0xd0, 0xe0,
+	0x32, 0xc0, 0xe0, 0xc0, 0xd0, 0xc0, 0x00, 0xc0,
+	0x01, 0xc0, 0x02, 0xc2, 0x8e, 0x85, 0x7e, 0x8d,
+	0x85, 0x7f, 0x8b, 0xd2, 0x8e, 0x78, 0x19, 0x79,
+	0x09, 0x7a, 0x07, 0xe7, 0x70, 0x04, 0xa6, 0x00,
+	0x80, 0x0b, 0xe6, 0x60, 0x08, 0x16, 0xe6, 0x70,
+	0x04, 0xe7, 0x44, 0x80, 0xf7, 0x08, 0x09, 0xda,
+	0xea, 0xe5, 0x79, 0x60, 0x13, 0x14, 0xf5, 0x79,
+	0x70, 0x0e, 0xe5, 0x78, 0x24, 0x08, 0xf8, 0x76,
+	0x00, 0x12, 0x31, 0xf4, 0xd2, 0x8c, 0xd2, 0x8d,
+	0xd0, 0x02, 0xd0, 0x01, 0xd0, 0x00, 0xd0, 0xd0,
+	0xd0, 0xe0, 0x32, 0x75, 0x81, 0xad, 0x74, 0x2a,
+	0x90, 0xff, 0x93, 0xf0, 0x75, 0x7f, 0x30, 0x75,
+	0x7e, 0xf8, 0x75, 0x7d, 0x60, 0x75, 0x7c, 0xf0,
+	0x12, 0x05, 0x36, 0x12, 0x34, 0x7c, 0x12, 0x17,
+	0x34, 0x90, 0xff, 0x93, 0xe0, 0x44, 0x01, 0xf0,
+	0xb2, 0xb3, 0x12, 0x34, 0xa6, 0x12, 0x32, 0x56,
+	0x80, 0xda, 0x22, 0xc0, 0x00, 0x7c, 0x01, 0xec,
+	0x24, 0x08, 0xf8, 0xe6, 0x60, 0x09, 0x0c, 0xbc,
+	0x08, 0xf5, 0x12, 0x32, 0x48, 0x80, 0xee, 0xd0,
+	0x00, 0x22, 0xc0, 0xf0, 0xc0, 0x82, 0xc0, 0x83,
+	0xc0, 0x00, 0xc0, 0x06, 0xc0, 0x07, 0xed, 0x24,
+	0x10, 0xf8, 0x76, 0xbc, 0xed, 0x75, 0xf0, 0x21,
+	0xa4, 0x24, 0x8d, 0xf5, 0x82, 0xe4, 0x34, 0xfc,
+	0xf5, 0x83, 0xc0, 0x82, 0xc0, 0x83, 0xa3, 0xa3,
+	0xe4, 0x78, 0x0d, 0xf0, 0xa3, 0xd8, 0xfc, 0xec,
+	0x54, 0x7f, 0x75, 0xf0, 0x02, 0xa4, 0x24, 0xef,
+	0xf5, 0x82, 0xe5, 0xf0, 0x34, 0x34, 0xf5, 0x83,
+	0xe4, 0x93, 0xfe, 0x74, 0x01, 0x93, 0xf5, 0x82,
+	0x8e, 0x83, 0xe4, 0x93, 0xfe, 0x74, 0x01, 0x93,
+	0xff, 0xd0, 0x83, 0xd0, 0x82, 0xef, 0xf0, 0xa3,
+	0xee, 0xf0, 0xed, 0x24, 0x08, 0xf8, 0xec, 0x44,
+	0x80, 0xf6, 0xd0, 0x07, 0xd0, 0x06, 0xd0, 0x00,
+	0xd0, 0x83, 0xd0, 0x82, 0xd0, 0xf0, 0x22, 0x75,
+	0x78, 0x00, 0x75, 0x7b, 0x00, 0x7a, 0x08, 0x79,
+	0x18, 0x78, 0x08, 0x76, 0x00, 0x77, 0x00, 0x08,
+	0x09, 0xda, 0xf8, 0xe4, 0x78, 0x08, 0x74, 0x80,
+	0x44, 0x7f, 0xf6, 0x74, 0x01, 0x44, 0x10, 0xf5,
+	0x89, 0x75, 0xb8, 0x08, 0xd2, 0xab, 0xd2, 0xa9,
+	0x22, 0x75, 0x81, 0xad, 0xd2, 0x8e, 0xd2, 0x8c,
+	0xd2, 0xaf, 0xe5, 0x7b, 0x60, 0x32, 0xff, 0x90,
+	0xfd, 0x95, 0xe0, 0x54, 0x80, 0x60, 0x24, 0x78,
+	0x08, 0x79, 0x08, 0xe0, 0x54, 0x7f, 0xfa, 0x7b,
+	0x00, 0xe6, 0x54, 0x7f, 0xb5, 0x02, 0x02, 0x7b,
+	0xff, 0x08, 0xd9, 0xf5, 0xeb, 0x70, 0x0c, 0xea,
+	0xf0, 0x12, 0x33, 0xf8, 0xad, 0x04, 0xac, 0x02,
+	0x12, 0x34, 0x0f, 0xa3, 0xa3, 0xa3, 0xdf, 0xd2,
+	0x12, 0x32, 0x48, 0x80, 0xc5, 0x7c, 0x01, 0x7d,
+	0x00, 0x22, 0x04, 0xf5, 0x04, 0xe9, 0x04, 0xed,
+	0x04, 0xe1, 0x04, 0xdd, 0x04, 0xd9, 0x04, 0xe5,
+	0x04, 0xf1, 0x04, 0x9d, 0x04, 0xa1, 0x04, 0xcd,
+	0x04, 0xd1, 0x04, 0x99, 0x04, 0x99, 0x04, 0x99,
+	0x04, 0xd5, 0x04, 0xb5, 0x04, 0xad, 0x04, 0xb1,
+	0x04, 0xa9, 0x04, 0xc1, 0x04, 0xbd, 0x04, 0xb9,
+	0x04, 0xc5, 0x04, 0xc9, 0x04, 0xa5, 0x19, 0x01,
+	0x03, 0x00, 0x22, 0x00, 0x48, 0x02, 0x00, 0x48,
+	0x0e, 0x30, 0x14, 0x20, 0xc8, 0x1a, 0xd0, 0x18,
+	0x0a, 0x0c, 0x05, 0x06, 0x02, 0x03, 0x01, 0x02,
+	0x00, 0x01, 0xce, 0x01, 0x81, 0x01, 0x00, 0x00,
+	0xc0, 0x00, 0x80, 0x00, 0x60, 0x00, 0x30, 0x00,
+	0x18, 0x00, 0x10, 0x00, 0x08, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x01, 0x00, 0x08, 0x18, 0x38, 0x28,
+	0x0c, 0x05, 0x10, 0x0a, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x01, 0x10, 0x0a, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfb, 0xe0, 0xfb, 0xf2,
+	0x09, 0x02, 0x27, 0x00, 0x01, 0x02, 0x00, 0xa0,
+	0x32, 0x09, 0x04, 0x00, 0x00, 0x03, 0xff, 0x00,
+	0x00, 0x00, 0x07, 0x05, 0x81, 0x02, 0x40, 0x00,
+	0x00, 0x07, 0x05, 0x01, 0x02, 0x40, 0x00, 0x00,
+	0x07, 0x05, 0x83, 0x03, 0x02, 0x00, 0x01, 0x22,
+	0x03, 0x54, 0x00, 0x55, 0x00, 0x53, 0x00, 0x42,
+	0x00, 0x33, 0x00, 0x34, 0x00, 0x31, 0x00, 0x30,
+	0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20,
+	0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const struct ti3410_fw ti3410_fw = {
+	.data		= ti3410_fw_image,
+	.size		= sizeof(ti3410_fw_image)
+};
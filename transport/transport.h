@@ -65,6 +65,12 @@ struct transport_class {
 	 */
 	int (*suspend)(transport_t tr);
 	int (*resume)(transport_t tr);
+
+	/* Optional: fetch the serial number of the device which was
+	 * opened, as a nul-terminated string. Returns 0 on success, or
+	 * -1 if it isn't known.
+	 */
+	int (*get_serial)(transport_t tr, char *buf, int max_len);
 };
 
 struct transport {
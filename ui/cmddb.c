@@ -293,6 +293,21 @@ const struct cmddb_record commands[] = {
 "cgraph <address> <length> [function]\n"
 "    Analyse the range given and produce a call graph. Displays a summary\n"
 "    of all functions if no function address is given.\n"
+	},
+	{
+		.name = "wcet",
+		.func = cmd_wcet,
+		.help =
+"wcet <address> <length> [options ...]\n"
+"    Bound the worst-case execution time, in cycles, of each function in\n"
+"    the range, and list them from longest to shortest. Options are:\n"
+"        cpu|cpux\n"
+"            Use MSP430 or MSP430X instruction timing.\n"
+"        loop <address> <count>\n"
+"            The loop starting at the given address runs its first\n"
+"            instruction at most <count> times.\n"
+"        irq <address>\n"
+"            Treat the given address as an interrupt handler.\n"
 	},
 	{
 		.name = "exit",
@@ -350,10 +365,24 @@ const struct cmddb_record commands[] = {
 "    Show all power data, optionally specifying a granularity in us.\n"
 "power session <N> [granularity]\n"
 "    Show data only for the specified session.\n"
+"power range <N> [t0 [t1]]\n"
+"    Show minimum, peak and average current over a time range in us.\n"
+"power summary <N> <buckets> [t0 [t1]]\n"
+"    Show current over a time range, divided into equal buckets.\n"
 "power export-csv <N> <filename>\n"
 "    Write session data for the given session to a CSV file.\n"
+"power export-bin <N> <filename>\n"
+"    Write session data for the given session to a binary file.\n"
 "power profile\n"
 "    List power profile data by symbol.\n"
+"power spill <filename>\n"
+"    Keep all power data from now on in a capture file.\n"
+"power spill-close\n"
+"    Finish writing the capture file.\n"
+"power stream <path>\n"
+"    Send power data, as it arrives, to a FIFO or Unix socket.\n"
+"power stream-close\n"
+"    Stop sending power data.\n"
 	},
 #ifndef NO_SHELLCMD
 	{
@@ -0,0 +1,462 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009-2012 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+
+#ifndef __Windows__
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#endif
+
+#include "daemon.h"
+#include "sockets.h"
+#include "output.h"
+#include "reader.h"
+#include "ctrlc.h"
+#include "vector.h"
+#include "util.h"
+
+#ifndef __Windows__
+
+/* Longest line accepted in either direction */
+#define MAX_LINE_LENGTH		8192
+
+/* Replies are sent once this much has accumulated */
+#define REPLY_CHUNK		4096
+
+struct conn {
+	SOCKET		sock;
+	int		failed;
+
+	char		in[MAX_LINE_LENGTH];
+	int		in_len;
+
+	struct vector	out;
+};
+
+static void conn_init(struct conn *c, SOCKET sock)
+{
+	c->sock = sock;
+	c->failed = 0;
+	c->in_len = 0;
+	vector_init(&c->out, 1);
+}
+
+static void conn_destroy(struct conn *c)
+{
+	closesocket(c->sock);
+	vector_destroy(&c->out);
+}
+
+/* This may be called while output is being captured, so it mustn't
+ * print anything. Failure is recorded in the connection. A peer which
+ * has gone away is noticed here: sockets_send() doesn't raise SIGPIPE.
+ */
+static int conn_flush(struct conn *c)
+{
+	int sent = 0;
+
+	while (!c->failed && sent < c->out.size) {
+		ssize_t r = sockets_send(c->sock, (char *)c->out.ptr + sent,
+					 c->out.size - sent, 0);
+
+		if (r < 0 && errno == EINTR)
+			continue;
+
+		if (r <= 0)
+			c->failed = 1;
+		else
+			sent += r;
+	}
+
+	c->out.size = 0;
+	return c->failed ? -1 : 0;
+}
+
+static void conn_put(struct conn *c, char sigil, const char *text)
+{
+	if (c->failed)
+		return;
+
+	if (vector_push(&c->out, &sigil, 1) < 0 ||
+	    vector_push(&c->out, text, strlen(text)) < 0 ||
+	    vector_push(&c->out, "\n", 1) < 0) {
+		c->failed = 1;
+		return;
+	}
+
+	if (c->out.size >= REPLY_CHUNK)
+		conn_flush(c);
+}
+
+/* Read a line of text. Returns 0 if successful, 1 at the end of input,
+ * or -1 if an error occurs.
+ */
+static int conn_read(struct conn *c, char *buf)
+{
+	for (;;) {
+		char *nl = memchr(c->in, '\n', c->in_len);
+		ssize_t r;
+
+		if (nl) {
+			int len = nl - c->in;
+
+			memcpy(buf, c->in, len);
+			if (len > 0 && buf[len - 1] == '\r')
+				len--;
+			buf[len] = 0;
+
+			c->in_len -= nl + 1 - c->in;
+			memmove(c->in, nl + 1, c->in_len);
+			return 0;
+		}
+
+		if (c->in_len >= sizeof(c->in)) {
+			printc_err("daemon: line too long\n");
+			return -1;
+		}
+
+		r = sockets_recv(c->sock, c->in + c->in_len,
+				 sizeof(c->in) - c->in_len, 0, -1, NULL);
+		if (r < 0)
+			return -1;
+		if (!r)
+			return 1;
+
+		c->in_len += r;
+	}
+}
+
+/************************************************************************
+ * Server
+ */
+
+static void reply_capture(void *user_data, char sigil, const char *text)
+{
+	/* Shell messages are meant for an embedded front-end */
+	if (sigil == '\\')
+		return;
+
+	conn_put((struct conn *)user_data, sigil, text);
+}
+
+/* Run commands from a client until it disconnects. Returns non-zero if
+ * the daemon should stop.
+ */
+static int serve_client(SOCKET sock)
+{
+	struct conn c;
+	int stop = 0;
+
+	conn_init(&c, sock);
+
+	for (;;) {
+		char cmd[MAX_LINE_LENGTH];
+		char done[32];
+		int ret;
+
+		output_flush();
+		ret = conn_read(&c, cmd);
+		if (ret) {
+			stop = ctrlc_check();
+			break;
+		}
+
+		capture_start(reply_capture, &c);
+		ret = process_command(cmd);
+		capture_end();
+
+		/* Ctrl+C while a command runs interrupts only that
+		 * command.
+		 */
+		ctrlc_clear();
+
+		snprintf(done, sizeof(done), "done %d", ret);
+		conn_put(&c, '\\', done);
+		conn_flush(&c);
+
+		if (reader_take_exit()) {
+			stop = 1;
+			break;
+		}
+
+		if (c.failed)
+			break;
+	}
+
+	conn_destroy(&c);
+	return stop;
+}
+
+static int make_addr(struct sockaddr_un *addr, const char *path)
+{
+	if (strlen(path) >= sizeof(addr->sun_path)) {
+		printc_err("daemon: socket path too long: %s\n", path);
+		return -1;
+	}
+
+	memset(addr, 0, sizeof(*addr));
+	addr->sun_family = AF_UNIX;
+	strcpy(addr->sun_path, path);
+
+	return 0;
+}
+
+/* A socket left behind by a daemon which didn't exit cleanly is
+ * removed, but not one which is still in use.
+ */
+static int remove_stale(const struct sockaddr_un *addr)
+{
+	struct stat st;
+	SOCKET s;
+	int r;
+
+	if (stat(addr->sun_path, &st) < 0 || !S_ISSOCK(st.st_mode))
+		return 0;
+
+	s = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (SOCKET_ISERR(s))
+		return 0;
+
+	r = connect(s, (const struct sockaddr *)addr, sizeof(*addr));
+	closesocket(s);
+
+	if (!r) {
+		printc_err("daemon: %s is in use by another daemon\n",
+			   addr->sun_path);
+		return -1;
+	}
+
+	unlink(addr->sun_path);
+	return 0;
+}
+
+static SOCKET listener = -1;
+static struct sockaddr_un listener_addr;
+
+int daemon_open(const char *path)
+{
+	struct sockaddr_un addr;
+	mode_t old_mask;
+	SOCKET sock;
+	int r;
+
+	if (make_addr(&addr, path) < 0 || remove_stale(&addr) < 0)
+		return -1;
+
+	sock = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (SOCKET_ISERR(sock)) {
+		pr_error("daemon: can't create socket");
+		return -1;
+	}
+
+	/* Clients can do anything, including run shell commands, so
+	 * only the owner may connect.
+	 */
+	old_mask = umask(0077);
+	r = bind(sock, (struct sockaddr *)&addr, sizeof(addr));
+	umask(old_mask);
+
+	if (r < 0) {
+		printc_err("daemon: can't bind to %s: %s\n",
+			   path, last_error());
+		closesocket(sock);
+		return -1;
+	}
+
+	if (listen(sock, 4) < 0) {
+		pr_error("daemon: can't listen on socket");
+		closesocket(sock);
+		unlink(path);
+		return -1;
+	}
+
+	listener_addr = addr;
+	listener = sock;
+	return 0;
+}
+
+void daemon_close(void)
+{
+	if (SOCKET_ISERR(listener))
+		return;
+
+	closesocket(listener);
+	unlink(listener_addr.sun_path);
+	listener = -1;
+}
+
+int daemon_serve(void)
+{
+	printc("Listening on %s. Press Ctrl+C to stop.\n",
+	       listener_addr.sun_path);
+
+	for (;;) {
+		SOCKET client;
+
+		output_flush();
+		client = sockets_accept(listener, NULL, NULL);
+
+		if (SOCKET_ISERR(client)) {
+			if (ctrlc_check())
+				break;
+			if (errno == EINTR)
+				continue;
+
+			pr_error("daemon: failed to accept connection");
+			return -1;
+		}
+
+		if (serve_client(client))
+			break;
+	}
+
+	return 0;
+}
+
+/************************************************************************
+ * Client
+ */
+
+/* Send a command, and print its output. Returns the command's status,
+ * or -1 with the connection marked as failed if it was lost.
+ */
+static int run_remote(struct conn *c, const char *cmd)
+{
+	char line[MAX_LINE_LENGTH];
+
+	if (vector_push(&c->out, cmd, strlen(cmd)) < 0 ||
+	    vector_push(&c->out, "\n", 1) < 0)
+		c->failed = 1;
+
+	if (conn_flush(c) < 0)
+		goto fail;
+
+	while (!conn_read(c, line)) {
+		switch (line[0]) {
+		case '\\':
+			if (!strncmp(line + 1, "done ", 5))
+				return atoi(line + 6);
+			break;
+
+		case '!':
+			printc_err("%s\n", line + 1);
+			break;
+
+		case '-':
+			printc_dbg("%s\n", line + 1);
+			break;
+
+		case ':':
+			printc("%s\n", line + 1);
+			break;
+		}
+	}
+
+fail:
+	c->failed = 1;
+	printc_err("daemon: connection lost\n");
+	return -1;
+}
+
+int daemon_client(const char *path, char **cmds, int count)
+{
+	struct sockaddr_un addr;
+	struct conn c;
+	SOCKET sock;
+	int ret = 0;
+
+	if (make_addr(&addr, path) < 0)
+		return -1;
+
+	sock = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (SOCKET_ISERR(sock)) {
+		pr_error("daemon: can't create socket");
+		return -1;
+	}
+
+	if (sockets_connect(sock, (struct sockaddr *)&addr,
+			    sizeof(addr)) < 0) {
+		printc_err("daemon: can't connect to %s: %s\n",
+			   path, last_error());
+		closesocket(sock);
+		return -1;
+	}
+
+	conn_init(&c, sock);
+
+	if (count) {
+		int i;
+
+		for (i = 0; i < count; i++)
+			if (run_remote(&c, cmds[i]) < 0) {
+				ret = -1;
+				break;
+			}
+	} else {
+		char buf[MAX_LINE_LENGTH];
+
+		while (!c.failed && fgets(buf, sizeof(buf), stdin)) {
+			int len = strlen(buf);
+
+			while (len > 0 && isspace(buf[len - 1]))
+				len--;
+			buf[len] = 0;
+
+			if (run_remote(&c, buf) < 0)
+				ret = -1;
+		}
+	}
+
+	conn_destroy(&c);
+	return ret;
+}
+
+#else /* __Windows__ */
+
+int daemon_open(const char *path)
+{
+	(void)path;
+
+	printc_err("daemon: not supported on this platform\n");
+	return -1;
+}
+
+void daemon_close(void) { }
+
+int daemon_serve(void)
+{
+	return -1;
+}
+
+int daemon_client(const char *path, char **cmds, int count)
+{
+	(void)path;
+	(void)cmds;
+	(void)count;
+
+	printc_err("daemon: not supported on this platform\n");
+	return -1;
+}
+
+#endif
@@ -0,0 +1,44 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009-2012 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef DAEMON_H_
+#define DAEMON_H_
+
+/* Daemon mode keeps the device open, and accepts commands from clients
+ * over a Unix-domain socket. Clients are served one at a time. Each
+ * command is a line of text. Its output is sent back as lines prefixed
+ * with sigils, as in embedded mode, followed by a "\done <status>"
+ * line.
+ *
+ * The socket is opened by daemon_open() before the device, so that
+ * clients can connect while the device is being set up. Their commands
+ * are run once daemon_serve() is called. It returns when interrupted,
+ * or after a client runs the "exit" command. daemon_close() removes the
+ * socket.
+ */
+int daemon_open(const char *path);
+int daemon_serve(void);
+void daemon_close(void);
+
+/* Connect to a daemon and run the given commands, stopping at the first
+ * which fails. If no commands are given, they're read from stdin, and
+ * all are run. Returns 0 if all commands succeeded.
+ */
+int daemon_client(const char *path, char **cmds, int count);
+
+#endif
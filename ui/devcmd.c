@@ -24,6 +24,8 @@
 
 #include "device.h"
 #include "binfile.h"
+#include "imgcache.h"
+#include "insndb.h"
 #include "stab.h"
 #include "expr.h"
 #include "reader.h"
@@ -32,6 +34,7 @@
 #include "prog.h"
 #include "dis.h"
 #include "opdb.h"
+#include "record.h"
 
 int cmd_regs(char **arg)
 {
@@ -50,11 +53,22 @@ int cmd_regs(char **arg)
 		const struct device_breakpoint *bp =
 		    &device_default->breakpoints[i];
 
-		if ((bp->flags & DEVICE_BP_ENABLED) &&
-		    (bp->type == DEVICE_BPTYPE_BREAK) &&
-		    (bp->addr == regs[MSP430_REG_PC]))
+		if (!((bp->flags & DEVICE_BP_ENABLED) &&
+		      (bp->type == DEVICE_BPTYPE_BREAK) &&
+		      (bp->addr == regs[MSP430_REG_PC])))
+			continue;
+
+		if (record_enabled()) {
+			struct record r;
+
+			record_begin(&r, "bp-hit");
+			record_int(&r, "index", i);
+			record_int(&r, "addr", bp->addr);
+			record_end(&r);
+		} else {
 			printc("Breakpoint %d triggered (0x%04x)\n",
 				i, bp->addr);
+		}
 	}
 
 	show_regs(regs);
@@ -325,7 +339,11 @@ int cmd_run(char **arg)
 
 	printc("Running. Press Ctrl+C to interrupt...\n");
 
+	/* Anything printed while the target runs must be seen now, not
+	 * when it stops.
+	 */
 	do {
+		output_flush();
 		status = device_poll();
 	} while (status == DEVICE_STATUS_RUNNING);
 
@@ -411,7 +429,9 @@ int cmd_dis(char **arg)
 		return -1;
 	}
 
-	if (device_readmem(offset, buf, length) < 0) {
+	/* Memory which was analysed recently is probably still indexed */
+	if (insndb_read(offset, buf, length) < 0 &&
+	    device_readmem(offset, buf, length) < 0) {
 		free(buf);
 		return -1;
 	}
@@ -431,6 +451,11 @@ int cmd_dis(char **arg)
 #define IHEX_REC_SLAR 0x05
 #define IHEX_SEG(addr) (((addr) >> 16) & 0xFFFF)
 
+/* Longest possible record: start code, length, address, type, 255
+ * data bytes and checksum, and a line ending.
+ */
+#define HEXOUT_MAX_RECORD	(1 + (5 + 255) * 2 + 1)
+
 struct hexout_data {
 	FILE            *file;
 	address_t       addr;
@@ -438,6 +463,10 @@ struct hexout_data {
 	int             len;
 
 	uint16_t        segoff;
+
+	/* Formatted records, written out in large blocks */
+	char            out[16384];
+	int             out_len;
 };
 
 static int hexout_start(struct hexout_data *hexout, const char *filename)
@@ -459,37 +488,64 @@ static int hexout_start(struct hexout_data *hexout, const char *filename)
 	hexout->addr = 0;
 	hexout->len = 0;
 	hexout->segoff = 0;
+	hexout->out_len = 0;
 
 	return 0;
 }
 
-static int hexout_write(FILE *out, uint8_t type, int len, uint16_t addr,
-			const uint8_t *payload)
+static int hexout_drain(struct hexout_data *hexout)
 {
+	if (hexout->out_len &&
+	    fwrite(hexout->out, hexout->out_len, 1, hexout->file) != 1) {
+		pr_error("hexout: can't write HEX data");
+		return -1;
+	}
+
+	hexout->out_len = 0;
+	return 0;
+}
+
+static char *hexout_byte(char *p, uint8_t b)
+{
+	static const char digits[] = "0123456789ABCDEF";
+
+	p[0] = digits[b >> 4];
+	p[1] = digits[b & 15];
+	return p + 2;
+}
+
+static int hexout_write(struct hexout_data *hexout, uint8_t type, int len,
+			uint16_t addr, const uint8_t *payload)
+{
+	char *p;
 	int i;
 	int cksum = 0;
 
-	if (fprintf(out, ":%02X%04X%02X", len, addr, type) < 0)
-		goto fail;
+	if (hexout->out_len + HEXOUT_MAX_RECORD > sizeof(hexout->out) &&
+	    hexout_drain(hexout) < 0)
+		return -1;
+
+	p = hexout->out + hexout->out_len;
+	*(p++) = ':';
+	p = hexout_byte(p, len);
+	p = hexout_byte(p, addr >> 8);
+	p = hexout_byte(p, addr & 0xff);
+	p = hexout_byte(p, type);
 	cksum += len;
 	cksum += addr & 0xff;
 	cksum += addr >> 8;
 	cksum += type;
 
 	for (i = 0; i < len; i++) {
-		if (fprintf(out, "%02X", payload[i]) < 0)
-			goto fail;
+		p = hexout_byte(p, payload[i]);
 		cksum += payload[i];
 	}
 
-	if (fprintf(out, "%02X\n", ~(cksum - 1) & 0xff) < 0)
-		goto fail;
+	p = hexout_byte(p, ~(cksum - 1) & 0xff);
+	*(p++) = '\n';
 
+	hexout->out_len = p - hexout->out;
 	return 0;
-
-fail:
-	pr_error("hexout: can't write HEX data");
-	return -1;
 }
 
 static int hexout_flush(struct hexout_data *hexout)
@@ -501,7 +557,7 @@ static int hexout_flush(struct hexout_data *hexout)
 		if (segoff != hexout->segoff) {
 			uint8_t offset_data[] = {segoff >> 8, segoff & 0xff};
 
-			if (hexout_write(hexout->file, IHEX_REC_ELAR,
+			if (hexout_write(hexout, IHEX_REC_ELAR,
 				2, 0, offset_data) < 0)
 				return -1;
 			hexout->segoff = segoff;
@@ -515,7 +571,7 @@ static int hexout_flush(struct hexout_data *hexout)
 		if (IHEX_SEG(hexout->addr + writesize) != segoff)
 			writesize = 0x10000 - addr_low;
 
-		if (hexout_write(hexout->file, IHEX_REC_DATA, writesize, addr_low,
+		if (hexout_write(hexout, IHEX_REC_DATA, writesize, addr_low,
 				hexout->buf) < 0)
 			return -1;
 
@@ -602,7 +658,8 @@ int cmd_hexout(char **arg)
 	if (hexout_flush(&hexout) < 0)
 		goto fail;
 
-	if (hexout_write(hexout.file, IHEX_REC_EOF, 0, 0, NULL) < 0) {
+	if (hexout_write(&hexout, IHEX_REC_EOF, 0, 0, NULL) < 0 ||
+	    hexout_drain(&hexout) < 0) {
 		pr_error("hexout: failed to write terminator\n");
 		goto fail;
 	}
@@ -629,6 +686,7 @@ static int do_cmd_prog(char **arg, int prog_flags)
 {
 	FILE *in;
 	struct prog_data prog;
+	struct imgcache_entry *img;
 	const char *path_arg;
 	char * path;
 
@@ -651,27 +709,30 @@ static int do_cmd_prog(char **arg, int prog_flags)
                 free(path);
 		return -1;
 	}
-	free(path);
 
 	if (device_ctl(DEVICE_CTL_HALT) < 0) {
 		fclose(in);
+		free(path);
 		return -1;
 	}
 
 	prog_init(&prog, prog_flags);
 
-	if (binfile_extract(in, cmd_prog_feed, &prog) < 0) {
+	img = imgcache_open(in);
+	if (!img || imgcache_extract(img, in, cmd_prog_feed, &prog) < 0) {
 		fclose(in);
+		free(path);
 		return -1;
 	}
 
 	if ((prog_flags & PROG_WANT_ERASE) &&
-	    (binfile_info(in) & BINFILE_HAS_SYMS)) {
+	    (imgcache_info(img) & BINFILE_HAS_SYMS)) {
 		stab_clear();
-		binfile_syms(in);
+		imgcache_syms(img, in, path);
 	}
 
 	fclose(in);
+	free(path);
 
 	if (prog_flush(&prog) < 0)
 		return -1;
@@ -790,12 +851,55 @@ int cmd_delbreak(char **arg)
 	return ret;
 }
 
+static const char *const bp_type_names[] = {
+	[DEVICE_BPTYPE_BREAK]	= "break",
+	[DEVICE_BPTYPE_WATCH]	= "watch",
+	[DEVICE_BPTYPE_READ]	= "read",
+	[DEVICE_BPTYPE_WRITE]	= "write"
+};
+
+static void record_breakpoints(void)
+{
+	struct record r;
+	int i;
+
+	record_begin(&r, "breakpoints");
+	record_int(&r, "max", device_default->max_breakpoints);
+	record_array_begin(&r, "list");
+
+	for (i = 0; i < device_default->max_breakpoints; i++) {
+		const struct device_breakpoint *bp =
+			&device_default->breakpoints[i];
+		char name[128];
+
+		if (!(bp->flags & DEVICE_BP_ENABLED))
+			continue;
+
+		record_object_begin(&r, NULL);
+		record_int(&r, "index", i);
+		record_int(&r, "addr", bp->addr);
+		record_str(&r, "kind", bp_type_names[bp->type]);
+		if (print_address(bp->addr, name, sizeof(name),
+				  PRINT_ADDRESS_EXACT))
+			record_str(&r, "sym", name);
+		record_object_end(&r);
+	}
+
+	record_array_end(&r);
+	record_end(&r);
+}
+
 int cmd_break(char **arg)
 {
 	int i;
 
 	(void)arg;
 
+	if (record_enabled()) {
+		record_breakpoints();
+		return 0;
+	}
+
 	printc("%d breakpoints available:\n",
 	       device_default->max_breakpoints);
 	for (i = 0; i < device_default->max_breakpoints; i++) {
@@ -86,34 +86,77 @@ static int read_flatfile(const char *path, uint8_t **buf, address_t *len)
 	return 0;
 }
 
-static int write_flatfile(const char *path, uint8_t *buf, address_t len)
+/* Memory is saved a block at a time, so that the amount of memory
+ * used doesn't depend on the size of the range.
+ */
+#define SAVE_BLOCK_SIZE		65536
+
+static int save_flatfile(const char *path, address_t addr, address_t len)
 {
-	FILE *out;
 	char *fullpath = expand_tilde(path);
-	const char *errmsg = NULL;
+	uint8_t *buf;
+	FILE *out;
+	address_t done = 0;
 
 	if (!fullpath)
 		return -1;
 
-	out = fopen(fullpath, "wb");
-	free(fullpath);
+	buf = malloc(SAVE_BLOCK_SIZE);
+	if (!buf) {
+		printc_err("flatfile: can't allocate memory\n");
+		free(fullpath);
+		return -1;
+	}
 
+	out = fopen(fullpath, "wb");
 	if (!out) {
 		printc_err("%s: %s\n", path, last_error());
-		return -1;
+		goto fail_open;
 	}
 
-	if (len && (fwrite(buf, len, 1, out) != 1))
-		errmsg = last_error();
+	if (device_ctl(DEVICE_CTL_HALT) < 0)
+		goto fail;
 
-	if (fclose(out) != 0 && !errmsg)
-		errmsg = last_error();
+	while (done < len) {
+		address_t count = len - done;
 
-	if (errmsg) {
-		printc_err("%s: failed to write: %s\n", path, errmsg);
-		return -1;
+		if (count > SAVE_BLOCK_SIZE)
+			count = SAVE_BLOCK_SIZE;
+
+		if (device_readmem(addr + done, buf, count) != 0)
+			goto fail;
+
+		if (fwrite(buf, count, 1, out) != 1) {
+			printc_err("%s: failed to write: %s\n",
+				   path, last_error());
+			goto fail;
+		}
+
+		done += count;
+	}
+
+	if (device_ctl(DEVICE_CTL_RESET) < 0)
+		printc_err("warning: flatfile: "
+			   "failed to reset after programming\n");
+
+	if (fclose(out) != 0) {
+		printc_err("%s: failed to write: %s\n", path, last_error());
+		unlink(fullpath);
+		goto fail_open;
 	}
+
+	printc("Done, %d bytes total\n", len);
+	free(buf);
+	free(fullpath);
 	return 0;
+
+fail:
+	fclose(out);
+	unlink(fullpath);
+fail_open:
+	free(buf);
+	free(fullpath);
+	return -1;
 }
 
 static int do_flatfile(enum operation op, const char *path, address_t addr, address_t len)
@@ -123,11 +166,12 @@ static int do_flatfile(enum operation op, const char *path, address_t addr, addr
 
 	int ret = -1;
 
-	if (op == LOAD || op == VERIFY) {
-		ret = read_flatfile(path, &in_buf, &len);
-		if (ret != 0)
-			goto out;
-	}
+	if (op == SAVE)
+		return save_flatfile(path, addr, len);
+
+	ret = read_flatfile(path, &in_buf, &len);
+	if (ret != 0)
+		goto out;
 
 	if (device_ctl(DEVICE_CTL_HALT) < 0)
 		goto out;
@@ -162,8 +206,6 @@ static int do_flatfile(enum operation op, const char *path, address_t addr, addr
 			}
 		}
 		ret = 0;
-	} else if (op == SAVE) {
-		ret = write_flatfile(path, out_buf, len);
 	}
 
 	if (ret == 0)
@@ -72,11 +72,13 @@ struct monitor_buf {
 	int	trunc;
 };
 
-static void monitor_capture(void *user_data, const char *text)
+static void monitor_capture(void *user_data, char sigil, const char *text)
 {
 	struct monitor_buf *mb = (struct monitor_buf *)user_data;
 	int len = strlen(text);
 
+	(void)sigil;
+
 	if (mb->trunc)
 		return;
 
@@ -291,7 +293,10 @@ static int run(struct gdb_data *data, char *buf)
 		return gdb_send(data, "E00");
 
 	for (;;) {
-		device_status_t status = device_poll();
+		device_status_t status;
+
+		output_flush();
+		status = device_poll();
 
 		if (status == DEVICE_STATUS_ERROR)
 			return gdb_send(data, "E00");
@@ -480,6 +485,7 @@ static void gdb_reader_loop(struct gdb_data *data)
 		char buf[GDB_BUF_SIZE];
 		int len = 0;
 
+		output_flush();
 		len = gdb_read_packet(data, buf);
 		if (len < 0)
 			return;
@@ -526,6 +532,7 @@ static int gdb_server(int port)
 	}
 
 	printc("Bound to port %d. Now waiting for connection...\n", port);
+	output_flush();
 
 	len = sizeof(addr);
 	client = sockets_accept(sock, (struct sockaddr *)&addr, &len);
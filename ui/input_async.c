@@ -27,23 +27,21 @@
 
 #define MAX_LINE_LENGTH		1024
 
-typedef enum {
-	STATE_BLOCKED,
-	STATE_RECEIVING,
-	STATE_READY,
-	STATE_EOF
-} mailbox_state_t;
+/* Commands may be sent before the previous one has finished. They're
+ * held here until the command processor is ready for them, so that a
+ * "\break" following them is still seen straight away.
+ */
+#define MAX_QUEUED_LINES	16
 
 struct mailbox {
-	thread_lock_t		lock_ack;
-	thread_cond_t		cond_ack;
-	int			ack;
-
-	thread_lock_t		lock_text;
+	thread_lock_t		lock;
 	thread_cond_t		cond_text;
-	int			text_len;
+	thread_cond_t		cond_space;
+
+	int			head;
+	int			count;
 	int			text_eof;
-	char			text[MAX_LINE_LENGTH];
+	char			text[MAX_QUEUED_LINES][MAX_LINE_LENGTH];
 };
 
 static struct mailbox linebox;
@@ -56,25 +54,21 @@ static void handle_special(const char *text)
 
 static void handle_command(const char *text)
 {
-	int len = strlen(text);
+	char *slot;
 
-	if (len >= sizeof(linebox.text))
-		len = sizeof(linebox.text) - 1;
+	/* Wait for room in the queue */
+	thread_lock_acquire(&linebox.lock);
+	while (linebox.count >= MAX_QUEUED_LINES)
+		thread_cond_wait(&linebox.cond_space, &linebox.lock);
 
-	/* Deliver the command to the mailbox */
-	thread_lock_acquire(&linebox.lock_text);
-	memcpy(linebox.text, text, len);
-	linebox.text[len] = 0;
-	linebox.text_len = len;
-	thread_lock_release(&linebox.lock_text);
-	thread_cond_notify(&linebox.cond_text);
+	slot = linebox.text[(linebox.head + linebox.count) %
+			    MAX_QUEUED_LINES];
+	strncpy(slot, text, MAX_LINE_LENGTH);
+	slot[MAX_LINE_LENGTH - 1] = 0;
+	linebox.count++;
 
-	/* Wait for ACK */
-	thread_lock_acquire(&linebox.lock_ack);
-	while (!linebox.ack)
-		thread_cond_wait(&linebox.cond_ack, &linebox.lock_ack);
-	linebox.ack = 0;
-	thread_lock_release(&linebox.lock_ack);
+	thread_lock_release(&linebox.lock);
+	thread_cond_notify(&linebox.cond_text);
 }
 
 static void io_worker(void *thread_arg)
@@ -99,9 +93,9 @@ static void io_worker(void *thread_arg)
 	}
 
 	/* Deliver EOF */
-	thread_lock_acquire(&linebox.lock_text);
+	thread_lock_acquire(&linebox.lock);
 	linebox.text_eof = 1;
-	thread_lock_release(&linebox.lock_text);
+	thread_lock_release(&linebox.lock);
 	thread_cond_notify(&linebox.cond_text);
 }
 
@@ -109,13 +103,12 @@ static int async_init(void)
 {
 	thread_t thr;
 
-	thread_lock_init(&linebox.lock_text);
-	thread_lock_init(&linebox.lock_ack);
+	thread_lock_init(&linebox.lock);
 	thread_cond_init(&linebox.cond_text);
-	thread_cond_init(&linebox.cond_ack);
-	linebox.text_len = -1;
+	thread_cond_init(&linebox.cond_space);
+	linebox.head = 0;
+	linebox.count = 0;
 	linebox.text_eof = 0;
-	linebox.ack = 0;
 
 	if (thread_create(&thr, io_worker, NULL) < 0) {
 		fprintf(stderr, "async_init: failed to "
@@ -130,26 +123,26 @@ static void async_exit(void) { }
 
 static int async_read_command(char *buf, int max_len)
 {
-	/* Wait for text or EOF */
-	thread_lock_acquire(&linebox.lock_text);
-	while (!linebox.text_eof && (linebox.text_len < 0))
-		thread_cond_wait(&linebox.cond_text, &linebox.lock_text);
-
-	if (linebox.text_eof) {
-		thread_lock_release(&linebox.lock_text);
+	/* Wait for text or EOF. Queued commands are still run after
+	 * EOF.
+	 */
+	thread_lock_acquire(&linebox.lock);
+	while (!linebox.text_eof && !linebox.count)
+		thread_cond_wait(&linebox.cond_text, &linebox.lock);
+
+	if (!linebox.count) {
+		thread_lock_release(&linebox.lock);
 		return 1;
 	}
 
-	strncpy(buf, linebox.text, max_len);
+	strncpy(buf, linebox.text[linebox.head], max_len);
 	buf[max_len - 1] = 0;
-	linebox.text_len = -1;
-	thread_lock_release(&linebox.lock_text);
-
-	/* Send ACK */
-	thread_lock_acquire(&linebox.lock_ack);
-	linebox.ack = 1;
-	thread_lock_release(&linebox.lock_ack);
-	thread_cond_notify(&linebox.cond_ack);
+	linebox.head = (linebox.head + 1) % MAX_QUEUED_LINES;
+	linebox.count--;
+	thread_lock_release(&linebox.lock);
+
+	/* Make room for another */
+	thread_cond_notify(&linebox.cond_space);
 
 	return 0;
 }
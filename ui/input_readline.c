@@ -219,7 +219,10 @@ static rl_compentry_func_t *complete_opt(char **arg, const char *line, int start
 static char *power_subcmd_generator(const char *text, int state)
 {
 	const char *subcmds[] = { "info", "clear", "all", "session",
-				  "export-csv", "profile", NULL };
+				  "range", "summary", "export-csv",
+				  "export-bin", "profile", "spill",
+				  "spill-close", "stream", "stream-close",
+				  NULL };
 	return array_generator(text, state, subcmds);
 }
 
@@ -291,6 +294,7 @@ static const struct cmd_completer cmd_completers[] = {
 	{ "simio",      complete_simio },
 	{ "sym",        complete_sym },
 	{ "verify_raw", complete_loadraw },
+	{ "wcet",       complete_addrcmd },
 	{ NULL,         NULL }
 };
 
@@ -0,0 +1,387 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "insndb.h"
+#include "device.h"
+#include "vector.h"
+#include "output.h"
+#include "thread.h"
+#include "util.h"
+
+#define INSNDB_MAX_ENTRIES	2
+
+struct insndb {
+	device_t			dev;
+	unsigned int			mem_gen;
+
+	address_t			start;
+	address_t			end;
+	uint8_t				*mem;
+
+	/* One slot for each even address. Slots for which decoding
+	 * failed have a length of 0.
+	 */
+	struct msp430_instruction	*insns;
+
+	int				have_terms[INSNDB_NUM_KEYS];
+	struct vector			terms[INSNDB_NUM_KEYS];
+};
+
+/* Most recently used first */
+static struct insndb *cache[INSNDB_MAX_ENTRIES];
+static int cache_count;
+
+/************************************************************************
+ * Decoding
+ */
+
+/* The decode sweep is divided between several threads, for large
+ * ranges. Each writes to its own part of the slot array.
+ */
+#define DECODE_SPAN_MIN		16384
+#define DECODE_MAX_THREADS	16
+
+struct decode_span {
+	struct insndb		*db;
+	address_t		from;
+	address_t		to;
+};
+
+static void decode_span(void *user_data)
+{
+	const struct decode_span *s = (const struct decode_span *)user_data;
+	struct insndb *db = s->db;
+	address_t i;
+
+	for (i = s->from; i < s->to; i += 2) {
+		struct msp430_instruction *insn = &db->insns[i >> 1];
+
+		if (dis_decode(db->mem + i, db->start + i,
+			       db->end - db->start - i, insn) < 0)
+			insn->len = 0;
+	}
+}
+
+static void decode_all(struct insndb *db)
+{
+	const address_t len = db->end - db->start;
+	struct decode_span span[DECODE_MAX_THREADS];
+	thread_t thr[DECODE_MAX_THREADS];
+	int started[DECODE_MAX_THREADS];
+	int n = thread_num_cpus();
+	int i;
+
+	if (n > len / DECODE_SPAN_MIN)
+		n = len / DECODE_SPAN_MIN;
+	if (n > DECODE_MAX_THREADS)
+		n = DECODE_MAX_THREADS;
+	if (n < 1)
+		n = 1;
+
+	for (i = 0; i < n; i++) {
+		struct decode_span *s = &span[i];
+
+		/* Boundaries must stay on even offsets */
+		s->db = db;
+		s->from = ((long long)len * i / n) & ~1;
+		s->to = ((long long)len * (i + 1) / n) & ~1;
+	}
+
+	/* The first part is done on this thread, as are any for which a
+	 * thread can't be started.
+	 */
+	for (i = 1; i < n; i++)
+		started[i] = !thread_create(&thr[i], decode_span, &span[i]);
+
+	decode_span(&span[0]);
+
+	for (i = 1; i < n; i++) {
+		if (started[i])
+			thread_join(thr[i]);
+		else
+			decode_span(&span[i]);
+	}
+}
+
+/************************************************************************
+ * Entry management
+ */
+
+static void entry_destroy(struct insndb *db)
+{
+	int i;
+
+	for (i = 0; i < INSNDB_NUM_KEYS; i++)
+		vector_destroy(&db->terms[i]);
+
+	free(db->insns);
+	free(db->mem);
+	free(db);
+}
+
+static struct insndb *entry_new(address_t start, address_t end)
+{
+	const address_t len = end - start;
+	struct insndb *db = malloc(sizeof(*db));
+	int i;
+
+	if (!db) {
+		pr_error("insndb: can't allocate memory");
+		return NULL;
+	}
+
+	memset(db, 0, sizeof(*db));
+	db->dev = device_default;
+	db->mem_gen = device_default->mem_gen;
+	db->start = start;
+	db->end = end;
+
+	for (i = 0; i < INSNDB_NUM_KEYS; i++)
+		vector_init(&db->terms[i], sizeof(struct insndb_term));
+
+	/* Allocate at least one byte of each, so that an empty range
+	 * isn't mistaken for an allocation failure.
+	 */
+	db->mem = malloc(len + 1);
+	db->insns = malloc((len >> 1) * sizeof(db->insns[0]) + 1);
+	if (!(db->mem && db->insns)) {
+		pr_error("insndb: can't allocate memory");
+		entry_destroy(db);
+		return NULL;
+	}
+
+	if (len && device_readmem(start, db->mem, len) < 0) {
+		printc_err("insndb: couldn't read device memory\n");
+		entry_destroy(db);
+		return NULL;
+	}
+
+	decode_all(db);
+	return db;
+}
+
+static int entry_valid(const struct insndb *db)
+{
+	return db->dev == device_default &&
+		db->mem_gen == device_default->mem_gen;
+}
+
+/* Discard stale entries, and find the first up-to-date entry covering
+ * the given range.
+ */
+static int find_entry(address_t start, address_t end)
+{
+	int i = 0;
+	int j = 0;
+
+	for (i = 0; i < cache_count; i++) {
+		if (entry_valid(cache[i]))
+			cache[j++] = cache[i];
+		else
+			entry_destroy(cache[i]);
+	}
+
+	cache_count = j;
+
+	for (i = 0; i < cache_count; i++)
+		if (cache[i]->start <= start && end <= cache[i]->end)
+			return i;
+
+	return -1;
+}
+
+static void move_to_front(int i)
+{
+	struct insndb *db = cache[i];
+
+	memmove(cache + 1, cache, i * sizeof(cache[0]));
+	cache[0] = db;
+}
+
+struct insndb *insndb_get(address_t start, address_t end)
+{
+	struct insndb *db;
+	int i;
+
+	if (end < start)
+		end = start;
+
+	i = find_entry(start, end);
+	if (i >= 0) {
+		move_to_front(i);
+		return cache[0];
+	}
+
+	db = entry_new(start, end);
+	if (!db)
+		return NULL;
+
+	if (cache_count >= INSNDB_MAX_ENTRIES)
+		entry_destroy(cache[--cache_count]);
+
+	cache[cache_count++] = db;
+	move_to_front(cache_count - 1);
+	return db;
+}
+
+int insndb_read(address_t addr, uint8_t *mem, address_t len)
+{
+	int i = find_entry(addr, addr + len);
+
+	if (i < 0)
+		return -1;
+
+	memcpy(mem, insndb_mem(cache[i], addr), len);
+	return 0;
+}
+
+void insndb_clear(void)
+{
+	while (cache_count)
+		entry_destroy(cache[--cache_count]);
+}
+
+/************************************************************************
+ * Queries
+ */
+
+const uint8_t *insndb_mem(const struct insndb *db, address_t addr)
+{
+	return db->mem + (addr - db->start);
+}
+
+int insndb_decode(const struct insndb *db, address_t addr, address_t end,
+		  struct msp430_instruction *insn)
+{
+	const struct msp430_instruction *d =
+		&db->insns[(addr - db->start) >> 1];
+
+	if (!d->len)
+		return -1;
+
+	/* Decoding may have used memory beyond the end of the caller's
+	 * range, in which case it needs to be tried again with less.
+	 */
+	if (addr + d->len > end)
+		return dis_decode(insndb_mem(db, addr), addr, end - addr,
+				  insn);
+
+	memcpy(insn, d, sizeof(*insn));
+	return d->len;
+}
+
+static address_t key_value(const struct msp430_instruction *insn,
+			   insndb_key_t key)
+{
+	switch (key) {
+	case INSNDB_KEY_OP: return insn->op;
+	case INSNDB_KEY_SRC_REG: return insn->src_reg;
+	case INSNDB_KEY_DST_REG: return insn->dst_reg;
+	case INSNDB_KEY_SRC_MODE: return insn->src_mode;
+	case INSNDB_KEY_DST_MODE: return insn->dst_mode;
+	case INSNDB_KEY_SRC_ADDR: return insn->src_addr;
+	case INSNDB_KEY_DST_ADDR: return insn->dst_addr;
+	default: break;
+	}
+
+	return 0;
+}
+
+static int cmp_term(const void *a, const void *b)
+{
+	const struct insndb_term *x = (const struct insndb_term *)a;
+	const struct insndb_term *y = (const struct insndb_term *)b;
+
+	if (x->value != y->value)
+		return x->value < y->value ? -1 : 1;
+	if (x->addr != y->addr)
+		return x->addr < y->addr ? -1 : 1;
+
+	return 0;
+}
+
+static int build_terms(struct insndb *db, insndb_key_t key)
+{
+	struct vector *v = &db->terms[key];
+	const address_t n = (db->end - db->start) >> 1;
+	address_t i;
+
+	if (vector_realloc(v, n) < 0) {
+		printc_err("insndb: can't allocate memory for index\n");
+		return -1;
+	}
+
+	for (i = 0; i < n; i++) {
+		const struct msp430_instruction *insn = &db->insns[i];
+		struct insndb_term t;
+
+		if (!insn->len)
+			continue;
+
+		t.value = key_value(insn, key);
+		t.addr = insn->offset;
+		vector_push(v, &t, 1);
+	}
+
+	qsort(v->ptr, v->size, sizeof(struct insndb_term), cmp_term);
+	db->have_terms[key] = 1;
+	return 0;
+}
+
+/* Find the first term not less than the given one */
+static int lower_bound(const struct vector *v, address_t value,
+		       address_t addr)
+{
+	const struct insndb_term *t = (const struct insndb_term *)v->ptr;
+	struct insndb_term k;
+	int lo = 0;
+	int hi = v->size;
+
+	k.value = value;
+	k.addr = addr;
+
+	while (lo < hi) {
+		const int mid = (lo + hi) >> 1;
+
+		if (cmp_term(&t[mid], &k) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+const struct insndb_term *insndb_find(struct insndb *db, insndb_key_t key,
+				      address_t value, address_t start,
+				      address_t end, int *count)
+{
+	const struct vector *v = &db->terms[key];
+	int first;
+
+	if (!db->have_terms[key] && build_terms(db, key) < 0)
+		return NULL;
+
+	first = lower_bound(v, value, start);
+	*count = start < end ? lower_bound(v, value, end) - first : 0;
+
+	return VECTOR_PTR(*v, first, struct insndb_term);
+}
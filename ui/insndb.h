@@ -0,0 +1,93 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef INSNDB_H_
+#define INSNDB_H_
+
+#include "dis.h"
+
+/* Index of decoded instructions.
+ *
+ * A range of device memory is read and decoded at every even address,
+ * and the snapshot is kept until device memory might have changed (see
+ * the mem_gen field of struct device). Any range within the snapshot
+ * can be queried, so several analysis commands working on the same
+ * memory share one read and one decode pass.
+ *
+ * For instruction fields which are commonly searched on, a list of
+ * instruction addresses sorted by the field's value is built the first
+ * time it's needed, so that matching instructions can be found without
+ * a scan.
+ */
+struct insndb;
+
+typedef enum {
+	INSNDB_KEY_OP,
+	INSNDB_KEY_SRC_REG,
+	INSNDB_KEY_DST_REG,
+	INSNDB_KEY_SRC_MODE,
+	INSNDB_KEY_DST_MODE,
+	INSNDB_KEY_SRC_ADDR,
+	INSNDB_KEY_DST_ADDR,
+
+	INSNDB_NUM_KEYS
+} insndb_key_t;
+
+struct insndb_term {
+	address_t		value;
+	address_t		addr;
+};
+
+/* Find an up-to-date index covering the given range of even
+ * addresses, reading and decoding device memory if there isn't one.
+ * The index remains valid until the next call to insndb_get() or
+ * insndb_clear(). Returns NULL if an error occurs.
+ */
+struct insndb *insndb_get(address_t start, address_t end);
+
+/* Copy memory out of an up-to-date index, if any covers the given
+ * range. Returns 0 if successful, or -1 if the memory must be read from
+ * the device.
+ */
+int insndb_read(address_t addr, uint8_t *mem, address_t len);
+
+/* Fetch a pointer to the snapshot at the given address. */
+const uint8_t *insndb_mem(const struct insndb *db, address_t addr);
+
+/* Fetch the instruction at the given address, as dis_decode() would
+ * decode it if memory ended at the given address. Returns the length
+ * of the instruction, or -1 if it can't be decoded.
+ */
+int insndb_decode(const struct insndb *db, address_t addr, address_t end,
+		  struct msp430_instruction *insn);
+
+/* Find instructions in the given range whose key field has the given
+ * value. The matching terms are returned in address order, and the
+ * number of them in *count. Returns NULL if an error occurs.
+ *
+ * Fields are indexed without regard to the addressing mode, so the
+ * results may include instructions for which the field is unused.
+ */
+const struct insndb_term *insndb_find(struct insndb *db, insndb_key_t key,
+				      address_t value, address_t start,
+				      address_t end, int *count);
+
+/* Discard all indexes. */
+void insndb_clear(void);
+
+#endif
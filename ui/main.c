@@ -26,6 +26,8 @@
 #include "dis.h"
 #include "device.h"
 #include "binfile.h"
+#include "imgcache.h"
+#include "insndb.h"
 #include "stab.h"
 #include "util.h"
 #include "usbutil.h"
@@ -58,6 +60,7 @@
 #include "fet3.h"
 #include "rom_bsl.h"
 #include "chipinfo.h"
+#include "daemon.h"
 
 #ifdef __CYGWIN__
 #include <sys/cygwin.h>
@@ -69,6 +72,8 @@
 struct cmdline_args {
 	const char		*driver_name;
 	const char		*alt_config;
+	const char		*daemon_path;
+	const char		*client_path;
 	int			flags;
 	struct device_args	devarg;
 };
@@ -107,6 +112,7 @@ static void usage(const char *progname)
 	int i;
 
 	printc("Usage: %s [options] <driver> [command ...]\n"
+"       %s --client <socket> [command ...]\n"
 "\n"
 "    -q\n"
 "        Start in quiet mode.\n"
@@ -147,6 +153,11 @@ static void usage(const char *progname)
 "        Show copyright and version information.\n"
 "    --embedded\n"
 "        Run in embedded mode.\n"
+"    --daemon <socket>\n"
+"        Keep the device open, and accept commands on the given\n"
+"        Unix-domain socket.\n"
+"    --client <socket>\n"
+"        Run commands using a daemon listening on the given socket.\n"
 "    --bsl-entry-sequence <seq>\n"
 "        Specify a BSL entry sequence. Each character specifies a modem\n"
 "        control line transition (R: RTS on, r: RTS off, D: DTR on, \n"
@@ -163,7 +174,7 @@ static void usage(const char *progname)
 "\n"
 "If commands are given, they will be executed. Otherwise, an interactive\n"
 "command reader is started.\n\n",
-		progname);
+		progname, progname);
 
 	printc("Available drivers are:\n");
 	for (i = 0; i < ARRAY_LEN(driver_table); i++) {
@@ -304,6 +315,8 @@ static int parse_cmdline_args(int argc, char **argv,
 		LOPT_BSL_GPIO_RTS,
 		LOPT_BSL_GPIO_DTR,
 		LOPT_BSL_ENTRY_PASSWORD,
+		LOPT_DAEMON,
+		LOPT_CLIENT,
 	};
 
 	static const struct option longopts[] = {
@@ -322,6 +335,8 @@ static int parse_cmdline_args(int argc, char **argv,
 		{"bsl-gpio-rts",	1, 0, LOPT_BSL_GPIO_RTS},
 		{"bsl-gpio-dtr",	1, 0, LOPT_BSL_GPIO_DTR},
 		{"bsl-entry-password",  1, 0, LOPT_BSL_ENTRY_PASSWORD},
+		{"daemon",		1, 0, LOPT_DAEMON},
+		{"client",		1, 0, LOPT_CLIENT},
 		{NULL, 0, 0, 0}
 	};
 
@@ -373,6 +388,14 @@ static int parse_cmdline_args(int argc, char **argv,
 			args->flags |= OPT_EMBEDDED;
 			break;
 
+		case LOPT_DAEMON:
+			args->daemon_path = optarg;
+			break;
+
+		case LOPT_CLIENT:
+			args->client_path = optarg;
+			break;
+
 		case LOPT_ALLOW_FW_UPDATE:
 			args->devarg.flags |= DEVICE_FLAG_DO_FWUPDATE;
 			break;
@@ -453,6 +476,17 @@ static int parse_cmdline_args(int argc, char **argv,
 		return -1;
 	}
 
+	if (args->client_path) {
+		if (args->daemon_path) {
+			printc_err("You can't use --daemon and --client "
+				"together.\n");
+			return -1;
+		}
+
+		/* Remaining arguments are commands for the daemon */
+		return 0;
+	}
+
 	if (optind >= argc) {
 		printc_err("You need to specify a driver. Try --help for "
 			"a list.\n");
@@ -532,6 +566,12 @@ int main(int argc, char **argv)
 	if (parse_cmdline_args(argc, argv, &args) < 0)
 		goto fail_parse;
 
+	if (args.client_path) {
+		ret = daemon_client(args.client_path,
+				    argv + optind, argc - optind);
+		goto fail_parse;
+	}
+
 	if (args.flags & OPT_EMBEDDED)
 		input_module = &input_async;
 	if (input_module->init() < 0)
@@ -544,6 +584,11 @@ int main(int argc, char **argv)
 		goto fail_sockets;
 	}
 
+	if (args.daemon_path && daemon_open(args.daemon_path) < 0) {
+		ret = -1;
+		goto fail_daemon;
+	}
+
 	printc_dbg("%s", version_text);
 	printc_dbg("%s\n", chipinfo_copyright());
 	if (setup_driver(&args) < 0) {
@@ -567,19 +612,27 @@ int main(int argc, char **argv)
 				break;
 			}
 		}
-	} else {
+	} else if (!args.daemon_path) {
 		reader_loop();
 	}
 
+	if (args.daemon_path && !ret && daemon_serve() < 0)
+		ret = -1;
+
 	simio_exit();
 	device_destroy();
+	insndb_clear();
+	imgcache_clear();
 	stab_exit();
 fail_driver:
+	daemon_close();
+fail_daemon:
 	sockets_exit();
 fail_sockets:
 	input_module->exit();
 fail_input:
 fail_parse:
+	output_exit();
 
 	/* We need to do this on Windows, because in embedded mode we
 	 * may still have a running background thread for input. If so,
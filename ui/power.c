@@ -42,14 +42,64 @@ static void print_header(powerbuf_t pb, unsigned int s)
 		(double)(rec->total_ua * pb->interval_us) / 1000000.0);
 }
 
+/* Samples are fetched from the power buffer in blocks, since they may
+ * have to be read back from a capture file.
+ */
+#define SAMPLE_BLOCK	1024
+
+struct sample_reader {
+	powerbuf_t		pb;
+	unsigned int		session;
+	unsigned int		offset;
+
+	unsigned int		len;
+	unsigned int		pos;
+	unsigned int		current_ua[SAMPLE_BLOCK];
+	address_t		mab[SAMPLE_BLOCK];
+};
+
+static void reader_init(struct sample_reader *r, powerbuf_t pb,
+			unsigned int session)
+{
+	r->pb = pb;
+	r->session = session;
+	r->offset = 0;
+	r->len = 0;
+	r->pos = 0;
+}
+
+/* Fetch the next sample. Returns 0 on success or -1 at the end of the
+ * session.
+ */
+static int reader_next(struct sample_reader *r,
+		       unsigned int *current_ua, address_t *mab)
+{
+	if (r->pos >= r->len) {
+		r->len = powerbuf_get_samples(r->pb, r->session, r->offset,
+					      SAMPLE_BLOCK, r->current_ua,
+					      r->mab);
+		r->offset += r->len;
+		r->pos = 0;
+
+		if (!r->len)
+			return -1;
+	}
+
+	*current_ua = r->current_ua[r->pos];
+	*mab = r->mab[r->pos];
+	r->pos++;
+	return 0;
+}
+
 static void dump_session_data(powerbuf_t pb, unsigned int s,
 			      unsigned int gran)
 {
 	unsigned int length;
-	const struct powerbuf_session *rec =
-		powerbuf_session_info(pb, s, &length);
+	struct sample_reader r;
 	unsigned int i;
-	int idx;
+
+	powerbuf_session_info(pb, s, &length);
+	reader_init(&r, pb, s);
 
 	print_header(pb, s);
 	printc("\n");
@@ -57,17 +107,23 @@ static void dump_session_data(powerbuf_t pb, unsigned int s,
 	printc("%15s %15s %-15s\n", "Time (us)", "Current (uA)", "MAB");
 	printc("------------------------------------------------\n");
 
-	idx = rec->start_index;
-
 	for (i = 0; i + gran <= length; i += gran) {
-		address_t mab = pb->mab[idx];
+		address_t mab = 0;
 		unsigned long ua_tot = 0;
 		char addr[128];
 		int j;
 
 		for (j = 0; j < gran; j++) {
-			ua_tot += pb->current_ua[idx];
-			idx = (idx + 1) % pb->max_samples;
+			unsigned int ua;
+			address_t m;
+
+			if (reader_next(&r, &ua, &m) < 0)
+				break;
+
+			if (!j)
+				mab = m;
+
+			ua_tot += ua;
 		}
 
 		print_address(mab, addr, sizeof(addr), 0);
@@ -84,6 +140,14 @@ static int sc_info(powerbuf_t pb)
 	int i;
 
 	printc("Sample granularity is %d us\n", pb->interval_us);
+	if (pb->dropped)
+		printc("%llu samples dropped\n", pb->dropped);
+	if (powerbuf_spill_path(pb))
+		printc("Capturing to %s\n", powerbuf_spill_path(pb));
+	if (powerbuf_stream_path(pb))
+		printc("Streaming to %s (%llu samples skipped)\n",
+		       powerbuf_stream_path(pb),
+		       powerbuf_stream_dropped(pb));
 	printc("%d sessions:\n", sess_num);
 
 	for (i = sess_num - 1; i >= 0; i--) {
@@ -161,57 +225,415 @@ static int sc_session(powerbuf_t pb, char **arg)
 	return 0;
 }
 
-static int sc_export_csv(powerbuf_t pb, char **arg)
+static int parse_session(powerbuf_t pb, char **arg, unsigned int *sess_out)
 {
-	const char *sess_text = get_arg(arg);
-	const char *filename = get_arg(arg);
-	unsigned int length;
-	const struct powerbuf_session *rec;
-	FILE *out;
+	const char *text = get_arg(arg);
 	int sess;
-	unsigned int i;
 
-	if (!(sess_text && filename)) {
-		printc_err("power: expected a session number and filename\n");
+	if (!text) {
+		printc_err("power: you must specify a session number\n");
 		return -1;
 	}
 
-	sess = atoi(sess_text);
+	sess = atoi(text);
 	if (sess < 0 || sess >= powerbuf_num_sessions(pb)) {
 		printc_err("power: invalid session: %d\n", sess);
 		return -1;
 	}
 
-	rec = powerbuf_session_info(pb, sess, &length);
+	*sess_out = sess;
+	return 0;
+}
+
+/* Samples are exported in large blocks, and written through a buffer
+ * of the same size.
+ */
+#define EXPORT_BUF_SIZE		65536
+
+struct exporter {
+	const char		*filename;
+	FILE			*out;
+
+	unsigned int		*current_ua;
+	address_t		*mab;
+};
+
+static void export_close(struct exporter *e)
+{
+	if (e->out)
+		fclose(e->out);
+
+	free(e->current_ua);
+	free(e->mab);
+}
+
+static int export_open(struct exporter *e, powerbuf_t pb, char **arg,
+		       unsigned int *sess)
+{
+	memset(e, 0, sizeof(*e));
+
+	if (parse_session(pb, arg, sess) < 0)
+		return -1;
+
+	e->filename = get_arg(arg);
+	if (!e->filename) {
+		printc_err("power: expected a session number and filename\n");
+		return -1;
+	}
+
+	e->current_ua = malloc(sizeof(e->current_ua[0]) *
+			       POWERBUF_EXPORT_BLOCK);
+	e->mab = malloc(sizeof(e->mab[0]) * POWERBUF_EXPORT_BLOCK);
+	if (!(e->current_ua && e->mab)) {
+		pr_error("power: can't allocate memory");
+		export_close(e);
+		return -1;
+	}
 
-	out = fopen(filename, "w");
-	if (!out) {
+	e->out = fopen(e->filename, "wb");
+	if (!e->out) {
 		printc_err("power: can't open %s: %s\n",
-			   filename, last_error());
+			   e->filename, last_error());
+		export_close(e);
 		return -1;
 	}
 
-	for (i = 0; i < length; i++) {
-		const unsigned int idx =
-			(rec->start_index + i) % pb->max_samples;
+	setvbuf(e->out, NULL, _IOFBF, EXPORT_BUF_SIZE);
+	return 0;
+}
 
-		if (fprintf(out, "%15d,%15d, 0x%05x\n",
-			    i * pb->interval_us,
-			    pb->current_ua[idx], pb->mab[idx]) < 0) {
-			printc_err("power: write error: %s: %s\n",
-				   filename, last_error());
-			fclose(out);
-			return -1;
-		}
+static int export_write(struct exporter *e, const void *data, size_t len)
+{
+	if (fwrite(data, 1, len, e->out) != len) {
+		printc_err("power: write error: %s: %s\n",
+			   e->filename, last_error());
+		return -1;
 	}
 
+	return 0;
+}
+
+static int export_finish(struct exporter *e, unsigned int length)
+{
+	FILE *out = e->out;
+
+	e->out = NULL;
+	export_close(e);
+
 	if (fclose(out) < 0) {
 		printc_err("power: error on close of %s: %s\n",
-			    filename, last_error());
+			    e->filename, last_error());
 		return -1;
 	}
 
-	printc("Exported %d samples to %s\n", length, filename);
+	printc("Exported %d samples to %s\n", length, e->filename);
+	return 0;
+}
+
+/* Format a number right-aligned in a field of the given width, and
+ * return a pointer to the end of the field. This is much quicker than
+ * going through printf() for every sample.
+ */
+static char *format_field(char *p, unsigned long long v, int base,
+			  int width, int zero_fill)
+{
+	char tmp[24];
+	int len = 0;
+
+	do {
+		tmp[len++] = "0123456789abcdef"[v % base];
+		v /= base;
+	} while (v);
+
+	while (width > len) {
+		*(p++) = zero_fill ? '0' : ' ';
+		width--;
+	}
+
+	while (len)
+		*(p++) = tmp[--len];
+
+	return p;
+}
+
+static int sc_export_csv(powerbuf_t pb, char **arg)
+{
+	struct exporter e;
+	unsigned int sess;
+	unsigned int length;
+	unsigned int offset = 0;
+	unsigned int n;
+
+	if (export_open(&e, pb, arg, &sess) < 0)
+		return -1;
+
+	powerbuf_session_info(pb, sess, &length);
+
+	while ((n = powerbuf_get_samples(pb, sess, offset,
+					 POWERBUF_EXPORT_BLOCK,
+					 e.current_ua, e.mab)) > 0) {
+		char line[64];
+		unsigned int i;
+
+		for (i = 0; i < n; i++) {
+			char *p = line;
+
+			/* "%15d,%15d, 0x%05x\n" */
+			p = format_field(p, (unsigned long long)
+					 (offset + i) * pb->interval_us,
+					 10, 15, 0);
+			*(p++) = ',';
+			p = format_field(p, e.current_ua[i], 10, 15, 0);
+			*(p++) = ',';
+			*(p++) = ' ';
+			*(p++) = '0';
+			*(p++) = 'x';
+			p = format_field(p, e.mab[i], 16, 5, 1);
+			*(p++) = '\n';
+
+			if (export_write(&e, line, p - line) < 0) {
+				export_close(&e);
+				return -1;
+			}
+		}
+
+		offset += n;
+	}
+
+	return export_finish(&e, length);
+}
+
+static int sc_export_bin(powerbuf_t pb, char **arg)
+{
+	struct exporter e;
+	struct powerbuf_export_header h;
+	const struct powerbuf_session *info;
+	unsigned int sess;
+	unsigned int length;
+	unsigned int offset = 0;
+	uint32_t n;
+
+	if (export_open(&e, pb, arg, &sess) < 0)
+		return -1;
+
+	info = powerbuf_session_info(pb, sess, &length);
+	powerbuf_export_header(pb, info->wall_clock, &h);
+	if (export_write(&e, &h, sizeof(h)) < 0)
+		goto fail;
+
+	for (;;) {
+		n = powerbuf_get_samples(pb, sess, offset,
+					 POWERBUF_EXPORT_BLOCK,
+					 e.current_ua, e.mab);
+
+		/* The last block written is the terminator */
+		if (export_write(&e, &n, sizeof(n)) < 0)
+			goto fail;
+		if (!n)
+			break;
+
+		if (export_write(&e, e.current_ua, n * 4) < 0 ||
+		    export_write(&e, e.mab, n * 4) < 0)
+			goto fail;
+
+		offset += n;
+	}
+
+	return export_finish(&e, length);
+
+fail:
+	export_close(&e);
+	return -1;
+}
+
+/* Parse an optional time range, in microseconds from the start of the
+ * session, and convert it to a range of samples. By default, the whole
+ * session is selected.
+ */
+static int parse_range(powerbuf_t pb, unsigned int sess, char **arg,
+		       unsigned int *offset, unsigned int *count)
+{
+	const char *t0_text = get_arg(arg);
+	const char *t1_text = get_arg(arg);
+	unsigned int length;
+	unsigned long long t0 = 0;
+	unsigned long long t1;
+	unsigned long long start;
+	unsigned long long end;
+
+	powerbuf_session_info(pb, sess, &length);
+	t1 = (unsigned long long)length * pb->interval_us;
+
+	if (t0_text)
+		t0 = strtoull(t0_text, NULL, 10);
+	if (t1_text)
+		t1 = strtoull(t1_text, NULL, 10);
+
+	if (t1 <= t0) {
+		printc_err("power: invalid time range: %llu-%llu us\n",
+			   t0, t1);
+		return -1;
+	}
+
+	start = t0 / pb->interval_us;
+	end = (t1 + pb->interval_us - 1) / pb->interval_us;
+
+	if (end > length)
+		end = length;
+	if (start > end)
+		start = end;
+
+	*offset = start;
+	*count = end - start;
+	return 0;
+}
+
+static int sc_range(powerbuf_t pb, char **arg)
+{
+	unsigned int sess;
+	unsigned int offset;
+	unsigned int count;
+	struct powerbuf_stats st;
+
+	if (parse_session(pb, arg, &sess) < 0 ||
+	    parse_range(pb, sess, arg, &offset, &count) < 0 ||
+	    powerbuf_get_stats(pb, sess, offset, count, &st) < 0)
+		return -1;
+
+	printc_shell("power-range %u %u %u %u %llu\n",
+		     offset * pb->interval_us, st.samples,
+		     st.min_ua, st.max_ua, st.sum_ua);
+
+	if (!st.samples) {
+		printc("No samples in range\n");
+		return 0;
+	}
+
+	printc("%d samples from %u us (spanning %.03f ms)\n",
+	       st.samples, offset * pb->interval_us,
+	       (double)st.samples * pb->interval_us / 1000.0);
+	printc("%u uA minimum, %u uA peak, %.01f uA average\n",
+	       st.min_ua, st.max_ua,
+	       (double)st.sum_ua / (double)st.samples);
+	printc("%.01f uAs total charge\n",
+	       (double)st.sum_ua * pb->interval_us / 1000000.0);
+	return 0;
+}
+
+static int sc_summary(powerbuf_t pb, char **arg)
+{
+	unsigned int sess;
+	const char *buckets_text;
+	int buckets;
+	unsigned int offset;
+	unsigned int count;
+	int i;
+
+	if (parse_session(pb, arg, &sess) < 0)
+		return -1;
+
+	buckets_text = get_arg(arg);
+	if (!buckets_text) {
+		printc_err("power: you must specify a number of buckets\n");
+		return -1;
+	}
+
+	buckets = atoi(buckets_text);
+	if (buckets <= 0) {
+		printc_err("power: invalid number of buckets: %d\n",
+			   buckets);
+		return -1;
+	}
+
+	if (parse_range(pb, sess, arg, &offset, &count) < 0)
+		return -1;
+
+	if ((unsigned int)buckets > count)
+		buckets = count;
+
+	printc("%15s %15s %15s %15s\n",
+	       "Time (us)", "Min (uA)", "Avg (uA)", "Max (uA)");
+	printc("----------------------------------------------------------"
+	       "------\n");
+
+	for (i = 0; i < buckets; i++) {
+		const unsigned int start = offset +
+			(unsigned long long)count * i / buckets;
+		const unsigned int end = offset +
+			(unsigned long long)count * (i + 1) / buckets;
+		struct powerbuf_stats st;
+
+		if (powerbuf_get_stats(pb, sess, start, end - start, &st) < 0)
+			return -1;
+
+		printc_shell("power-summary %u %u %u %u %llu\n",
+			     start * pb->interval_us, st.samples,
+			     st.min_ua, st.max_ua, st.sum_ua);
+		printc("%15u %15u %15.01f %15u\n",
+		       start * pb->interval_us, st.min_ua,
+		       (double)st.sum_ua / (double)st.samples, st.max_ua);
+	}
+
+	return 0;
+}
+
+static int sc_spill(powerbuf_t pb, char **arg)
+{
+	const char *filename = get_arg(arg);
+
+	if (!filename) {
+		printc_err("power: expected a filename\n");
+		return -1;
+	}
+
+	if (powerbuf_spill_open(pb, filename) < 0)
+		return -1;
+
+	printc("Capturing to %s\n", filename);
+	return 0;
+}
+
+static int sc_spill_close(powerbuf_t pb)
+{
+	const char *path = powerbuf_spill_path(pb);
+
+	if (!path) {
+		printc_err("power: no capture file is open\n");
+		return -1;
+	}
+
+	printc("Closing capture file %s\n", path);
+	powerbuf_spill_close(pb);
+	return 0;
+}
+
+static int sc_stream(powerbuf_t pb, char **arg)
+{
+	const char *path = get_arg(arg);
+
+	if (!path) {
+		printc_err("power: expected a FIFO or socket path\n");
+		return -1;
+	}
+
+	if (powerbuf_stream_open(pb, path) < 0)
+		return -1;
+
+	printc("Streaming to %s\n", path);
+	return 0;
+}
+
+static int sc_stream_close(powerbuf_t pb)
+{
+	const char *path = powerbuf_stream_path(pb);
+
+	if (!path) {
+		printc_err("power: no stream is open\n");
+		return -1;
+	}
+
+	printc("Closing stream to %s\n", path);
+	powerbuf_stream_close(pb);
 	return 0;
 }
 
@@ -237,52 +659,6 @@ static int add_symbol(void *user_data, const char *name, address_t offset)
 	return vector_push(v, &rec, 1);
 }
 
-static void merge_power(struct vector *list, powerbuf_t pb)
-{
-	int num_samples =
-		(pb->current_head + pb->max_samples - pb->current_tail) %
-			pb->max_samples;
-	int dst = 0;
-	int src = 0;
-
-	/* Skip samples that don't match any known symbol */
-	while ((dst < list->size) && (src < num_samples) &&
-	       (pb->mab[pb->sorted[src]] <
-		VECTOR_PTR(*list, dst, struct profile_rec)->addr))
-		src++;
-
-	while ((dst < list->size) && (src < num_samples)) {
-		address_t mab = pb->mab[pb->sorted[src]];
-		unsigned int ua = pb->current_ua[pb->sorted[src]];
-
-		if ((dst + 1 < list->size) &&
-		    (VECTOR_PTR(*list, dst + 1,
-				struct profile_rec)->addr <= mab)) {
-			dst++;
-		} else {
-			struct profile_rec *r =
-				VECTOR_PTR(*list, dst, struct profile_rec);
-
-			r->charge += ua;
-			r->samples++;
-			src++;
-		}
-	}
-}
-
-static int cmp_by_addr(const void *a, const void *b)
-{
-	const struct profile_rec *pa = (const struct profile_rec *)a;
-	const struct profile_rec *pb = (const struct profile_rec *)b;
-
-	if (pa->addr < pb->addr)
-		return -1;
-	if (pa->addr > pb->addr)
-		return 1;
-
-	return 0;
-}
-
 static int cmp_by_charge_rev(const void *a, const void *b)
 {
 	const struct profile_rec *pa = (const struct profile_rec *)a;
@@ -320,23 +696,48 @@ static void print_profile(int interval_us, const struct vector *list)
 	}
 }
 
+/* Attribute charge to symbols. MABs are visited in increasing order, so
+ * they resolve to each symbol in turn.
+ */
+static int profile_mab(void *user_data, const struct powerbuf_mab *m)
+{
+	struct vector *list = (struct vector *)user_data;
+	struct profile_rec *r = NULL;
+	address_t offset;
+	const char *name = stab_resolve(m->mab, &offset, NULL);
+
+	/* Skip samples that don't match any known symbol */
+	if (!name)
+		return 0;
+
+	if (list->size)
+		r = VECTOR_PTR(*list, list->size - 1, struct profile_rec);
+
+	if (!r || r->addr != m->mab - offset) {
+		if (add_symbol(list, name, m->mab - offset) < 0) {
+			printc_err("Out of memory: %s\n", last_error());
+			return -1;
+		}
+
+		r = VECTOR_PTR(*list, list->size - 1, struct profile_rec);
+	}
+
+	r->charge += m->sum_ua;
+	r->samples += m->samples;
+	return 0;
+}
+
 static int sc_profile(powerbuf_t pb)
 {
 	struct vector list;
 
-	/* First, assemble a list of symbols */
 	vector_init(&list, sizeof(struct profile_rec));
-	if (stab_enum(add_symbol, &list) < 0) {
-		printc_err("Out of memory: %s\n", last_error());
+
+	if (powerbuf_enum_by_mab(pb, profile_mab, &list) < 0) {
 		vector_destroy(&list);
 		return -1;
 	}
 
-	/* Merge in power profile samples */
-	qsort(list.ptr, list.size, list.elemsize, cmp_by_addr);
-	powerbuf_sort(pb);
-	merge_power(&list, pb);
-
 	/* Prepare and print profile */
 	qsort(list.ptr, list.size, list.elemsize, cmp_by_charge_rev);
 	print_profile(pb->interval_us, &list);
@@ -370,10 +771,24 @@ int cmd_power(char **arg)
 		return sc_all(pb, arg);
 	if (!strcasecmp(subcmd, "session"))
 		return sc_session(pb, arg);
+	if (!strcasecmp(subcmd, "range"))
+		return sc_range(pb, arg);
+	if (!strcasecmp(subcmd, "summary"))
+		return sc_summary(pb, arg);
 	if (!strcasecmp(subcmd, "export-csv"))
 		return sc_export_csv(pb, arg);
+	if (!strcasecmp(subcmd, "export-bin"))
+		return sc_export_bin(pb, arg);
 	if (!strcasecmp(subcmd, "profile"))
 		return sc_profile(pb);
+	if (!strcasecmp(subcmd, "spill"))
+		return sc_spill(pb, arg);
+	if (!strcasecmp(subcmd, "spill-close"))
+		return sc_spill_close(pb);
+	if (!strcasecmp(subcmd, "stream"))
+		return sc_stream(pb, arg);
+	if (!strcasecmp(subcmd, "stream-close"))
+		return sc_stream_close(pb);
 
 	printc_err("power: unknown subcommand: %s (try \"help power\")\n",
 		   subcmd);
@@ -32,6 +32,7 @@
 #include "aliasdb.h"
 #include "ctrlc.h"
 #include "input.h"
+#include "record.h"
 
 #define MAX_READER_LINE		1024
 
@@ -55,6 +56,7 @@ int prompt_abort(int flags)
 	if (!(in_reader_loop && (modify_flags & flags)))
 		return 0;
 
+	output_flush();
 	return input_module->prompt_abort("Symbols have not been saved "
 			"since modification. Continue (y/n)?");
 }
@@ -93,6 +95,7 @@ static int do_command(char *arg, int interactive)
 			ret = cmd.func(&arg);
 			in_reader_loop = old;
 
+			output_flush();
 			return ret;
 		}
 
@@ -109,6 +112,14 @@ void reader_exit(void)
 	want_exit = 1;
 }
 
+int reader_take_exit(void)
+{
+	const int r = want_exit;
+
+	want_exit = 0;
+	return r;
+}
+
 void reader_set_repeat(const char *fmt, ...)
 {
 	va_list ap;
@@ -118,6 +129,29 @@ void reader_set_repeat(const char *fmt, ...)
 	va_end(ap);
 }
 
+/* A command may be tagged with a request ID, as "@id command". The ID
+ * is copied into any records sent while the command runs.
+ */
+static char *take_request_id(char *buf)
+{
+	char *id;
+
+	if (*buf != '@') {
+		record_set_id(NULL);
+		return buf;
+	}
+
+	id = ++buf;
+	while (*buf && !isspace(*buf))
+		buf++;
+
+	if (*buf)
+		*(buf++) = 0;
+
+	record_set_id(id);
+	return buf;
+}
+
 void reader_loop(void)
 {
 	int old = in_reader_loop;
@@ -135,21 +169,30 @@ void reader_loop(void)
 
 		for (;;) {
 			char tmpbuf[MAX_READER_LINE];
-			char *buf = tmpbuf;
+			char *buf;
+			int ret;
 
 			printc_shell("ready\n");
+			output_flush();
 			if (input_module->read_command(tmpbuf, sizeof(tmpbuf)))
 				break;
 
-			if (*buf)
+			buf = take_request_id(tmpbuf);
+			if (*buf) {
 				repeat_buf[0] = 0;
-			else
+			} else {
 				memcpy(tmpbuf, repeat_buf, sizeof(tmpbuf));
+				buf = tmpbuf;
+			}
 
 			ctrlc_clear();
 
 			printc_shell("busy\n");
-			do_command(buf, 1);
+			ret = do_command(buf, 1);
+
+			if (record_enabled())
+				record_done(ret);
+			record_set_id(NULL);
 
 			if (want_exit)
 				break;
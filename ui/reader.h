@@ -49,6 +49,11 @@ void reader_loop(void);
 /* Cause the reader loop to exit */
 void reader_exit(void);
 
+/* Returns non-zero if a command has asked for the reader to exit since
+ * the last call, for command sources other than the reader loop.
+ */
+int reader_take_exit(void);
+
 /* Set up the command to be repeated. When the user presses enter without
  * typing anything, the last executed command is repeated, by default.
  *
@@ -29,6 +29,8 @@
 #include "expr.h"
 #include "output_util.h"
 #include "vector.h"
+#include "insndb.h"
+#include "cycles.h"
 
 /************************************************************************
  * Instruction search ("isearch")
@@ -345,37 +347,102 @@ static int isearch_match(const struct msp430_instruction *insn,
 	return 1;
 }
 
-static int do_isearch(address_t addr, address_t len,
-		      const struct isearch_query *q)
+/* The query's most selective indexed term is used to find candidates,
+ * which are then checked against the whole query.
+ */
+static const struct insndb_term *isearch_candidates(struct insndb *db,
+		const struct isearch_query *q, address_t start, address_t end,
+		int *count)
 {
-	uint8_t *mbuf;
-	address_t i;
+	static const struct {
+		int		flag;
+		insndb_key_t	key;
+	} keys[] = {
+		{ISEARCH_OPCODE,	INSNDB_KEY_OP},
+		{ISEARCH_SRC_ADDR,	INSNDB_KEY_SRC_ADDR},
+		{ISEARCH_DST_ADDR,	INSNDB_KEY_DST_ADDR},
+		{ISEARCH_SRC_REG,	INSNDB_KEY_SRC_REG},
+		{ISEARCH_DST_REG,	INSNDB_KEY_DST_REG},
+		{ISEARCH_SRC_MODE,	INSNDB_KEY_SRC_MODE},
+		{ISEARCH_DST_MODE,	INSNDB_KEY_DST_MODE}
+	};
 
-	mbuf = malloc(len);
-	if (!mbuf) {
-		printc_err("isearch: couldn't allocate memory: %s\n",
-			last_error());
-		return -1;
+	const struct insndb_term *best = NULL;
+	int i;
+
+	for (i = 0; i < ARRAY_LEN(keys); i++) {
+		const struct insndb_term *t;
+		address_t value;
+		int n;
+
+		if (!(q->flags & keys[i].flag))
+			continue;
+
+		switch (keys[i].key) {
+		case INSNDB_KEY_OP: value = q->insn.op; break;
+		case INSNDB_KEY_SRC_ADDR: value = q->insn.src_addr; break;
+		case INSNDB_KEY_DST_ADDR: value = q->insn.dst_addr; break;
+		case INSNDB_KEY_SRC_REG: value = q->insn.src_reg; break;
+		case INSNDB_KEY_DST_REG: value = q->insn.dst_reg; break;
+		case INSNDB_KEY_SRC_MODE: value = q->insn.src_mode; break;
+		default: value = q->insn.dst_mode; break;
+		}
+
+		t = insndb_find(db, keys[i].key, value, start, end, &n);
+		if (!t)
+			return NULL;
+
+		if (!best || n < *count) {
+			best = t;
+			*count = n;
+		}
 	}
 
-	if (device_readmem(addr, mbuf, len) < 0) {
+	return best;
+}
+
+static void isearch_show(struct insndb *db, address_t addr, address_t end,
+			 const struct isearch_query *q)
+{
+	struct msp430_instruction insn;
+	int count = insndb_decode(db, addr, end, &insn);
+
+	if (count >= 0 && isearch_match(&insn, q))
+		disassemble(addr, insndb_mem(db, addr), count,
+			    device_default->power_buf);
+}
+
+static int do_isearch(address_t addr, address_t len,
+		      const struct isearch_query *q)
+{
+	const address_t end = (addr + len) & ~1;
+	const struct insndb_term *t = NULL;
+	struct insndb *db;
+	int count;
+	int i;
+
+	addr &= ~1;
+	db = insndb_get(addr, end);
+	if (!db) {
 		printc_err("isearch: couldn't read device memory\n");
-		free(mbuf);
 		return -1;
 	}
 
-	addr &= ~1;
-	len &= ~1;
-	for (i = 0; i < len; i += 2) {
-		struct msp430_instruction insn;
-		int count = dis_decode(mbuf + i, addr + i, len - i, &insn);
+	/* Queries on operand size and instruction type alone aren't
+	 * indexed, and need a scan.
+	 */
+	if (q->flags & ~(ISEARCH_DSIZE | ISEARCH_TYPE)) {
+		t = isearch_candidates(db, q, addr, end, &count);
+		if (!t)
+			return -1;
 
-		if (count >= 0 && isearch_match(&insn, q))
-			disassemble(addr + i, mbuf + i, count,
-				    device_default->power_buf);
+		for (i = 0; i < count; i++)
+			isearch_show(db, t[i].addr, end, q);
+	} else {
+		for (; addr < end; addr += 2)
+			isearch_show(db, addr, end, q);
 	}
 
-	free(mbuf);
 	return 0;
 }
 
@@ -538,42 +605,137 @@ static void cgraph_destroy(struct call_graph *graph)
 	vector_destroy(&graph->node_list);
 }
 
-static int find_possible_edges(int offset, int len, uint8_t *memory,
-			       struct call_graph *graph)
+/* Sort edges by destination or source address (then by the other
+ * address, then by type), giving the same order as cmp_branch_by_dst()
+ * or cmp_branch_by_src().
+ *
+ * This is a least-significant-digit radix sort, a byte at a time.
+ * Passes over bytes which are the same for every edge (such as the high
+ * bytes of addresses) are skipped. If there's no memory for the scratch
+ * buffer, we fall back to qsort().
+ */
+static inline unsigned int edge_digit(const struct cg_edge *e, int pass,
+				      int by_dst)
+{
+	address_t addr;
+
+	/* Pass 0 is the edge type. Passes 1-4 are the bytes of the
+	 * secondary address, and 5-8 are the bytes of the primary.
+	 */
+	if (!pass)
+		return e->is_tail_call ? 1 : 0;
+
+	addr = ((pass < 5) == !by_dst) ? e->dst : e->src;
+	return (addr >> (((pass - 1) & 3) * 8)) & 0xff;
+}
+
+static void sort_edges(struct vector *v, int by_dst)
 {
+	struct cg_edge *a = (struct cg_edge *)v->ptr;
+	struct cg_edge *tmp;
+	const int n = v->size;
+	int pass;
 	int i;
 
-	for (i = 0; i < len; i += 2) {
-		struct msp430_instruction insn;
+	if (n < 2)
+		return;
 
-		if (dis_decode(memory + i, offset + i, len - i, &insn) < 0)
-			continue;
+	tmp = malloc(sizeof(tmp[0]) * n);
+	if (!tmp) {
+		qsort(v->ptr, n, v->elemsize,
+		      by_dst ? cmp_branch_by_dst : cmp_branch_by_src);
+		return;
+	}
 
-		if (insn.dst_mode == MSP430_AMODE_IMMEDIATE &&
-		    (insn.op == MSP430_OP_CALL || insn.op == MSP430_OP_BR) &&
-		    !(insn.dst_addr & 1)) {
-			struct cg_edge br;
+	for (pass = 0; pass < 9; pass++) {
+		unsigned int count[256] = {0};
+		unsigned int pos = 0;
+		struct cg_edge *t;
+		int skip = 0;
 
-			br.src = offset + i;
-			br.dst = insn.dst_addr;
-			br.is_tail_call = insn.op != MSP430_OP_CALL;
+		for (i = 0; i < n; i++)
+			count[edge_digit(&a[i], pass, by_dst)]++;
 
-			if (vector_push(&graph->edge_from, &br, 1) < 0)
-				return -1;
+		for (i = 0; i < 256; i++) {
+			const unsigned int c = count[i];
+
+			if (c == (unsigned int)n)
+				skip = 1;
+
+			count[i] = pos;
+			pos += c;
 		}
+
+		if (skip)
+			continue;
+
+		for (i = 0; i < n; i++)
+			tmp[count[edge_digit(&a[i], pass, by_dst)]++] = a[i];
+
+		t = a;
+		a = tmp;
+		tmp = t;
+	}
+
+	if (a != (struct cg_edge *)v->ptr) {
+		memcpy(v->ptr, a, sizeof(a[0]) * n);
+		tmp = a;
+	}
+
+	free(tmp);
+}
+
+/* Calls and branches are found using the instruction index, which
+ * lists them in address order.
+ */
+static int add_branch_edges(struct insndb *db, msp430_op_t op,
+			    struct call_graph *graph)
+{
+	const address_t end = graph->offset + graph->len;
+	const struct insndb_term *t;
+	int count;
+	int i;
+
+	t = insndb_find(db, INSNDB_KEY_OP, op, graph->offset, end, &count);
+	if (!t)
+		return -1;
+
+	for (i = 0; i < count; i++) {
+		struct msp430_instruction insn;
+		struct cg_edge br;
+
+		if (insndb_decode(db, t[i].addr, end, &insn) < 0 ||
+		    insn.dst_mode != MSP430_AMODE_IMMEDIATE ||
+		    (insn.dst_addr & 1))
+			continue;
+
+		br.src = t[i].addr;
+		br.dst = insn.dst_addr;
+		br.is_tail_call = op != MSP430_OP_CALL;
+
+		if (vector_push(&graph->edge_from, &br, 1) < 0)
+			return -1;
 	}
 
 	return 0;
 }
 
+static int find_possible_edges(struct insndb *db, struct call_graph *graph)
+{
+	if (add_branch_edges(db, MSP430_OP_CALL, graph) < 0 ||
+	    add_branch_edges(db, MSP430_OP_BR, graph) < 0)
+		return -1;
+
+	return 0;
+}
+
 static int add_nodes_from_edges(struct call_graph *graph)
 {
 	int i;
 	address_t last_addr = 0;
 	int have_last_addr = 0;
 
-	qsort(graph->edge_from.ptr, graph->edge_from.size,
-	      graph->edge_from.elemsize, cmp_branch_by_dst);
+	sort_edges(&graph->edge_from, 1);
 
 	/* Look for unique destination addresses */
 	for (i = 0; i < graph->edge_from.size; i++) {
@@ -602,8 +764,7 @@ static void relabel_sources(struct call_graph *graph)
 	int j = 0; /* Edge index */
 
 	/* Identify the source nodes for each edge */
-	qsort(graph->edge_from.ptr, graph->edge_from.size,
-	      graph->edge_from.elemsize, cmp_branch_by_src);
+	sort_edges(&graph->edge_from, 0);
 
 	while (j < graph->edge_from.size) {
 		struct cg_edge *br = CG_EDGE_FROM(graph, j);
@@ -650,8 +811,7 @@ static void remove_duplicate_edges(struct call_graph *graph)
 	int i = 0; /* Source index */
 	int j = 0; /* Destination index */
 
-	qsort(graph->edge_from.ptr, graph->edge_from.size,
-	      graph->edge_from.elemsize, cmp_branch_by_src);
+	sort_edges(&graph->edge_from, 0);
 
 	while (i < graph->edge_from.size) {
 		struct cg_edge *e = CG_EDGE_FROM(graph, i);
@@ -680,14 +840,13 @@ static int build_inverse(struct call_graph *graph)
 			graph->edge_from.size) < 0)
 		return -1;
 
-	qsort(graph->edge_to.ptr, graph->edge_to.size,
-	      graph->edge_to.elemsize, cmp_branch_by_dst);
+	sort_edges(&graph->edge_to, 1);
 
 	return 0;
 }
 
-static int add_irq_edges(address_t offset, address_t len, uint8_t *memory,
-			 struct call_graph *graph)
+static int add_irq_edges(address_t offset, address_t len,
+			 const uint8_t *memory, struct call_graph *graph)
 {
 	int i;
 
@@ -746,7 +905,7 @@ static int add_symbol_nodes(void *user_data, const char *name,
 	return 0;
 }
 
-static int cgraph_init(address_t offset, address_t len, uint8_t *memory,
+static int cgraph_init(address_t offset, address_t len, struct insndb *db,
 		       struct call_graph *graph)
 {
 	vector_init(&graph->edge_to, sizeof(struct cg_edge));
@@ -756,9 +915,9 @@ static int cgraph_init(address_t offset, address_t len, uint8_t *memory,
 	graph->offset = offset;
 	graph->len = len;
 
-	if (find_possible_edges(offset, len, memory, graph) < 0)
+	if (find_possible_edges(db, graph) < 0)
 		goto fail;
-	if (add_irq_edges(offset, len, memory, graph) < 0)
+	if (add_irq_edges(offset, len, insndb_mem(db, offset), graph) < 0)
 		goto fail;
 
 	if (stab_enum(add_symbol_nodes, graph) < 0)
@@ -888,7 +1047,7 @@ int cmd_cgraph(char **arg)
 {
 	char *offset_text, *len_text, *addr_text;;
 	address_t offset, len, addr;
-	uint8_t *memory;
+	struct insndb *db;
 	struct call_graph graph;
 
 	/* Figure out what the arguments are */
@@ -920,26 +1079,17 @@ int cmd_cgraph(char **arg)
 	}
 
 	/* Grab the memory to be analysed */
-	memory = malloc(len);
-	if (!memory) {
-		printc_err("cgraph: couldn't allocate memory: %s\n",
-			last_error());
-		return -1;
-	}
-
-	if (device_readmem(offset, memory, len) < 0) {
+	db = insndb_get(offset, offset + len);
+	if (!db) {
 		printc_err("cgraph: couldn't fetch memory\n");
-		free(memory);
 		return -1;
 	}
 
 	/* Produce and display the call graph */
-	if (cgraph_init(offset, len, memory, &graph) < 0) {
+	if (cgraph_init(offset, len, db, &graph) < 0) {
 		printc_err("cgraph: couldn't build call graph\n");
-		free(memory);
 		return -1;
 	}
-	free(memory);
 
 	if (addr_text)
 		cgraph_func_info(&graph, addr);
@@ -949,3 +1099,1103 @@ int cmd_cgraph(char **arg)
 	cgraph_destroy(&graph);
 	return 0;
 }
+
+/************************************************************************
+ * Worst-case execution time ("wcet")
+ */
+
+/* Functions are the nodes of the call graph, plus any interrupt
+ * handlers named by the user. Each is analysed once, after its callees,
+ * and either gets a bound or the reason it can't be bounded.
+ */
+#define WCET_UNSEEN		0
+#define WCET_BUSY		1
+#define WCET_DONE		2
+
+/* Bounds at or above this are reported as an overflow */
+#define WCET_LIMIT		(1LL << 62)
+#define WCET_NONE		(-1LL)
+
+struct wcet_bound {
+	address_t		addr;
+	address_t		count;
+};
+
+struct wcet_func {
+	address_t		addr;
+	int			is_irq;
+
+	int			state;
+	long long		cycles;
+
+	/* Why the function can't be bounded, or NULL if it can */
+	const char		*fault;
+	address_t		fault_addr;
+};
+
+struct wcet {
+	address_t		offset;
+	address_t		len;
+	int			cpux;
+	struct insndb		*db;
+
+	struct vector		bounds;
+	struct vector		funcs;
+
+	/* Node index of each even address in the range, while a
+	 * function's flow graph is being built, or -1.
+	 */
+	int			*slot;
+};
+
+#define WCET_FUNC(w, i) (VECTOR_PTR((w)->funcs, (i), struct wcet_func))
+
+/* One node for each instruction reachable from a function's entry */
+struct wcet_node {
+	address_t		addr;
+	int			cycles;
+	int			callee;
+
+	int			nsucc;
+	int			succ[2];
+};
+
+/* A loop is the natural loop of all back edges to its header. Once
+ * its bound is found, the loop is collapsed into its header, which
+ * then stands for the whole body.
+ */
+struct wcet_loop {
+	int			header;
+	address_t		count;
+	struct vector		body;
+};
+
+struct wcet_graph {
+	struct vector		nodes;
+	struct vector		loops;
+
+	/* Per node: the header of the outermost collapsed loop
+	 * containing it (or itself), the loop it heads, and its cost.
+	 */
+	int			*rep;
+	int			*loop_of;
+	long long		*cost;
+
+	/* Scratch space for path searches */
+	int			*state;
+	long long		*val;
+	int			*region;
+	int			stamp;
+};
+
+#define WCET_NODE(g, i) (VECTOR_PTR((g)->nodes, (i), struct wcet_node))
+#define WCET_LOOP(g, i) (VECTOR_PTR((g)->loops, (i), struct wcet_loop))
+
+static int wcet_find_func(struct wcet *w, address_t addr)
+{
+	int lo = 0;
+	int hi = w->funcs.size;
+
+	while (lo < hi) {
+		const int mid = (lo + hi) >> 1;
+		const address_t a = WCET_FUNC(w, mid)->addr;
+
+		if (a == addr)
+			return mid;
+
+		if (a < addr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return -1;
+}
+
+static const struct wcet_bound *wcet_find_bound(const struct wcet *w,
+						address_t addr)
+{
+	int i;
+
+	for (i = 0; i < w->bounds.size; i++) {
+		const struct wcet_bound *b =
+			VECTOR_PTR(w->bounds, i, struct wcet_bound);
+
+		if (b->addr == addr)
+			return b;
+	}
+
+	return NULL;
+}
+
+static void wcet_fault(struct wcet_func *f, const char *fault,
+		       address_t addr)
+{
+	if (!f->fault) {
+		f->fault = fault;
+		f->fault_addr = addr;
+	}
+}
+
+static long long wcet_add(long long a, long long b)
+{
+	return (a >= WCET_LIMIT - b) ? WCET_LIMIT : a + b;
+}
+
+static void wcet_graph_destroy(struct wcet_graph *g)
+{
+	int i;
+
+	for (i = 0; i < g->loops.size; i++)
+		vector_destroy(&WCET_LOOP(g, i)->body);
+
+	vector_destroy(&g->nodes);
+	vector_destroy(&g->loops);
+
+	free(g->rep);
+	free(g->loop_of);
+	free(g->cost);
+	free(g->state);
+	free(g->val);
+	free(g->region);
+}
+
+/* Flow graph construction */
+
+static int wcet_node_at(struct wcet *w, struct wcet_graph *g,
+			struct wcet_func *f, address_t addr)
+{
+	const address_t end = w->offset + w->len;
+	struct wcet_node n;
+	int *s;
+
+	if (addr < w->offset || addr >= end || (addr & 1)) {
+		wcet_fault(f, "control flow leaves range", addr);
+		return -1;
+	}
+
+	s = &w->slot[(addr - w->offset) >> 1];
+	if (*s >= 0)
+		return *s;
+
+	memset(&n, 0, sizeof(n));
+	n.addr = addr;
+	n.callee = -1;
+
+	if (vector_push(&g->nodes, &n, 1) < 0)
+		return -2;
+
+	*s = g->nodes.size - 1;
+	return *s;
+}
+
+static int wcet_add_succ(struct wcet *w, struct wcet_graph *g,
+			 struct wcet_func *f, int i, address_t addr)
+{
+	const int j = wcet_node_at(w, g, f, addr);
+
+	if (j < 0)
+		return j;
+
+	WCET_NODE(g, i)->succ[WCET_NODE(g, i)->nsucc++] = j;
+	return 0;
+}
+
+/* Does the instruction write to PC other than as a branch, call or
+ * return we can follow?
+ */
+static int writes_pc(const struct msp430_instruction *insn)
+{
+	if (insn->dst_mode != MSP430_AMODE_REGISTER ||
+	    insn->dst_reg != MSP430_REG_PC)
+		return 0;
+
+	switch (insn->op) {
+	case MSP430_OP_PUSH:
+	case MSP430_OP_PUSHX:
+	case MSP430_OP_CALL:
+	case MSP430_OP_CALLA:
+	case MSP430_OP_CMP:
+	case MSP430_OP_CMPX:
+	case MSP430_OP_CMPA:
+	case MSP430_OP_BIT:
+	case MSP430_OP_BITX:
+	case MSP430_OP_TST:
+	case MSP430_OP_TSTX:
+	case MSP430_OP_TSTA:
+		return 0;
+
+	default:
+		break;
+	}
+
+	return 1;
+}
+
+/* Decode one instruction and find its successors. Returns -1 if the
+ * function can't be bounded, or -2 if an error occurs.
+ */
+static int wcet_visit(struct wcet *w, struct wcet_graph *g,
+		      struct wcet_func *f, int i)
+{
+	const address_t end = w->offset + w->len;
+	const address_t addr = WCET_NODE(g, i)->addr;
+	struct msp430_instruction insn;
+	int cycles;
+	int ret = 0;
+
+	if (insndb_decode(w->db, addr, end, &insn) < 0) {
+		wcet_fault(f, "invalid instruction", addr);
+		return -1;
+	}
+
+	cycles = cycles_insn(insndb_mem(w->db, addr), end - addr, w->cpux);
+	if (cycles < 0) {
+		wcet_fault(f, "unknown instruction timing", addr);
+		return -1;
+	}
+
+	WCET_NODE(g, i)->cycles = cycles;
+
+	switch (insn.op) {
+	case MSP430_OP_RET:
+	case MSP430_OP_RETA:
+	case MSP430_OP_RETI:
+		return 0;
+
+	case MSP430_OP_JMP:
+		return wcet_add_succ(w, g, f, i, insn.dst_addr);
+
+	case MSP430_OP_CALL:
+	case MSP430_OP_CALLA:
+	case MSP430_OP_BR:
+	case MSP430_OP_BRA:
+		if (insn.dst_mode != MSP430_AMODE_IMMEDIATE) {
+			wcet_fault(f, "indirect call or branch", addr);
+			return -1;
+		}
+
+		WCET_NODE(g, i)->callee = wcet_find_func(w, insn.dst_addr);
+		if (WCET_NODE(g, i)->callee < 0) {
+			wcet_fault(f, "call to unknown function", addr);
+			return -1;
+		}
+
+		/* Branches to other functions are tail calls */
+		if (insn.op == MSP430_OP_BR || insn.op == MSP430_OP_BRA)
+			return 0;
+		break;
+
+	default:
+		if (insn.itype == MSP430_ITYPE_JUMP)
+			ret = wcet_add_succ(w, g, f, i, insn.dst_addr);
+
+		if (writes_pc(&insn)) {
+			wcet_fault(f, "computed branch", addr);
+			return -1;
+		}
+		break;
+	}
+
+	if (ret < 0)
+		return ret;
+
+	return wcet_add_succ(w, g, f, i, addr + insn.len);
+}
+
+static int wcet_build(struct wcet *w, struct wcet_graph *g,
+		      struct wcet_func *f)
+{
+	int ret;
+	int i;
+
+	ret = wcet_node_at(w, g, f, f->addr);
+
+	for (i = 0; ret >= 0 && i < g->nodes.size; i++)
+		ret = wcet_visit(w, g, f, i);
+
+	for (i = 0; i < g->nodes.size; i++)
+		w->slot[(WCET_NODE(g, i)->addr - w->offset) >> 1] = -1;
+
+	return ret < -1 ? -1 : 0;
+}
+
+/* Loops */
+
+static int cmp_loop_size(const void *a, const void *b)
+{
+	const struct wcet_loop *x = (const struct wcet_loop *)a;
+	const struct wcet_loop *y = (const struct wcet_loop *)b;
+
+	if (x->body.size != y->body.size)
+		return x->body.size - y->body.size;
+
+	return x->header - y->header;
+}
+
+/* Find back edges by depth-first search from the entry. For each
+ * target, g->loop_of is set to a new loop, and the back edge sources
+ * are added to its body. The rest of the body is filled in later.
+ */
+static int find_back_edges(struct wcet_graph *g)
+{
+	const int n = g->nodes.size;
+	int *stack = malloc(sizeof(stack[0]) * n * 2 + 1);
+	int sp = 0;
+	int ret = 0;
+
+	if (!stack)
+		return -1;
+
+	memset(g->state, 0, sizeof(g->state[0]) * n);
+
+	stack[sp++] = 0;
+	stack[sp++] = 0;
+	g->state[0] = 1;
+
+	while (sp && !ret) {
+		const int u = stack[sp - 2];
+		const struct wcet_node *un = WCET_NODE(g, u);
+		int v;
+
+		if (stack[sp - 1] >= un->nsucc) {
+			g->state[u] = 2;
+			sp -= 2;
+			continue;
+		}
+
+		v = un->succ[stack[sp - 1]++];
+
+		if (!g->state[v]) {
+			g->state[v] = 1;
+			stack[sp++] = v;
+			stack[sp++] = 0;
+		} else if (g->state[v] == 1) {
+			struct wcet_loop *l;
+
+			if (g->loop_of[v] < 0) {
+				struct wcet_loop nl;
+
+				nl.header = v;
+				nl.count = 0;
+				vector_init(&nl.body, sizeof(int));
+
+				if (vector_push(&g->loops, &nl, 1) < 0) {
+					ret = -1;
+					break;
+				}
+
+				g->loop_of[v] = g->loops.size - 1;
+			}
+
+			l = WCET_LOOP(g, g->loop_of[v]);
+			if (vector_push(&l->body, &u, 1) < 0)
+				ret = -1;
+		}
+	}
+
+	free(stack);
+	return ret;
+}
+
+/* Fill in the body of a loop, given the sources of its back edges, by
+ * working backwards to the header. If any node in the body can be
+ * entered other than through the header, the loop is irreducible.
+ */
+static int fill_loop(struct wcet_graph *g, const int *pred_start,
+		     const int *pred, struct wcet_loop *l,
+		     struct wcet_func *f)
+{
+	const int stamp = ++g->stamp;
+	int i;
+
+	g->region[l->header] = stamp;
+
+	for (i = 0; i < l->body.size; i++)
+		g->region[*VECTOR_PTR(l->body, i, int)] = stamp;
+
+	/* The body grows as we go, and is used as the work queue */
+	for (i = 0; i < l->body.size; i++) {
+		const int x = *VECTOR_PTR(l->body, i, int);
+		int j;
+
+		if (x == l->header)
+			continue;
+
+		for (j = pred_start[x]; j < pred_start[x + 1]; j++) {
+			const int p = pred[j];
+
+			if (g->region[p] == stamp)
+				continue;
+
+			g->region[p] = stamp;
+			if (vector_push(&l->body, &p, 1) < 0)
+				return -1;
+		}
+	}
+
+	if (vector_push(&l->body, &l->header, 1) < 0)
+		return -1;
+
+	for (i = 0; i < l->body.size; i++) {
+		const int x = *VECTOR_PTR(l->body, i, int);
+		int j;
+
+		if (x == l->header)
+			continue;
+
+		if (!x) {
+			wcet_fault(f, "loop has more than one entry",
+				   WCET_NODE(g, l->header)->addr);
+			return 0;
+		}
+
+		for (j = pred_start[x]; j < pred_start[x + 1]; j++)
+			if (g->region[pred[j]] != stamp) {
+				wcet_fault(f, "loop has more than one entry",
+					   WCET_NODE(g, l->header)->addr);
+				return 0;
+			}
+	}
+
+	return 0;
+}
+
+static int find_loops(struct wcet *w, struct wcet_graph *g,
+		      struct wcet_func *f)
+{
+	const int n = g->nodes.size;
+	int *pred_start;
+	int *pred;
+	int ret = 0;
+	int i;
+
+	if (find_back_edges(g) < 0)
+		return -1;
+
+	if (!g->loops.size)
+		return 0;
+
+	/* Predecessor lists, for filling in loop bodies */
+	pred_start = calloc(n + 2, sizeof(pred_start[0]));
+	pred = malloc(sizeof(pred[0]) * n * 2 + 1);
+	if (!(pred_start && pred)) {
+		free(pred_start);
+		free(pred);
+		return -1;
+	}
+
+	for (i = 0; i < n; i++) {
+		const struct wcet_node *x = WCET_NODE(g, i);
+		int j;
+
+		for (j = 0; j < x->nsucc; j++)
+			pred_start[x->succ[j] + 2]++;
+	}
+
+	for (i = 2; i < n + 2; i++)
+		pred_start[i] += pred_start[i - 1];
+
+	for (i = 0; i < n; i++) {
+		const struct wcet_node *x = WCET_NODE(g, i);
+		int j;
+
+		for (j = 0; j < x->nsucc; j++)
+			pred[pred_start[x->succ[j] + 1]++] = i;
+	}
+
+	for (i = 0; i < g->loops.size && !f->fault; i++) {
+		struct wcet_loop *l = WCET_LOOP(g, i);
+		const address_t addr = WCET_NODE(g, l->header)->addr;
+		const struct wcet_bound *b = wcet_find_bound(w, addr);
+
+		if (!b) {
+			wcet_fault(f, "no bound for loop", addr);
+			break;
+		}
+
+		l->count = b->count;
+		if (fill_loop(g, pred_start, pred, l, f) < 0) {
+			ret = -1;
+			break;
+		}
+	}
+
+	free(pred_start);
+	free(pred);
+
+	/* Inner loops are collapsed first */
+	qsort(g->loops.ptr, g->loops.size, g->loops.elemsize,
+	      cmp_loop_size);
+
+	for (i = 0; i < n; i++)
+		g->loop_of[i] = -1;
+
+	return ret;
+}
+
+/* Longest paths */
+
+#define WCET_PATH_ITER		0
+#define WCET_PATH_EXIT		1
+
+struct wcet_frame {
+	int			s;
+	int			m;
+	int			k;
+	long long		best;
+};
+
+/* Members of a node: the body of the loop it heads, if it has been
+ * collapsed, otherwise just the node itself.
+ */
+static int member_count(const struct wcet_graph *g, int s)
+{
+	return g->loop_of[s] >= 0 ?
+		WCET_LOOP(g, g->loop_of[s])->body.size : 1;
+}
+
+static int member(const struct wcet_graph *g, int s, int m)
+{
+	return g->loop_of[s] >= 0 ?
+		*VECTOR_PTR(WCET_LOOP(g, g->loop_of[s])->body, m, int) : s;
+}
+
+static void take_best(long long *best, long long v)
+{
+	if (v != WCET_NONE && (*best == WCET_NONE || v > *best))
+		*best = v;
+}
+
+/* Find the longest path from the start, through nodes in the current
+ * region (those whose region stamp is current), where each node costs
+ * g->cost cycles. In ITER mode, paths end with an edge back to the
+ * header. In EXIT mode, they end at an edge leaving the region or at a
+ * node with no successors. Returns WCET_NONE if there are no such
+ * paths, or -2 if the region contains a cycle.
+ */
+static long long wcet_path(struct wcet_graph *g, int start, int header,
+			   int mode)
+{
+	const int n = g->nodes.size;
+	struct wcet_frame *stack = malloc(sizeof(stack[0]) * n);
+	long long ret = WCET_NONE;
+	int sp = 0;
+	int i;
+
+	if (!stack)
+		return -3;
+
+	for (i = 0; i < n; i++)
+		g->state[i] = 0;
+
+	stack[sp].s = start;
+	stack[sp].m = 0;
+	stack[sp].k = 0;
+	stack[sp].best = WCET_NONE;
+	g->state[start] = 1;
+	sp++;
+
+	while (sp) {
+		struct wcet_frame *fr = &stack[sp - 1];
+		const struct wcet_node *x;
+		int t;
+
+		if (fr->m >= member_count(g, fr->s)) {
+			const long long v = fr->best == WCET_NONE ?
+				WCET_NONE : wcet_add(g->cost[fr->s], fr->best);
+
+			g->state[fr->s] = 2;
+			g->val[fr->s] = v;
+
+			if (!--sp)
+				ret = v;
+			else
+				take_best(&stack[sp - 1].best, v);
+
+			continue;
+		}
+
+		x = WCET_NODE(g, member(g, fr->s, fr->m));
+
+		if (!x->nsucc && mode == WCET_PATH_EXIT)
+			take_best(&fr->best, 0);
+
+		if (fr->k >= x->nsucc) {
+			fr->m++;
+			fr->k = 0;
+			continue;
+		}
+
+		t = g->rep[x->succ[fr->k++]];
+
+		if (t == header) {
+			if (mode == WCET_PATH_ITER)
+				take_best(&fr->best, 0);
+		} else if (t == fr->s) {
+			continue;
+		} else if (g->region[t] != g->stamp) {
+			if (mode == WCET_PATH_EXIT)
+				take_best(&fr->best, 0);
+		} else if (g->state[t] == 2) {
+			take_best(&fr->best, g->val[t]);
+		} else if (g->state[t] == 1) {
+			ret = -2;
+			break;
+		} else {
+			g->state[t] = 1;
+			stack[sp].s = t;
+			stack[sp].m = 0;
+			stack[sp].k = 0;
+			stack[sp].best = WCET_NONE;
+			sp++;
+		}
+	}
+
+	free(stack);
+	return ret;
+}
+
+static int collapse_loop(struct wcet_graph *g, int li, struct wcet_func *f)
+{
+	const struct wcet_loop *l = WCET_LOOP(g, li);
+	const address_t addr = WCET_NODE(g, l->header)->addr;
+	long long iter;
+	long long exit;
+	int i;
+
+	g->stamp++;
+	for (i = 0; i < l->body.size; i++)
+		g->region[g->rep[*VECTOR_PTR(l->body, i, int)]] = g->stamp;
+
+	iter = wcet_path(g, l->header, l->header, WCET_PATH_ITER);
+	exit = wcet_path(g, l->header, l->header, WCET_PATH_EXIT);
+
+	if (iter == -3 || exit == -3)
+		return -1;
+
+	if (iter == -2 || exit == -2) {
+		wcet_fault(f, "irreducible loop", addr);
+		return 0;
+	}
+
+	if (exit == WCET_NONE) {
+		wcet_fault(f, "loop never exits", addr);
+		return 0;
+	}
+
+	/* The header runs at most count times, and the last time, the
+	 * loop is left.
+	 */
+	if (iter > 0 && l->count - 1 > (WCET_LIMIT - exit) / iter) {
+		g->cost[l->header] = WCET_LIMIT;
+	} else {
+		g->cost[l->header] = (long long)(l->count - 1) *
+			(iter == WCET_NONE ? 0 : iter) + exit;
+	}
+
+	for (i = 0; i < l->body.size; i++)
+		g->rep[*VECTOR_PTR(l->body, i, int)] = l->header;
+
+	g->loop_of[l->header] = li;
+	return 0;
+}
+
+/* Analysis */
+
+static int wcet_func(struct wcet *w, int fi);
+
+static int wcet_costs(struct wcet *w, struct wcet_graph *g,
+		      struct wcet_func *f)
+{
+	int i;
+
+	for (i = 0; i < g->nodes.size && !f->fault; i++) {
+		const struct wcet_node *x = WCET_NODE(g, i);
+		const struct wcet_func *c;
+
+		g->cost[i] = x->cycles;
+		if (x->callee < 0)
+			continue;
+
+		if (wcet_func(w, x->callee) < 0)
+			return -1;
+
+		c = WCET_FUNC(w, x->callee);
+		if (c->state == WCET_BUSY)
+			wcet_fault(f, "recursive call", x->addr);
+		else if (c->fault)
+			wcet_fault(f, "calls unbounded function", c->addr);
+		else
+			g->cost[i] = wcet_add(g->cost[i], c->cycles);
+	}
+
+	return 0;
+}
+
+static int wcet_analyse(struct wcet *w, struct wcet_graph *g,
+			struct wcet_func *f)
+{
+	const int n = g->nodes.size;
+	long long total;
+	int i;
+
+	g->rep = malloc(sizeof(g->rep[0]) * n);
+	g->loop_of = malloc(sizeof(g->loop_of[0]) * n);
+	g->cost = malloc(sizeof(g->cost[0]) * n);
+	g->state = malloc(sizeof(g->state[0]) * n);
+	g->val = malloc(sizeof(g->val[0]) * n);
+	g->region = calloc(n, sizeof(g->region[0]));
+
+	if (!(g->rep && g->loop_of && g->cost && g->state && g->val &&
+	      g->region))
+		return -1;
+
+	for (i = 0; i < n; i++) {
+		g->rep[i] = i;
+		g->loop_of[i] = -1;
+	}
+
+	if (wcet_costs(w, g, f) < 0 || find_loops(w, g, f) < 0)
+		return -1;
+
+	for (i = 0; i < g->loops.size && !f->fault; i++)
+		if (collapse_loop(g, i, f) < 0)
+			return -1;
+
+	if (f->fault)
+		return 0;
+
+	g->stamp++;
+	for (i = 0; i < n; i++)
+		g->region[g->rep[i]] = g->stamp;
+
+	total = wcet_path(g, g->rep[0], -1, WCET_PATH_EXIT);
+	if (total == -3)
+		return -1;
+
+	if (total == -2)
+		wcet_fault(f, "irreducible loop", f->addr);
+	else if (total == WCET_NONE)
+		wcet_fault(f, "never returns", f->addr);
+	else if (total >= WCET_LIMIT)
+		wcet_fault(f, "bound too large", f->addr);
+	else
+		f->cycles = total;
+
+	return 0;
+}
+
+static int wcet_func(struct wcet *w, int fi)
+{
+	struct wcet_func *f = WCET_FUNC(w, fi);
+	struct wcet_graph g;
+	int ret = 0;
+
+	if (f->state != WCET_UNSEEN)
+		return 0;
+
+	f->state = WCET_BUSY;
+
+	memset(&g, 0, sizeof(g));
+	vector_init(&g.nodes, sizeof(struct wcet_node));
+	vector_init(&g.loops, sizeof(struct wcet_loop));
+
+	if (wcet_build(w, &g, f) < 0)
+		ret = -1;
+	else if (!f->fault && wcet_analyse(w, &g, f) < 0)
+		ret = -1;
+
+	wcet_graph_destroy(&g);
+	f->state = WCET_DONE;
+	return ret;
+}
+
+/* Report */
+
+static int cmp_func_addr(const void *a, const void *b)
+{
+	const struct wcet_func *x = (const struct wcet_func *)a;
+	const struct wcet_func *y = (const struct wcet_func *)b;
+
+	if (x->addr != y->addr)
+		return x->addr < y->addr ? -1 : 1;
+
+	return 0;
+}
+
+static int cmp_func_rank(const void *a, const void *b)
+{
+	const struct wcet_func *x = *(const struct wcet_func **)a;
+	const struct wcet_func *y = *(const struct wcet_func **)b;
+
+	if (!x->fault != !y->fault)
+		return x->fault ? 1 : -1;
+
+	if (!x->fault && x->cycles != y->cycles)
+		return x->cycles > y->cycles ? -1 : 1;
+
+	return cmp_func_addr(x, y);
+}
+
+static void wcet_report(struct wcet *w)
+{
+	const struct wcet_func **rank;
+	int i;
+
+	rank = malloc(sizeof(rank[0]) * w->funcs.size + 1);
+	if (!rank) {
+		pr_error("wcet: can't allocate memory");
+		return;
+	}
+
+	for (i = 0; i < w->funcs.size; i++)
+		rank[i] = WCET_FUNC(w, i);
+
+	qsort(rank, w->funcs.size, sizeof(rank[0]), cmp_func_rank);
+
+	for (i = 0; i < w->funcs.size; i++) {
+		const struct wcet_func *f = rank[i];
+		char name[64];
+
+		print_address(f->addr, name, sizeof(name), 0);
+
+		if (f->fault) {
+			char where[64];
+
+			print_address(f->fault_addr, where, sizeof(where), 0);
+			printc("0x%04x %10s %-3s %s: %s at %s\n",
+			       f->addr, "?", f->is_irq ? "irq" : "", name,
+			       f->fault, where);
+		} else {
+			printc("0x%04x %10lld %-3s %s\n",
+			       f->addr, f->cycles, f->is_irq ? "irq" : "",
+			       name);
+		}
+	}
+
+	free(rank);
+}
+
+/* Functions are the call graph's nodes within the range, plus the
+ * interrupt handlers given by the user. Handlers named in the vector
+ * table (other than reset) are also marked.
+ */
+static int wcet_add_func(struct wcet *w, address_t addr, int is_irq)
+{
+	struct wcet_func f;
+
+	memset(&f, 0, sizeof(f));
+	f.addr = addr;
+	f.is_irq = is_irq;
+
+	return vector_push(&w->funcs, &f, 1);
+}
+
+static int wcet_init_funcs(struct wcet *w, struct call_graph *graph,
+			   const struct vector *irqs)
+{
+	const address_t end = w->offset + w->len;
+	address_t a;
+	int i;
+	int j = 0;
+
+	for (i = 0; i < graph->node_list.size; i++) {
+		const address_t addr = CG_NODE(graph, i)->offset;
+
+		if (addr >= w->offset && addr < end && !(addr & 1) &&
+		    wcet_add_func(w, addr, 0) < 0)
+			return -1;
+	}
+
+	for (i = 0; i < irqs->size; i++)
+		if (wcet_add_func(w, *VECTOR_PTR(*irqs, i, address_t), 1) < 0)
+			return -1;
+
+	/* Sort, and merge duplicates */
+	qsort(w->funcs.ptr, w->funcs.size, w->funcs.elemsize,
+	      cmp_func_addr);
+
+	for (i = 0; i < w->funcs.size; i++) {
+		const struct wcet_func *f = WCET_FUNC(w, i);
+
+		if (j && WCET_FUNC(w, j - 1)->addr == f->addr) {
+			WCET_FUNC(w, j - 1)->is_irq |= f->is_irq;
+			continue;
+		}
+
+		if (i != j)
+			memcpy(WCET_FUNC(w, j), f, sizeof(*f));
+		j++;
+	}
+
+	w->funcs.size = j;
+
+	for (a = 0xffe0; a < 0xfffe; a += 2) {
+		const uint8_t *v;
+		int fi;
+
+		if (a < w->offset || a + 2 > end)
+			continue;
+
+		v = insndb_mem(w->db, a);
+		fi = wcet_find_func(w, v[0] | (v[1] << 8));
+		if (fi >= 0)
+			WCET_FUNC(w, fi)->is_irq = 1;
+	}
+
+	return 0;
+}
+
+static int wcet_parse(struct wcet *w, char **arg, struct vector *irqs)
+{
+	const char *term;
+
+	while ((term = get_arg(arg))) {
+		if (!strcasecmp(term, "cpu")) {
+			w->cpux = 0;
+		} else if (!strcasecmp(term, "cpux")) {
+			w->cpux = 1;
+		} else if (!strcasecmp(term, "irq")) {
+			const char *addr_text = get_arg(arg);
+			address_t addr;
+
+			if (!addr_text) {
+				printc_err("wcet: expected address after "
+					   "\"irq\"\n");
+				return -1;
+			}
+
+			if (expr_eval(addr_text, &addr) < 0)
+				return -1;
+
+			if (vector_push(irqs, &addr, 1) < 0) {
+				pr_error("wcet: can't allocate memory");
+				return -1;
+			}
+		} else if (!strcasecmp(term, "loop")) {
+			const char *addr_text = get_arg(arg);
+			const char *count_text = get_arg(arg);
+			struct wcet_bound b;
+
+			if (!(addr_text && count_text)) {
+				printc_err("wcet: expected address and "
+					   "count after \"loop\"\n");
+				return -1;
+			}
+
+			if (expr_eval(addr_text, &b.addr) < 0 ||
+			    expr_eval(count_text, &b.count) < 0)
+				return -1;
+
+			if (!b.count) {
+				printc_err("wcet: loop count must be at "
+					   "least 1\n");
+				return -1;
+			}
+
+			if (vector_push(&w->bounds, &b, 1) < 0) {
+				pr_error("wcet: can't allocate memory");
+				return -1;
+			}
+		} else {
+			printc_err("wcet: unknown option: %s\n", term);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+int cmd_wcet(char **arg)
+{
+	const char *offset_text = get_arg(arg);
+	const char *len_text = get_arg(arg);
+	struct call_graph graph;
+	struct vector irqs;
+	struct wcet w;
+	int ret = -1;
+	int i;
+
+	if (!(offset_text && len_text)) {
+		printc_err("wcet: offset and length must be specified\n");
+		return -1;
+	}
+
+	memset(&w, 0, sizeof(w));
+	vector_init(&w.bounds, sizeof(struct wcet_bound));
+	vector_init(&w.funcs, sizeof(struct wcet_func));
+	vector_init(&irqs, sizeof(address_t));
+
+	if (expr_eval(offset_text, &w.offset) < 0) {
+		printc_err("wcet: invalid offset: %s\n", offset_text);
+		goto out;
+	}
+	w.offset &= ~1;
+
+	if (expr_eval(len_text, &w.len) < 0) {
+		printc_err("wcet: invalid length: %s\n", len_text);
+		goto out;
+	}
+	w.len &= ~1;
+
+	/* Use CPUX timing for 20-bit devices, unless told otherwise */
+	w.cpux = device_default->chip && device_default->chip->bits == 20;
+
+	if (wcet_parse(&w, arg, &irqs) < 0)
+		goto out;
+
+	w.db = insndb_get(w.offset, w.offset + w.len);
+	if (!w.db) {
+		printc_err("wcet: couldn't fetch memory\n");
+		goto out;
+	}
+
+	if (cgraph_init(w.offset, w.len, w.db, &graph) < 0) {
+		printc_err("wcet: couldn't build call graph\n");
+		goto out;
+	}
+
+	i = wcet_init_funcs(&w, &graph, &irqs);
+	cgraph_destroy(&graph);
+	if (i < 0) {
+		pr_error("wcet: can't allocate memory");
+		goto out;
+	}
+
+	w.slot = malloc(sizeof(w.slot[0]) * (w.len >> 1) + 1);
+	if (!w.slot) {
+		pr_error("wcet: can't allocate memory");
+		goto out;
+	}
+
+	for (i = 0; i < (w.len >> 1); i++)
+		w.slot[i] = -1;
+
+	for (i = 0; i < w.funcs.size; i++)
+		if (wcet_func(&w, i) < 0) {
+			printc_err("wcet: can't allocate memory for "
+				   "analysis\n");
+			goto out;
+		}
+
+	/* Interrupt handlers also pay for the CPU accepting the
+	 * interrupt.
+	 */
+	for (i = 0; i < w.funcs.size; i++) {
+		struct wcet_func *f = WCET_FUNC(&w, i);
+
+		if (f->is_irq && !f->fault)
+			f->cycles += CYCLES_IRQ_ENTRY;
+	}
+
+	wcet_report(&w);
+	ret = 0;
+
+out:
+	free(w.slot);
+	vector_destroy(&w.bounds);
+	vector_destroy(&w.funcs);
+	vector_destroy(&irqs);
+	return ret;
+}
@@ -21,5 +21,6 @@
 
 int cmd_isearch(char **arg);
 int cmd_cgraph(char **arg);
+int cmd_wcet(char **arg);
 
 #endif
@@ -26,6 +26,7 @@
 #include "stab.h"
 #include "expr.h"
 #include "binfile.h"
+#include "imgcache.h"
 #include "util.h"
 #include "output.h"
 #include "output_util.h"
@@ -54,6 +55,7 @@ static int cmd_sym_load_add(int clear, char **arg)
 {
 	FILE *in;
 	char * path;
+	int ret;
 
 	if (clear && prompt_abort(MODIFY_SYMS))
 		return 0;
@@ -63,27 +65,29 @@ static int cmd_sym_load_add(int clear, char **arg)
 		return -1;
 
 	in = fopen(path, "rb");
-	free(path);
 	if (!in) {
 		printc_err("sym: %s: %s\n", *arg, last_error());
+		free(path);
 		return -1;
 	}
 
 	if (clear) {
+		struct imgcache_entry *img;
+
 		stab_clear();
 		unmark_modified(MODIFY_SYMS);
+
+		img = imgcache_open(in);
+		ret = img ? imgcache_syms(img, in, path) : -1;
 	} else {
 		mark_modified(MODIFY_SYMS);
-	}
-
-	if (binfile_syms(in) < 0) {
-		fclose(in);
-		return -1;
+		ret = binfile_syms(in);
 	}
 
 	fclose(in);
+	free(path);
 
-	return 0;
+	return ret;
 }
 
 static int savemap_cb(void *user_data, const char *name, address_t value)
@@ -0,0 +1,106 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "cachefile.h"
+#include "opdb.h"
+#include "output.h"
+#include "util.h"
+
+char *cachefile_name(const char *option, const char *prefix,
+		     uint64_t hash, const char *ext)
+{
+	const char *opt = opdb_get_string(option);
+	char *dir;
+	char *name;
+	size_t len;
+
+	if (!*opt)
+		return NULL;
+
+	dir = expand_tilde(opt);
+	if (!dir)
+		return NULL;
+
+	/* Create the cache directory if necessary. Any other problem
+	 * will show up when we try to use it.
+	 */
+#ifdef __Windows__
+	mkdir(dir);
+#else
+	mkdir(dir, 0777);
+#endif
+
+	len = strlen(dir) + strlen(prefix) + strlen(ext) + 32;
+	name = malloc(len);
+	if (name)
+		snprintf(name, len, "%s/%s%016llx.%s", dir, prefix,
+			 (unsigned long long)hash, ext);
+
+	free(dir);
+	return name;
+}
+
+int cachefile_write(const char *filename,
+		    cachefile_write_func_t func, void *user_data)
+{
+	char *tmp_name;
+	size_t len;
+	FILE *out;
+
+	len = strlen(filename) + 8;
+	tmp_name = malloc(len);
+	if (!tmp_name)
+		return -1;
+
+	snprintf(tmp_name, len, "%s.tmp", filename);
+
+	out = fopen(tmp_name, "wb");
+	if (!out || func(user_data, out) < 0)
+		goto fail;
+
+	if (fclose(out) < 0) {
+		out = NULL;
+		goto fail;
+	}
+
+#ifdef __Windows__
+	unlink(filename);
+#endif
+	if (rename(tmp_name, filename) < 0) {
+		out = NULL;
+		goto fail;
+	}
+
+	free(tmp_name);
+	return 0;
+
+fail:
+	printc_dbg("cache: can't write %s: %s\n", tmp_name, last_error());
+	if (out)
+		fclose(out);
+	unlink(tmp_name);
+	free(tmp_name);
+	return -1;
+}
@@ -0,0 +1,49 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef CACHEFILE_H_
+#define CACHEFILE_H_
+
+#include <stdio.h>
+#include <stdint.h>
+
+/* Helpers for on-disk caches kept in a directory named by a string
+ * option (symcache_dir, devcache_dir).
+ */
+
+/* Return the name of a cache file, "<dir>/<prefix><hash>.<ext>", where
+ * the hash is printed in hex. The directory is created if necessary.
+ * Returns NULL if the option is empty (caching is disabled) or if
+ * memory is short. The result must be freed by the caller.
+ */
+char *cachefile_name(const char *option, const char *prefix,
+		     uint64_t hash, const char *ext);
+
+/* Replace a cache file atomically. The contents are written by the
+ * given function to a temporary file, which is then renamed over the
+ * original. The function returns 0 on success or -1 on error. Failure
+ * is reported only as a debug message: it just means that the slow
+ * path will be taken next time.
+ */
+typedef int (*cachefile_write_func_t)(void *user_data, FILE *out);
+
+int cachefile_write(const char *filename,
+		    cachefile_write_func_t func, void *user_data);
+
+#endif
@@ -18,9 +18,52 @@
 
 #include <stddef.h>
 #include <string.h>
+#include <ctype.h>
 #include "chipinfo.h"
+#include "util.h"
 #include "../chipinfo.db"
 
+/* The database is indexed on first use, so that chips can be
+ * identified and memory regions found without scanning it:
+ *
+ *   - chips are hashed on ver_id, and only the chips in the matching
+ *     bucket, plus the few whose ver_id is masked, are checked against
+ *     the full ID;
+ *   - names are held in a case-insensitive hash table;
+ *   - each chip's mapped memory regions are sorted by address.
+ *
+ * Where several entries match, the first in the database still wins.
+ */
+#define NUM_CHIPS		(ARRAY_LEN(chipinfo_db) - 1)
+#define NUM_REGIONS		CHIPINFO_MAX_MEMORY
+#define ID_HASH_SIZE		256
+#define NAME_HASH_SIZE		2048
+#define END_OF_CHAIN		0xffff
+
+typedef char name_hash_too_small[NAME_HASH_SIZE >= NUM_CHIPS * 2 ? 1 : -1];
+
+struct region_index {
+	unsigned int		count;
+
+	/* Mapped regions, sorted by offset */
+	uint8_t			order[NUM_REGIONS];
+
+	/* The highest end address of any region up to this point in
+	 * the sorted order.
+	 */
+	uint32_t		reach[NUM_REGIONS];
+};
+
+static int index_built;
+
+static uint16_t id_head[ID_HASH_SIZE];
+static uint16_t id_wild;
+static uint16_t id_next[NUM_CHIPS];
+
+static uint16_t name_hash[NAME_HASH_SIZE];
+
+static struct region_index regions[NUM_CHIPS];
+
 static int is_match(const struct chipinfo_id *a,
 		    const struct chipinfo_id *b,
 		    const struct chipinfo_id *mask)
@@ -43,24 +86,140 @@ static int is_match(const struct chipinfo_id *a,
 	return 1;
 }
 
+static unsigned int id_bucket(uint16_t ver_id)
+{
+	return (ver_id ^ (ver_id >> 8)) & (ID_HASH_SIZE - 1);
+}
+
+static unsigned int name_bucket(const char *name)
+{
+	uint32_t h = 2166136261u;
+
+	while (*name) {
+		h ^= tolower(*(name++));
+		h *= 16777619;
+	}
+
+	return h & (NAME_HASH_SIZE - 1);
+}
+
+static void index_regions(const struct chipinfo *info,
+			  struct region_index *r)
+{
+	uint32_t reach = 0;
+	unsigned int i;
+
+	r->count = 0;
+
+	for (i = 0; i < NUM_REGIONS && info->memory[i].name; i++) {
+		const struct chipinfo_memory *m = &info->memory[i];
+		unsigned int j;
+
+		if (!m->mapped)
+			continue;
+
+		/* Insertion sort, keeping regions at the same offset in
+		 * their original order.
+		 */
+		for (j = r->count++;
+		     j && info->memory[r->order[j - 1]].offset > m->offset; j--)
+			r->order[j] = r->order[j - 1];
+
+		r->order[j] = i;
+	}
+
+	for (i = 0; i < r->count; i++) {
+		const struct chipinfo_memory *m = &info->memory[r->order[i]];
+
+		if (m->offset + m->size > reach)
+			reach = m->offset + m->size;
+
+		r->reach[i] = reach;
+	}
+}
+
+static void build_index(void)
+{
+	int i;
+
+	memset(id_head, 0xff, sizeof(id_head));
+	id_wild = END_OF_CHAIN;
+
+	/* Build chains backwards, so that each is in database order */
+	for (i = NUM_CHIPS - 1; i >= 0; i--) {
+		const struct chipinfo *c = &chipinfo_db[i];
+
+		if (c->id_mask.ver_id == 0xffff) {
+			uint16_t *head = &id_head[id_bucket(c->id.ver_id)];
+
+			id_next[i] = *head;
+			*head = i;
+		} else {
+			id_next[i] = id_wild;
+			id_wild = i;
+		}
+	}
+
+	for (i = 0; i < NUM_CHIPS; i++) {
+		const char *name = chipinfo_db[i].name;
+		unsigned int b = name_bucket(name);
+
+		while (name_hash[b] &&
+		       strcasecmp(chipinfo_db[name_hash[b] - 1].name, name))
+			b = (b + 1) & (NAME_HASH_SIZE - 1);
+
+		if (!name_hash[b])
+			name_hash[b] = i + 1;
+
+		index_regions(&chipinfo_db[i], &regions[i]);
+	}
+
+	index_built = 1;
+}
+
+static unsigned int first_match(unsigned int i, const struct chipinfo_id *id)
+{
+	while (i != END_OF_CHAIN &&
+	       !is_match(&chipinfo_db[i].id, id, &chipinfo_db[i].id_mask))
+		i = id_next[i];
+
+	return i;
+}
+
 const struct chipinfo *chipinfo_find_by_id(const struct chipinfo_id *id)
 {
-	const struct chipinfo *i;
+	unsigned int a;
+	unsigned int b;
 
-	for (i = chipinfo_db; i->name; i++)
-		if (is_match(&i->id, id, &i->id_mask))
-			return i;
+	if (!index_built)
+		build_index();
 
-	return NULL;
+	a = first_match(id_head[id_bucket(id->ver_id)], id);
+	b = first_match(id_wild, id);
+
+	if (b < a)
+		a = b;
+
+	if (a == END_OF_CHAIN)
+		return NULL;
+
+	return &chipinfo_db[a];
 }
 
 const struct chipinfo *chipinfo_find_by_name(const char *name)
 {
-	const struct chipinfo *i;
+	unsigned int b;
+
+	if (!index_built)
+		build_index();
 
-	for (i = chipinfo_db; i->name; i++)
-		if (!strcasecmp(name, i->name))
-			return i;
+	for (b = name_bucket(name); name_hash[b];
+	     b = (b + 1) & (NAME_HASH_SIZE - 1)) {
+		const struct chipinfo *c = &chipinfo_db[name_hash[b] - 1];
+
+		if (!strcasecmp(name, c->name))
+			return c;
+	}
 
 	return NULL;
 }
@@ -77,24 +236,45 @@ const struct chipinfo_memory *chipinfo_find_mem_by_name
 	return NULL;
 }
 
+/* Find the region containing the given address or, failing that, the
+ * next region above it.
+ */
 const struct chipinfo_memory *chipinfo_find_mem_by_addr
 	(const struct chipinfo *info, uint32_t offset)
 {
-	const struct chipinfo_memory *m;
-	const struct chipinfo_memory *best = NULL;
+	const struct region_index *r;
+	struct region_index tmp;
+	unsigned int low = 0;
+	unsigned int high;
 
-	for (m = info->memory; m->name; m++) {
-		if (!m->mapped)
-			continue;
+	if (!index_built)
+		build_index();
 
-		if (m->offset + m->size <= offset)
-			continue;
+	/* Chips from outside the database aren't indexed */
+	if (info >= chipinfo_db && info < chipinfo_db + NUM_CHIPS) {
+		r = &regions[info - chipinfo_db];
+	} else {
+		index_regions(info, &tmp);
+		r = &tmp;
+	}
 
-		if (!best || (m->offset < best->offset))
-			best = m;
+	/* The first region in order which ends above the address is the
+	 * lowest such region.
+	 */
+	high = r->count;
+	while (low < high) {
+		const unsigned int mid = (low + high) >> 1;
+
+		if (r->reach[mid] > offset)
+			high = mid;
+		else
+			low = mid + 1;
 	}
 
-	return best;
+	if (low >= r->count)
+		return NULL;
+
+	return &info->memory[r->order[low]];
 }
 
 const char *chipinfo_copyright(void)
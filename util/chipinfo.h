@@ -25,7 +25,7 @@ struct chipinfo_funclet {
 	uint16_t	code_size;
 	uint16_t	max_payload;
 	uint16_t	entry_point;
-	uint16_t	code[512];
+	const uint16_t	*code;
 };
 
 typedef enum {
@@ -132,6 +132,15 @@ struct chipinfo_clockmap {
 	uint8_t			value;
 };
 
+/* Many chips share the same memory layout, clock map, function map and
+ * EEM, voltage and power parameters, so these are stored once in the
+ * database and referred to by pointer. The memory map holds at most
+ * CHIPINFO_MAX_MEMORY regions, followed by one with no name.
+ */
+#define CHIPINFO_MAX_MEMORY		15
+#define CHIPINFO_NUM_CLOCKS		32
+#define CHIPINFO_NUM_FUNCTIONS		128
+
 struct chipinfo {
 	const char			*name;
 
@@ -144,13 +153,13 @@ struct chipinfo {
 
 	struct chipinfo_id		id;
 	struct chipinfo_id		id_mask;
-	struct chipinfo_eem		eem;
-	struct chipinfo_voltage		voltage;
-	struct chipinfo_power		power;
-	struct chipinfo_memory		memory[16];
-	struct chipinfo_clockmap	clock_map[32];
+	const struct chipinfo_eem	*eem;
+	const struct chipinfo_voltage	*voltage;
+	const struct chipinfo_power	*power;
+	const struct chipinfo_memory	*memory;
+	const struct chipinfo_clockmap	*clock_map;
 
-	uint8_t				v3_functions[128];
+	const uint8_t			*v3_functions;
 	const struct chipinfo_funclet	*v3_erase;
 	const struct chipinfo_funclet	*v3_write;
 	const struct chipinfo_funclet	*v3_unlock;
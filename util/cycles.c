@@ -0,0 +1,312 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "cycles.h"
+#include "dis.h"
+#include "bytes.h"
+
+int cycles_op_width(uint16_t ins, uint16_t ext)
+{
+	uint16_t opcode = ins & 0xff80;
+
+	/* handle inconsistent SXTX and SWPBX encoding */
+	if (ext && (opcode == MSP430_OP_SWPB || opcode == MSP430_OP_SXT))
+		return (ins & 0x40) ? 0 : (ext & 0x40) ? 16 : 20;
+
+	else if (!ext || (ext & 0x0040))
+		return (ins & 0x0040) ? 8 : 16;
+
+	else
+		return (ins & 0x0040) ? 20 : 0;
+}
+
+int cycles_double(uint16_t ins, uint16_t ext, int opwidth, int rept,
+		  int cpux)
+{
+	uint16_t opcode = ins & 0xf000;
+	int sreg = (ins >> 8) & 0xf;
+	int amode_dst = (ins >> 7) & 1;
+	int amode_src = (ins >> 4) & 0x3;
+	int dreg = ins & 0x000f;
+	int cycles;
+
+	if (!cpux) { /* original CPU timing */
+
+		if (amode_dst == MSP430_AMODE_REGISTER && dreg == MSP430_REG_PC) {
+			if (amode_src == MSP430_AMODE_REGISTER ||
+			    amode_src == MSP430_AMODE_INDIRECT)
+				cycles = 2;
+			else
+				cycles = 3;
+		} else if (sreg == MSP430_REG_SR || sreg == MSP430_REG_R3) {
+			if (amode_dst == MSP430_AMODE_REGISTER)
+				cycles = 1;
+			else
+				cycles = 4;
+		} else {
+			if (amode_src == MSP430_AMODE_INDIRECT ||
+			    amode_src == MSP430_AMODE_INDIRECT_INC)
+				cycles = 2;
+			else if (amode_src == MSP430_AMODE_INDEXED)
+				cycles = 3;
+			else
+				cycles = 1;
+
+			if (amode_dst == MSP430_AMODE_INDEXED)
+				cycles += 3;
+		}
+
+	} else { /* CPUX timing */
+		cycles = 1;					/* read opcode */
+		if (ext) cycles += 1;		/* read ext wd */
+
+		if (amode_src == MSP430_AMODE_INDEXED)
+			cycles += 1;			/* read offset */
+
+		if (amode_src != MSP430_AMODE_REGISTER) {
+			cycles += 1;			/* read src value */
+			if (opwidth > 16 && (sreg != MSP430_REG_PC || amode_src != MSP430_AMODE_INDIRECT_INC))
+				cycles += 1;		/* read src value high bits */
+		}
+		if (amode_dst == MSP430_AMODE_INDEXED) {
+			cycles += 1;			/* read offset; */
+			if (opcode != MSP430_OP_MOV) {
+				cycles += 1;		/* read dst value */
+				if (opwidth > 16)
+					cycles += 1;	/* read dst value high bits */
+			}
+			if (opcode != MSP430_OP_BIT && opcode != MSP430_OP_CMP) {
+				cycles += 1;		/* write dst value */
+				if (opwidth > 16)
+					cycles += 1;	/* write dst value high bits */
+			}
+		} else if (dreg == MSP430_REG_PC) {
+			if (opcode != MSP430_OP_MOV
+					&& opcode != MSP430_OP_ADD
+					&& opcode != MSP430_OP_SUB)
+				cycles += 1;	/* pipelining hit */
+			if (amode_src != MSP430_AMODE_INDIRECT_INC || sreg != MSP430_REG_PC)
+				cycles += 1;	/* pipelining hit */
+		}
+		cycles += rept - 1;
+	}
+
+	return cycles;
+}
+
+int cycles_single(uint16_t ins, uint16_t ext, int opwidth, int rept,
+		  int cpux)
+{
+	uint16_t opcode = ins & 0xff80;
+	int amode = (ins >> 4) & 0x3;
+	int reg = ins & 0x000f;
+	int cycles = 1;
+
+	if (!cpux) { /* original CPU timing */
+
+		switch (opcode) {
+		case MSP430_OP_PUSH:
+			if (amode == MSP430_AMODE_REGISTER)
+				cycles = 3;
+			else if (amode == MSP430_AMODE_INDIRECT ||
+				 (amode == MSP430_AMODE_INDIRECT_INC &&
+				  reg == MSP430_REG_PC))
+				cycles = 4;
+			else
+				cycles = 5;
+			break;
+		case MSP430_OP_CALL:
+			if (amode == MSP430_AMODE_REGISTER ||
+				amode == MSP430_AMODE_INDIRECT)
+				cycles = 4;
+			else
+				cycles = 5;
+			break;
+		case MSP430_OP_RETI:
+			cycles = 5;
+			break;
+		default:
+			if (amode == MSP430_AMODE_INDEXED)
+				cycles = 4;
+			else if (amode == MSP430_AMODE_REGISTER)
+				cycles = 1;
+			else
+				cycles = 3;
+			break;
+		}
+
+	} else { /* CPUX timing */
+		cycles = 1;					/* read opcode */
+		if (ext) cycles += 1;		/* read ext wd */
+
+		if (amode == MSP430_AMODE_INDEXED)
+			cycles += 1;			/* read offset */
+
+		switch (opcode) {			/* special-case opcodes */
+
+		case MSP430_OP_CALL:
+			if (amode == MSP430_AMODE_INDEXED && reg == MSP430_REG_SR)
+				cycles += 1;		/* extra cycle for call &xxx */
+			/* fall through */
+
+		case MSP430_OP_PUSH:
+			if (amode == MSP430_AMODE_REGISTER)
+				cycles += 1;		/* sp decr pipeline hit */
+			else {
+				cycles += 1;		/* read data */
+				if (opwidth > 16 &&
+						!(amode == MSP430_AMODE_INDIRECT_INC &&
+						reg == MSP430_REG_PC))
+					cycles += 1;	/* read high wd, except if immediate */
+			}
+			cycles += 1;		/* write to stack */
+			if (opwidth > 16 || opcode == MSP430_OP_CALL)
+				cycles += 1;	/* write high bits to dest or stack */
+
+			/* to match observed MSP430FR5739 behavior requires the following
+					additional fudge */
+			if (opwidth == 20 && amode == MSP430_AMODE_INDEXED)
+				cycles += 1;	/* reason unknown */
+
+			if (opwidth > 16)
+				cycles += rept - 1;
+
+			break;
+
+		default:
+			if (amode != MSP430_AMODE_REGISTER) {
+				cycles += 2;			/* read/write data */
+				if (opwidth > 16)
+					cycles += 2;		/* extra read/write cycles */
+			}
+			break;
+		}
+		cycles += rept - 1;
+	}
+
+	return cycles;
+}
+
+/************************************************************************
+ * Whole instructions
+ */
+
+/* MOVA, CMPA, ADDA and SUBA, indexed by bits 7:4 of the instruction.
+ * The second count applies when the destination is PC. A count of 0
+ * marks an invalid encoding.
+ */
+static const uint8_t addr_insn_cycles[16][2] = {
+	{3, 5}, {3, 5}, {4, 6}, {4, 6}, {0, 0}, {0, 0}, {4, 4}, {4, 4},
+	{2, 3}, {2, 3}, {2, 3}, {2, 3}, {1, 3}, {1, 3}, {1, 3}, {1, 3}
+};
+
+static int cycles_ext(uint16_t ins, uint16_t ext)
+{
+	const int opwidth = cycles_op_width(ins, ext);
+	int rept = 1;
+	int reg_only;
+
+	if (!opwidth)
+		return -1;
+
+	if ((ins & 0xf000) >= 0x4000)
+		reg_only = !(ins & 0x00b0);
+	else if ((ins & 0xf000) == 0x1000 && (ins & 0xfc00) < 0x1280)
+		reg_only = !(ins & 0x0030);
+	else
+		return -1;
+
+	/* A repeat count held in a register is assumed to be the
+	 * largest possible.
+	 */
+	if (reg_only)
+		rept = (ext & 0x0080) ? 16 : (ext & 0xf) + 1;
+
+	if ((ins & 0xf000) >= 0x4000)
+		return cycles_double(ins, ext, opwidth, rept, 1);
+
+	return cycles_single(ins, ext, opwidth, rept, 1);
+}
+
+static int cycles_calla(uint16_t ins)
+{
+	const int amode = (ins & 0x30) >> 4;
+	int cycles;
+
+	switch ((ins & 0x00c0) >> 6) {
+	case 0:		/* RETI */
+		return ins == MSP430_OP_RETI ? 5 : -1;
+
+	case 1:		/* CALLA Rd, x(Rd), @Rd, @Rd+ */
+		cycles = (amode & 2) ? 6 : 5;
+		if (amode == 1 && (ins & 0xf) == MSP430_REG_SP)
+			cycles++;
+		return cycles;
+
+	case 2:		/* CALLA &abs20, rel20, #imm20 */
+		if (amode == 2)
+			return -1;
+		return ((amode | 1) & 2) ? 5 : 7;
+	}
+
+	return -1;
+}
+
+int cycles_insn(const uint8_t *code, address_t len, int cpux)
+{
+	uint16_t ins;
+
+	if (len < 2)
+		return -1;
+
+	ins = r16le(code);
+
+	if (cpux && (ins & 0xf800) == 0x1800)
+		return len < 4 ? -1 : cycles_ext(r16le(code + 2), ins);
+
+	if (cpux && (ins & 0xf0e0) == 0x0040)
+		return ((ins >> 10) & 0x3) + 1;		/* RxxM */
+
+	if (cpux && (ins & 0xf000) == 0x0000) {
+		const uint8_t *c = addr_insn_cycles[(ins >> 4) & 0xf];
+		const int dst_pc = ((ins >> 4) & 0xf) != 6 &&
+			((ins >> 4) & 0xf) != 7 && !(ins & 0xf);
+
+		return c[0] ? c[dst_pc] : -1;
+	}
+
+	if (cpux && (ins & 0xfc00) == 0x1400) {		/* PUSHM, POPM */
+		const int rept = ((ins >> 4) & 0xf) + 1;
+
+		return 2 + ((ins & 0x0100) ? 2 : 1) * rept;
+	}
+
+	if (cpux && (ins & 0xff00) == 0x1300)
+		return cycles_calla(ins);
+
+	if ((ins & 0xf000) == 0x1000)
+		return cycles_single(ins, 0, cycles_op_width(ins, 0), 1, cpux);
+
+	if ((ins & 0xe000) == 0x2000)
+		return 2;
+
+	if ((ins & 0xf000) >= 0x4000)
+		return cycles_double(ins, 0, cycles_op_width(ins, 0), 1, cpux);
+
+	return -1;
+}
@@ -0,0 +1,56 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CYCLES_H_
+#define CYCLES_H_
+
+#include <stdint.h>
+#include "util.h"
+
+/* Instruction timing for the original MSP430 CPU and the MSP430X CPU
+ * (CPUX). These are the tables used by the simulator, and by static
+ * analysis of execution time.
+ */
+
+/* Cycles taken to accept an interrupt, before the first instruction of
+ * the handler.
+ */
+#define CYCLES_IRQ_ENTRY	6
+
+/* Operand width in bits (8, 16 or 20) of a single or double-operand
+ * instruction, given its extension word (or 0 if there is none).
+ * Returns 0 if the width encoding is invalid.
+ */
+int cycles_op_width(uint16_t ins, uint16_t ext);
+
+/* Cycles taken by a double or single-operand instruction, given its
+ * extension word (if any), operand width and repeat count.
+ */
+int cycles_double(uint16_t ins, uint16_t ext, int opwidth, int rept,
+		  int cpux);
+int cycles_single(uint16_t ins, uint16_t ext, int opwidth, int rept,
+		  int cpux);
+
+/* Find the worst-case number of cycles taken by the instruction at the
+ * start of the given code. Repeat counts held in registers are assumed
+ * to be at their maximum. Returns -1 if the instruction is invalid or
+ * incomplete.
+ */
+int cycles_insn(const uint8_t *code, address_t len, int cpux);
+
+#endif
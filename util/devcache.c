@@ -0,0 +1,126 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "devcache.h"
+#include "cachefile.h"
+#include "util.h"
+
+/* Each entry is a file named after the entry kind and a hash of its
+ * key. It consists of a header, the key, and then the data.
+ */
+static const char cache_magic[8] = "MSPDEVC1";
+
+struct cache_header {
+	char		magic[8];
+	uint32_t	key_len;
+	uint32_t	data_len;
+};
+
+static char *cache_file_name(const char *kind, const void *key, int key_len)
+{
+	char prefix[32];
+
+	snprintf(prefix, sizeof(prefix), "%s-", kind);
+	return cachefile_name("devcache_dir", prefix,
+			      fnv64(FNV64_INIT, key, key_len), "dev");
+}
+
+int devcache_load(const char *kind, const void *key, int key_len,
+		  void *data, int len)
+{
+	char *filename = cache_file_name(kind, key, key_len);
+	struct cache_header hdr;
+	uint8_t *stored = NULL;
+	FILE *in;
+	int ret = 1;
+
+	if (!filename)
+		return 1;
+
+	in = fopen(filename, "rb");
+	free(filename);
+	if (!in)
+		return 1;
+
+	if (fread(&hdr, sizeof(hdr), 1, in) != 1 ||
+	    memcmp(hdr.magic, cache_magic, sizeof(cache_magic)) ||
+	    hdr.key_len != key_len || hdr.data_len != len)
+		goto out;
+
+	stored = malloc(key_len + len);
+	if (!stored ||
+	    fread(stored, 1, key_len + len, in) != key_len + len ||
+	    memcmp(stored, key, key_len))
+		goto out;
+
+	memcpy(data, stored + key_len, len);
+	ret = 0;
+
+out:
+	free(stored);
+	fclose(in);
+	return ret;
+}
+
+struct entry {
+	const void	*key;
+	int		key_len;
+	const void	*data;
+	int		len;
+};
+
+static int write_entry(void *user_data, FILE *out)
+{
+	const struct entry *e = (const struct entry *)user_data;
+	struct cache_header hdr;
+
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, cache_magic, sizeof(cache_magic));
+	hdr.key_len = e->key_len;
+	hdr.data_len = e->len;
+
+	if (fwrite(&hdr, sizeof(hdr), 1, out) != 1 ||
+	    fwrite(e->key, 1, e->key_len, out) != e->key_len ||
+	    fwrite(e->data, 1, e->len, out) != e->len)
+		return -1;
+
+	return 0;
+}
+
+void devcache_store(const char *kind, const void *key, int key_len,
+		    const void *data, int len)
+{
+	char *filename = cache_file_name(kind, key, key_len);
+	struct entry e;
+
+	if (!filename)
+		return;
+
+	e.key = key;
+	e.key_len = key_len;
+	e.data = data;
+	e.len = len;
+
+	cachefile_write(filename, write_entry, &e);
+	free(filename);
+}
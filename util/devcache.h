@@ -0,0 +1,47 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef DEVCACHE_H_
+#define DEVCACHE_H_
+
+/* Persistent cache of device information which is slow to obtain, such
+ * as identification results and clock calibration constants. Entries
+ * are kept in the directory named by the "devcache_dir" option, and
+ * are looked up by a driver-defined key, which should include
+ * everything the data depends on (adapter serial and firmware, target
+ * ID bytes, and so on). The key is stored in full and compared on load,
+ * so hash collisions can't produce a false hit.
+ *
+ * The data is opaque, and written in host byte order. It's only valid
+ * on the host which wrote it.
+ */
+
+/* Returns 0 if an entry of exactly len bytes was found, or 1 if not
+ * (including if the cache is disabled).
+ */
+int devcache_load(const char *kind, const void *key, int key_len,
+		  void *data, int len);
+
+/* Store an entry, replacing any existing one. Failure isn't fatal: it
+ * only means that the slow path will be taken next time.
+ */
+void devcache_store(const char *kind, const void *key, int key_len,
+		    const void *data, int len);
+
+#endif
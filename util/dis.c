@@ -30,141 +30,527 @@
 
 /**********************************************************************/
 /* Disassembler
+ *
+ * Decoding is driven by tables: the top byte of the first word selects
+ * an instruction format, operand encodings (including the constant
+ * generator encodings) are looked up by mode and register, and emulated
+ * instructions are recognised by matching a short list of patterns for
+ * each real instruction.
+ */
+
+typedef enum {
+	FMT_INVALID = 0,
+	FMT_00XX,
+	FMT_SINGLE,
+	FMT_13XX,
+	FMT_14XX,
+	FMT_EXT,
+	FMT_JUMP,
+	FMT_DOUBLE
+} insn_format_t;
+
+#define FMT_ROW(f)	f, f, f, f, f, f, f, f, f, f, f, f, f, f, f, f
+
+/* Indexed by the top byte of an instruction word */
+static const uint8_t formats[256] = {
+	FMT_ROW(FMT_00XX),
+	FMT_SINGLE, FMT_SINGLE, FMT_SINGLE, FMT_13XX,
+	FMT_14XX, FMT_14XX, FMT_14XX, FMT_14XX,
+	FMT_EXT, FMT_EXT, FMT_EXT, FMT_EXT,
+	FMT_EXT, FMT_EXT, FMT_EXT, FMT_EXT,
+	FMT_ROW(FMT_JUMP), FMT_ROW(FMT_JUMP),
+	FMT_ROW(FMT_DOUBLE), FMT_ROW(FMT_DOUBLE),
+	FMT_ROW(FMT_DOUBLE), FMT_ROW(FMT_DOUBLE),
+	FMT_ROW(FMT_DOUBLE), FMT_ROW(FMT_DOUBLE),
+	FMT_ROW(FMT_DOUBLE), FMT_ROW(FMT_DOUBLE),
+	FMT_ROW(FMT_DOUBLE), FMT_ROW(FMT_DOUBLE),
+	FMT_ROW(FMT_DOUBLE), FMT_ROW(FMT_DOUBLE)
+};
+
+/* Operand encodings, indexed by the addressing mode bits and the
+ * register number. Each gives the addressing mode as it's presented,
+ * and whether an extension word follows. If there's no extension word,
+ * the value is the operand's address (or immediate value, for constant
+ * generator encodings). Otherwise, the extension word is added to it,
+ * or to the address of the extension word if it's PC-relative.
+ *
+ * Operands which can form part of an emulated instruction (immediate
+ * values, @SP+ and the PC as a destination) are flagged, so that most
+ * instructions can skip the search for emulated instructions.
  */
+#define OPERAND_WORD		0x01
+#define OPERAND_PCREL		0x02
+#define OPERAND_EMUL		0x04
+
+struct operand_enc {
+	msp430_amode_t		mode;
+	int			flags;
+	address_t		value;
+};
+
+#define OPR_PLAIN(m)		{MSP430_AMODE_##m, 0, 0}
+#define OPR_WORD(m)		{MSP430_AMODE_##m, OPERAND_WORD, 0}
+#define OPR_PCREL		{MSP430_AMODE_SYMBOLIC, \
+				 OPERAND_WORD | OPERAND_PCREL, 0}
+#define OPR_CONST(v)		{MSP430_AMODE_IMMEDIATE, OPERAND_EMUL, v}
+#define OPR_IMM			{MSP430_AMODE_IMMEDIATE, \
+				 OPERAND_WORD | OPERAND_EMUL, 0}
+#define OPR_EMUL(m)		{MSP430_AMODE_##m, OPERAND_EMUL, 0}
+#define OPR_R4_R15(e)		e, e, e, e, e, e, e, e, e, e, e, e
+
+/* Source operands of double-operand instructions (As, Rsrc), and
+ * operands of single-operand instructions (As, Rdst).
+ */
+static const struct operand_enc src_operands[64] = {
+	/* Rn */
+	OPR_PLAIN(REGISTER), OPR_PLAIN(REGISTER),
+	OPR_PLAIN(REGISTER), OPR_CONST(0),
+	OPR_R4_R15(OPR_PLAIN(REGISTER)),
+
+	/* X(Rn) */
+	OPR_PCREL, OPR_WORD(INDEXED),
+	OPR_WORD(ABSOLUTE), OPR_CONST(1),
+	OPR_R4_R15(OPR_WORD(INDEXED)),
+
+	/* @Rn */
+	OPR_PLAIN(INDIRECT), OPR_PLAIN(INDIRECT),
+	OPR_CONST(4), OPR_CONST(2),
+	OPR_R4_R15(OPR_PLAIN(INDIRECT)),
+
+	/* @Rn+ */
+	OPR_IMM, OPR_EMUL(INDIRECT_INC),
+	OPR_CONST(8), OPR_CONST(ALL_ONES),
+	OPR_R4_R15(OPR_PLAIN(INDIRECT_INC))
+};
+
+/* Destination operands of double-operand instructions (Ad, Rdst) */
+static const struct operand_enc dst_operands[32] = {
+	/* Rn */
+	OPR_EMUL(REGISTER), OPR_PLAIN(REGISTER),
+	OPR_PLAIN(REGISTER), OPR_PLAIN(REGISTER),
+	OPR_R4_R15(OPR_PLAIN(REGISTER)),
+
+	/* X(Rn) */
+	OPR_PCREL, OPR_WORD(INDEXED),
+	OPR_WORD(ABSOLUTE), OPR_WORD(INDEXED),
+	OPR_R4_R15(OPR_WORD(INDEXED))
+};
 
-static address_t add_index(address_t reg_base, address_t index,
-			   int is_20bit)
+static inline int src_index(uint16_t op, int reg)
 {
-	return (reg_base + index) & (is_20bit ? 0xfffff : 0xffff);
+	return ((op >> 4) & 0x3) << 4 | reg;
 }
 
-static int decode_00xx(const uint8_t *code, address_t len,
-		       struct msp430_instruction *insn)
+/* Data sizes, indexed by whether the instruction is SWPB or SXT (which
+ * have non-standard encodings), the A/L bit of the extension word (set
+ * if there is no extension word) and the B/W bit.
+ */
+static const msp430_dsize_t dsizes[2][2][2] = {
+	{
+		{MSP430_DSIZE_UNKNOWN, MSP430_DSIZE_AWORD},
+		{MSP430_DSIZE_WORD, MSP430_DSIZE_BYTE}
+	},
+	{
+		{MSP430_DSIZE_AWORD, MSP430_DSIZE_UNKNOWN},
+		{MSP430_DSIZE_WORD, MSP430_DSIZE_UNKNOWN}
+	}
+};
+
+static inline msp430_dsize_t decode_dsize(uint16_t op, uint16_t ex_word,
+					  int is_swpb_sxt)
 {
-	uint16_t op = code[0] | (code[1] << 8);
-	int subtype = (op >> 4) & 0xf;
-	int have_arg = 0;
-	address_t arg = 0;
+	return dsizes[is_swpb_sxt][!ex_word || (ex_word & 0x0040)]
+		[(op >> 6) & 1];
+}
 
-	/* Parameters common to most cases */
-	insn->op = MSP430_OP_MOVA;
-	insn->itype = MSP430_ITYPE_DOUBLE;
-	insn->dsize = MSP430_DSIZE_AWORD;
-	insn->dst_mode = MSP430_AMODE_REGISTER;
-	insn->dst_reg = op & 0xf;
-	insn->src_mode = MSP430_AMODE_REGISTER;
-	insn->src_reg = (op >> 8) & 0xf;
+/* Emulated instructions. Each real instruction has a list of patterns,
+ * which are tried in order. The first match gives the emulated
+ * instruction.
+ */
+typedef enum {
+	/* Source is the immediate value given */
+	EMUL_IMM,
+
+	/* Source and destination are the same operand */
+	EMUL_SAME,
+
+	/* Source is the immediate value given, destination is SR */
+	EMUL_SR_IMM,
+
+	/* Source is @SP+, destination is PC */
+	EMUL_RET,
+
+	/* Source is @SP+ */
+	EMUL_POP,
+
+	/* Destination is PC. The source becomes the only operand. */
+	EMUL_BR,
+
+	/* Source is #0, destination is R3 */
+	EMUL_NOP
+} emul_cond_t;
+
+struct emul_rule {
+	emul_cond_t		cond;
+	address_t		value;
+	msp430_op_t		op;
+	msp430_itype_t		itype;
+};
+
+struct emul_list {
+	const struct emul_rule	*rules;
+	int			count;
+};
+
+#define EMUL_SINGLE(c, v, op) \
+	{EMUL_##c, v, MSP430_OP_##op, MSP430_ITYPE_SINGLE}
+#define EMUL_NOARG(c, v, op) \
+	{EMUL_##c, v, MSP430_OP_##op, MSP430_ITYPE_NOARG}
+
+static const struct emul_rule emul_add[] = {
+	EMUL_SINGLE(IMM, 1, INC),
+	EMUL_SINGLE(IMM, 2, INCD),
+	EMUL_SINGLE(SAME, 0, RLA)
+};
+
+static const struct emul_rule emul_addx[] = {
+	EMUL_SINGLE(IMM, 1, INCX),
+	EMUL_SINGLE(IMM, 2, INCDX),
+	EMUL_SINGLE(SAME, 0, RLAX)
+};
+
+static const struct emul_rule emul_adda[] = {
+	EMUL_SINGLE(IMM, 2, INCDA)
+};
 
-	if (len >= 4) {
-		have_arg = 1;
-		arg = code[2] | (code[3] << 8);
+static const struct emul_rule emul_addc[] = {
+	EMUL_SINGLE(IMM, 0, ADC),
+	EMUL_SINGLE(SAME, 0, RLC)
+};
+
+static const struct emul_rule emul_addcx[] = {
+	EMUL_SINGLE(IMM, 0, ADCX),
+	EMUL_SINGLE(SAME, 0, RLCX)
+};
+
+static const struct emul_rule emul_bic[] = {
+	EMUL_NOARG(SR_IMM, 1, CLRC),
+	EMUL_NOARG(SR_IMM, 4, CLRN),
+	EMUL_NOARG(SR_IMM, 2, CLRZ),
+	EMUL_NOARG(SR_IMM, 8, DINT)
+};
+
+static const struct emul_rule emul_bis[] = {
+	EMUL_NOARG(SR_IMM, 1, SETC),
+	EMUL_NOARG(SR_IMM, 4, SETN),
+	EMUL_NOARG(SR_IMM, 2, SETZ),
+	EMUL_NOARG(SR_IMM, 8, EINT)
+};
+
+static const struct emul_rule emul_cmp[] = {
+	EMUL_SINGLE(IMM, 0, TST)
+};
+
+static const struct emul_rule emul_cmpa[] = {
+	EMUL_SINGLE(IMM, 0, TSTA)
+};
+
+static const struct emul_rule emul_cmpx[] = {
+	EMUL_SINGLE(IMM, 0, TSTX)
+};
+
+static const struct emul_rule emul_dadd[] = {
+	EMUL_SINGLE(IMM, 0, DADC)
+};
+
+static const struct emul_rule emul_daddx[] = {
+	EMUL_SINGLE(IMM, 0, DADCX)
+};
+
+static const struct emul_rule emul_mov[] = {
+	EMUL_NOARG(RET, 0, RET),
+	EMUL_SINGLE(POP, 0, POP),
+	EMUL_SINGLE(BR, 0, BR),
+	EMUL_NOARG(NOP, 0, NOP),
+	EMUL_SINGLE(IMM, 0, CLR)
+};
+
+static const struct emul_rule emul_mova[] = {
+	EMUL_NOARG(RET, 0, RETA),
+	EMUL_SINGLE(POP, 0, POPX),
+	EMUL_SINGLE(BR, 0, BRA),
+	EMUL_NOARG(NOP, 0, NOP),
+	EMUL_SINGLE(IMM, 0, CLRX)
+};
+
+static const struct emul_rule emul_sub[] = {
+	EMUL_SINGLE(IMM, 1, DEC),
+	EMUL_SINGLE(IMM, 2, DECD)
+};
+
+static const struct emul_rule emul_suba[] = {
+	EMUL_SINGLE(IMM, 2, DECDA)
+};
+
+static const struct emul_rule emul_subx[] = {
+	EMUL_SINGLE(IMM, 1, DECX),
+	EMUL_SINGLE(IMM, 2, DECDX)
+};
+
+static const struct emul_rule emul_subc[] = {
+	EMUL_SINGLE(IMM, 0, SBC)
+};
+
+static const struct emul_rule emul_subcx[] = {
+	EMUL_SINGLE(IMM, 0, SECX)
+};
+
+static const struct emul_rule emul_xor[] = {
+	EMUL_SINGLE(IMM, ALL_ONES, INV)
+};
+
+static const struct emul_rule emul_xorx[] = {
+	EMUL_SINGLE(IMM, ALL_ONES, INVX)
+};
+
+#define EMUL_LIST(r)		{r, ARRAY_LEN(r)}
+
+/* Double-operand instructions, indexed by the top four bits of the
+ * opcode, and then by whether there's an extension word.
+ */
+static const struct emul_list emul_double[2][16] = {
+	{
+		[0x4] = EMUL_LIST(emul_mov),
+		[0x5] = EMUL_LIST(emul_add),
+		[0x6] = EMUL_LIST(emul_addc),
+		[0x7] = EMUL_LIST(emul_subc),
+		[0x8] = EMUL_LIST(emul_sub),
+		[0x9] = EMUL_LIST(emul_cmp),
+		[0xa] = EMUL_LIST(emul_dadd),
+		[0xc] = EMUL_LIST(emul_bic),
+		[0xd] = EMUL_LIST(emul_bis),
+		[0xe] = EMUL_LIST(emul_xor)
+	},
+	{
+		[0x5] = EMUL_LIST(emul_addx),
+		[0x6] = EMUL_LIST(emul_addcx),
+		[0x7] = EMUL_LIST(emul_subcx),
+		[0x8] = EMUL_LIST(emul_subx),
+		[0x9] = EMUL_LIST(emul_cmpx),
+		[0xa] = EMUL_LIST(emul_daddx),
+		[0xe] = EMUL_LIST(emul_xorx)
 	}
+};
 
-	switch (subtype) {
-	case 0:
-		insn->src_mode = MSP430_AMODE_INDIRECT;
-		return 2;
+static int emul_match(const struct msp430_instruction *insn,
+		      const struct emul_rule *r)
+{
+	switch (r->cond) {
+	case EMUL_IMM:
+		return insn->src_mode == MSP430_AMODE_IMMEDIATE &&
+			insn->src_addr == r->value;
+
+	case EMUL_SAME:
+		return insn->dst_mode == insn->src_mode &&
+			insn->dst_reg == insn->src_reg &&
+			insn->dst_addr == insn->src_addr;
+
+	case EMUL_SR_IMM:
+		return insn->dst_mode == MSP430_AMODE_REGISTER &&
+			insn->dst_reg == MSP430_REG_SR &&
+			insn->src_mode == MSP430_AMODE_IMMEDIATE &&
+			insn->src_addr == r->value;
+
+	case EMUL_RET:
+		return insn->src_mode == MSP430_AMODE_INDIRECT_INC &&
+			insn->src_reg == MSP430_REG_SP &&
+			insn->dst_mode == MSP430_AMODE_REGISTER &&
+			insn->dst_reg == MSP430_REG_PC;
+
+	case EMUL_POP:
+		return insn->src_mode == MSP430_AMODE_INDIRECT_INC &&
+			insn->src_reg == MSP430_REG_SP;
+
+	case EMUL_BR:
+		return insn->dst_mode == MSP430_AMODE_REGISTER &&
+			insn->dst_reg == MSP430_REG_PC;
+
+	case EMUL_NOP:
+		return insn->src_mode == MSP430_AMODE_IMMEDIATE &&
+			!insn->src_addr &&
+			insn->dst_mode == MSP430_AMODE_REGISTER &&
+			insn->dst_reg == MSP430_REG_R3;
+	}
 
-	case 1:
-		insn->src_mode = MSP430_AMODE_INDIRECT_INC;
-		return 2;
+	return 0;
+}
 
-	case 2:
-		if (!have_arg)
-			return -1;
-		insn->src_mode = MSP430_AMODE_ABSOLUTE;
-		insn->src_addr = ((op & 0xf00) << 8) | arg;
-		return 4;
+static void find_emulated_ops(struct msp430_instruction *insn,
+			      const struct emul_list *list)
+{
+	int i;
 
-	case 3:
-		if (!have_arg)
-			return -1;
-		insn->src_mode = MSP430_AMODE_INDEXED;
-		insn->src_addr = arg;
-		return 4;
+	for (i = 0; i < list->count; i++) {
+		const struct emul_rule *r = &list->rules[i];
 
-	case 4:
-	case 5:
+		if (!emul_match(insn, r))
+			continue;
+
+		insn->op = r->op;
+		insn->itype = r->itype;
+
+		if (r->cond == EMUL_BR) {
+			insn->dst_mode = insn->src_mode;
+			insn->dst_reg = insn->src_reg;
+			insn->dst_addr = insn->src_addr;
+		}
+
+		return;
+	}
+}
+
+/* The constant generator registers are handled by the operand tables
+ * for regular instructions. The address instructions encode their
+ * operands differently, but are presented in the same way.
+ */
+static void remap_cgen(msp430_amode_t *mode,
+		       address_t *addr,
+		       msp430_reg_t *reg)
+{
+	if (*reg == MSP430_REG_SR) {
+		if (*mode == MSP430_AMODE_INDIRECT) {
+			*mode = MSP430_AMODE_IMMEDIATE;
+			*addr = 4;
+		} else if (*mode == MSP430_AMODE_INDIRECT_INC) {
+			*mode = MSP430_AMODE_IMMEDIATE;
+			*addr = 8;
+		}
+	} else if (*reg == MSP430_REG_R3) {
+		if (*mode == MSP430_AMODE_REGISTER)
+			*addr = 0;
+		else if (*mode == MSP430_AMODE_INDEXED)
+			*addr = 1;
+		else if (*mode == MSP430_AMODE_INDIRECT)
+			*addr = 2;
+		else if (*mode == MSP430_AMODE_INDIRECT_INC)
+			*addr = ALL_ONES;
+
+		*mode = MSP430_AMODE_IMMEDIATE;
+	}
+}
+
+static inline uint16_t get_word(const uint8_t *code)
+{
+	return code[0] | (code[1] << 8);
+}
+
+/* Group 00xx: address instructions, indexed by bits 4-7 */
+typedef enum {
+	ADDR_NONE,
+	ADDR_SRC_20,
+	ADDR_SRC_16,
+	ADDR_DST_20,
+	ADDR_DST_16,
+	ADDR_ROTATE
+} addr_form_t;
+
+struct addr_insn {
+	msp430_op_t		op;
+	msp430_amode_t		src_mode;
+	msp430_amode_t		dst_mode;
+	addr_form_t		form;
+	struct emul_list	emul;
+};
+
+#define ADDR_INSN(op, src, dst, form, emul) \
+	{MSP430_OP_##op, MSP430_AMODE_##src, MSP430_AMODE_##dst, \
+	 ADDR_##form, EMUL_LIST(emul)}
+#define ADDR_ROTATE_INSN \
+	{MSP430_OP_MOVA, MSP430_AMODE_IMMEDIATE, MSP430_AMODE_REGISTER, \
+	 ADDR_ROTATE, {NULL, 0}}
+
+static const struct addr_insn addr_insns[16] = {
+	ADDR_INSN(MOVA, INDIRECT,	REGISTER,	NONE,	emul_mova),
+	ADDR_INSN(MOVA, INDIRECT_INC,	REGISTER,	NONE,	emul_mova),
+	ADDR_INSN(MOVA, ABSOLUTE,	REGISTER,	SRC_20,	emul_mova),
+	ADDR_INSN(MOVA, INDEXED,	REGISTER,	SRC_16,	emul_mova),
+	ADDR_ROTATE_INSN,
+	ADDR_ROTATE_INSN,
+	ADDR_INSN(MOVA, REGISTER,	ABSOLUTE,	DST_20,	emul_mova),
+	ADDR_INSN(MOVA, REGISTER,	INDEXED,	DST_16,	emul_mova),
+	ADDR_INSN(MOVA, IMMEDIATE,	REGISTER,	SRC_20,	emul_mova),
+	ADDR_INSN(CMPA, IMMEDIATE,	REGISTER,	SRC_20,	emul_cmpa),
+	ADDR_INSN(ADDA, IMMEDIATE,	REGISTER,	SRC_20,	emul_adda),
+	ADDR_INSN(SUBA, IMMEDIATE,	REGISTER,	SRC_20,	emul_suba),
+	ADDR_INSN(MOVA, REGISTER,	REGISTER,	NONE,	emul_mova),
+	ADDR_INSN(CMPA, REGISTER,	REGISTER,	NONE,	emul_cmpa),
+	ADDR_INSN(ADDA, REGISTER,	REGISTER,	NONE,	emul_adda),
+	ADDR_INSN(SUBA, REGISTER,	REGISTER,	NONE,	emul_suba)
+};
+
+static int decode_00xx(const uint8_t *code, address_t len,
+		       struct msp430_instruction *insn,
+		       const struct emul_list **emul)
+{
+	const uint16_t op = get_word(code);
+	const struct addr_insn *a = &addr_insns[(op >> 4) & 0xf];
+	address_t arg;
+
+	insn->op = a->op;
+	insn->itype = MSP430_ITYPE_DOUBLE;
+	insn->dsize = MSP430_DSIZE_AWORD;
+	insn->src_mode = a->src_mode;
+	insn->dst_mode = a->dst_mode;
+	insn->src_reg = (op >> 8) & 0xf;
+	insn->dst_reg = op & 0xf;
+
+	if (a->form == ADDR_ROTATE) {
 		/* RxxM */
-		insn->itype = MSP430_ITYPE_DOUBLE;
 		insn->op = op & 0xf3e0;
-		insn->dst_mode = MSP430_AMODE_REGISTER;
-		insn->dst_reg = op & 0xf;
-		insn->src_mode = MSP430_AMODE_IMMEDIATE;
 		insn->src_addr = 1 + ((op >> 10) & 3);
 		insn->dsize = (op & 0x0010) ?
 			MSP430_DSIZE_WORD : MSP430_DSIZE_AWORD;
 		return 2;
+	}
 
-	case 6:
-		if (!have_arg)
-			return -1;
+	*emul = &a->emul;
 
-		insn->dst_mode = MSP430_AMODE_ABSOLUTE;
-		insn->dst_addr = ((op & 0xf) << 16) | arg;
-		return 4;
-
-	case 7:
-		if (!have_arg)
-			return -1;
-		insn->dst_mode = MSP430_AMODE_INDEXED;
-		insn->dst_addr = arg;
-		return 4;
-
-	case 8:
-		if (!have_arg)
-			return -1;
-		insn->src_mode = MSP430_AMODE_IMMEDIATE;
-		insn->src_addr = ((op & 0xf00) << 8) | arg;
-		return 4;
+	if (a->form == ADDR_NONE) {
+		remap_cgen(&insn->src_mode, &insn->src_addr, &insn->src_reg);
+		return 2;
+	}
 
-	case 9:
-		if (!have_arg)
-			return -1;
-		insn->op = MSP430_OP_CMPA;
-		insn->src_mode = MSP430_AMODE_IMMEDIATE;
-		insn->src_addr = ((op & 0xf00) << 8) | arg;
-		return 4;
+	if (len < 4)
+		return -1;
 
-	case 10:
-		if (!have_arg)
-			return -1;
-		insn->op = MSP430_OP_ADDA;
-		insn->src_mode = MSP430_AMODE_IMMEDIATE;
-		insn->src_addr = ((op & 0xf00) << 8) | arg;
-		return 4;
+	arg = get_word(code + 2);
 
-	case 11:
-		if (!have_arg)
-			return -1;
-		insn->op = MSP430_OP_SUBA;
-		insn->src_mode = MSP430_AMODE_IMMEDIATE;
+	switch (a->form) {
+	case ADDR_SRC_20:
 		insn->src_addr = ((op & 0xf00) << 8) | arg;
-		return 4;
-
-	case 12:
-		return 2;
+		break;
 
-	case 13:
-		insn->op = MSP430_OP_CMPA;
-		return 2;
+	case ADDR_SRC_16:
+		insn->src_addr = arg;
+		break;
 
-	case 14:
-		insn->op = MSP430_OP_ADDA;
-		return 2;
+	case ADDR_DST_20:
+		insn->dst_addr = ((op & 0xf) << 16) | arg;
+		break;
 
-	case 15:
-		insn->op = MSP430_OP_SUBA;
-		return 2;
+	default:
+		insn->dst_addr = arg;
+		break;
 	}
 
-	return -1;
+	remap_cgen(&insn->src_mode, &insn->src_addr, &insn->src_reg);
+	return 4;
 }
 
 static int decode_13xx(const uint8_t *code, address_t len,
 		       struct msp430_instruction *insn)
 {
-	uint16_t op = code[0] | (code[1] << 8);
+	uint16_t op = get_word(code);
 	int subtype = (op >> 4) & 0xf;
 
 	insn->itype = MSP430_ITYPE_SINGLE;
@@ -179,6 +565,7 @@ static int decode_13xx(const uint8_t *code, address_t len,
 	case 4:
 		insn->dst_mode = MSP430_AMODE_REGISTER;
 		insn->dst_reg = op & 0xf;
+		remap_cgen(&insn->dst_mode, &insn->dst_addr, &insn->dst_reg);
 		return 2;
 
 	case 5:
@@ -189,11 +576,13 @@ static int decode_13xx(const uint8_t *code, address_t len,
 	case 6:
 		insn->dst_mode = MSP430_AMODE_INDIRECT;
 		insn->dst_reg = op & 0xf;
+		remap_cgen(&insn->dst_mode, &insn->dst_addr, &insn->dst_reg);
 		return 2;
 
 	case 7:
 		insn->dst_mode = MSP430_AMODE_INDIRECT_INC;
 		insn->dst_reg = op & 0xf;
+		remap_cgen(&insn->dst_mode, &insn->dst_addr, &insn->dst_reg);
 		return 2;
 
 	case 8:
@@ -219,16 +608,16 @@ static int decode_13xx(const uint8_t *code, address_t len,
 		return -1;
 
 	insn->dsize = MSP430_DSIZE_AWORD;
-	insn->dst_addr |= code[2];
-	insn->dst_addr |= code[3] << 8;
+	insn->dst_addr |= get_word(code + 2);
 
+	remap_cgen(&insn->dst_mode, &insn->dst_addr, &insn->dst_reg);
 	return 4;
 }
 
 static int decode_14xx(const uint8_t *code,
 		       struct msp430_instruction *insn)
 {
-	uint16_t op = (code[1] << 8) | code[0];
+	uint16_t op = get_word(code);
 
 	/* PUSHM/POPM */
 	insn->itype = MSP430_ITYPE_DOUBLE;
@@ -252,62 +641,29 @@ static int decode_single(const uint8_t *code, address_t offset,
 			 address_t size, struct msp430_instruction *insn,
 			 uint16_t ex_word)
 {
-	uint16_t op = (code[1] << 8) | code[0];
-	int need_arg = 0;
+	const uint16_t op = get_word(code);
+	const struct operand_enc *dst = &src_operands[src_index(op, op & 0xf)];
 
 	insn->itype = MSP430_ITYPE_SINGLE;
 	insn->op = op & 0xff80;
+	insn->dsize = decode_dsize(op, ex_word,
+		insn->op == MSP430_OP_SWPB || insn->op == MSP430_OP_SXT);
 
-	/* length encoding is based on AL bit (if ex_word present) and BW bit;
-	   SWPB and SXT have non-standard encodings */
-	insn->dsize = (insn->op != MSP430_OP_SWPB && insn->op != MSP430_OP_SXT)
-		? ((!ex_word || (ex_word & 0x0040))
-			? ((op & 0x0040) ? MSP430_DSIZE_BYTE : MSP430_DSIZE_WORD)
-			: ((op & 0x0040) ? MSP430_DSIZE_AWORD : MSP430_DSIZE_UNKNOWN))
-		: ((op & 0x0040)
-			? MSP430_DSIZE_UNKNOWN
-			: (!ex_word || (ex_word & 0x0040)) ? MSP430_DSIZE_WORD : MSP430_DSIZE_AWORD);
-
-	insn->dst_mode = (op >> 4) & 0x3;
+	insn->dst_mode = dst->mode;
 	insn->dst_reg = op & 0xf;
+	insn->dst_addr = dst->value;
 
-	switch (insn->dst_mode) {
-	case MSP430_AMODE_REGISTER: break;
-
-	case MSP430_AMODE_INDEXED:
-		need_arg = 1;
-		if (insn->dst_reg == MSP430_REG_PC) {
-			insn->dst_addr = offset + 4;
-			insn->dst_mode = MSP430_AMODE_SYMBOLIC;
-		} else if (insn->dst_reg == MSP430_REG_SR) {
-			insn->dst_mode = MSP430_AMODE_ABSOLUTE;
-		} else if (insn->dst_reg == MSP430_REG_R3) {
-			need_arg = 0; /* constant generator: #1 */
-		}
-		break;
-
-	case MSP430_AMODE_INDIRECT: break;
-
-	case MSP430_AMODE_INDIRECT_INC:
-		if (insn->dst_reg == MSP430_REG_PC) {
-			insn->dst_mode = MSP430_AMODE_IMMEDIATE;
-			need_arg = 1;
-		}
-		break;
-
-	default: break;
-	}
+	if (!(dst->flags & OPERAND_WORD))
+		return 2;
 
-	if (need_arg) {
-		if (size < 4)
-			return -1;
+	if (size < 4)
+		return -1;
 
-		insn->dst_addr = add_index(insn->dst_addr,
-			(code[3] << 8) | code[2], 0);
-		return 4;
-	}
+	if (dst->flags & OPERAND_PCREL)
+		insn->dst_addr = offset + 4;
 
-	return 2;
+	insn->dst_addr = (insn->dst_addr + get_word(code + 2)) & 0xffff;
+	return 4;
 }
 
 /* Decode a double-operand instruction.
@@ -317,95 +673,58 @@ static int decode_single(const uint8_t *code, address_t offset,
  */
 static int decode_double(const uint8_t *code, address_t offset,
 			 address_t size, struct msp430_instruction *insn,
-			 uint16_t ex_word)
+			 uint16_t ex_word, const struct emul_list **emul)
 {
-	uint16_t op = (code[1] << 8) | code[0];
-	int need_src = 0;
-	int need_dst = 0;
+	const uint16_t op = get_word(code);
+	const struct operand_enc *src =
+		&src_operands[src_index(op, (op >> 8) & 0xf)];
+	const struct operand_enc *dst =
+		&dst_operands[((op >> 3) & 0x10) | (op & 0xf)];
+	const address_t mask = ex_word ? 0xfffff : 0xffff;
 	int ret = 2;
 
-	/* Decode and consume opcode */
 	insn->itype = MSP430_ITYPE_DOUBLE;
 	insn->op = op & 0xf000;
-	insn->dsize = (!ex_word || (ex_word & 0x0040))
-		? ((op & 0x0040) ? MSP430_DSIZE_BYTE : MSP430_DSIZE_WORD)
-		: ((op & 0x0040) ? MSP430_DSIZE_AWORD : MSP430_DSIZE_UNKNOWN);
+	insn->dsize = decode_dsize(op, ex_word, 0);
 
-	insn->src_mode = (op >> 4) & 0x3;
+	insn->src_mode = src->mode;
 	insn->src_reg = (op >> 8) & 0xf;
+	insn->src_addr = src->value;
 
-	insn->dst_mode = (op >> 7) & 0x1;
+	insn->dst_mode = dst->mode;
 	insn->dst_reg = op & 0xf;
+	insn->dst_addr = dst->value;
 
-	offset += 2;
-	code += 2;
-	size -= 2;
-
-	/* Decode and consume source operand */
-	switch (insn->src_mode) {
-	case MSP430_AMODE_REGISTER: break;
-	case MSP430_AMODE_INDEXED:
-		need_src = 1;
-
-		if (insn->src_reg == MSP430_REG_PC) {
-			insn->src_mode = MSP430_AMODE_SYMBOLIC;
-			insn->src_addr = offset;
-		} else if (insn->src_reg == MSP430_REG_SR)
-			insn->src_mode = MSP430_AMODE_ABSOLUTE;
-		else if (insn->src_reg == MSP430_REG_R3)
-			need_src = 0;
-		break;
-
-	case MSP430_AMODE_INDIRECT: break;
-
-	case MSP430_AMODE_INDIRECT_INC:
-		if (insn->src_reg == MSP430_REG_PC) {
-			insn->src_mode = MSP430_AMODE_IMMEDIATE;
-			need_src = 1;
-		}
-		break;
-
-	default: break;
-	}
+	/* Emulated instructions other than those with a constant or
+	 * special register operand have the same source and destination.
+	 */
+	if (((src->flags | dst->flags) & OPERAND_EMUL) ||
+	    ((op >> 8) & 0xf) == (op & 0xf))
+		*emul = &emul_double[!!ex_word][op >> 12];
 
-	if (need_src) {
-		if (size < 2)
+	if (src->flags & OPERAND_WORD) {
+		if (size < 4)
 			return -1;
 
-		insn->src_addr = add_index(insn->src_addr,
-			((ex_word << 9) & 0xf0000) |
-			((code[1] << 8) | code[0]),
-			ex_word);
-		offset += 2;
-		code += 2;
-		size -= 2;
-		ret += 2;
-	}
-
-	/* Decode and consume destination operand */
-	switch (insn->dst_mode) {
-	case MSP430_AMODE_REGISTER: break;
-	case MSP430_AMODE_INDEXED:
-		need_dst = 1;
-
-		if (insn->dst_reg == MSP430_REG_PC) {
-			insn->dst_mode = MSP430_AMODE_SYMBOLIC;
-			insn->dst_addr = offset;
-		} else if (insn->dst_reg == MSP430_REG_SR)
-			insn->dst_mode = MSP430_AMODE_ABSOLUTE;
-		break;
+		if (src->flags & OPERAND_PCREL)
+			insn->src_addr = offset + 2;
 
-	default: break;
+		insn->src_addr = (insn->src_addr +
+			(((ex_word << 9) & 0xf0000) | get_word(code + 2))) &
+			mask;
+		ret += 2;
 	}
 
-	if (need_dst) {
-		if (size < 2)
+	if (dst->flags & OPERAND_WORD) {
+		if (size < ret + 2)
 			return -1;
 
-		insn->dst_addr = add_index(insn->dst_addr,
-			((ex_word << 16) & 0xf0000) |
-			(code[1] << 8) | code[0],
-			ex_word);
+		if (dst->flags & OPERAND_PCREL)
+			insn->dst_addr = offset + ret;
+
+		insn->dst_addr = (insn->dst_addr +
+			(((ex_word << 16) & 0xf0000) | get_word(code + ret))) &
+			mask;
 		ret += 2;
 	}
 
@@ -420,7 +739,7 @@ static int decode_double(const uint8_t *code, address_t offset,
 static int decode_jump(const uint8_t *code, address_t offset,
 		       struct msp430_instruction *insn)
 {
-	uint16_t op = (code[1] << 8) | code[0];
+	uint16_t op = get_word(code);
 	int tgtrel = op & 0x3ff;
 
 	if (tgtrel & 0x200)
@@ -435,330 +754,72 @@ static int decode_jump(const uint8_t *code, address_t offset,
 	return 2;
 }
 
-static void remap_cgen(msp430_amode_t *mode,
-		       address_t *addr,
-		       msp430_reg_t *reg)
-{
-	if (*reg == MSP430_REG_SR) {
-		if (*mode == MSP430_AMODE_INDIRECT) {
-			*mode = MSP430_AMODE_IMMEDIATE;
-			*addr = 4;
-		} else if (*mode == MSP430_AMODE_INDIRECT_INC) {
-			*mode = MSP430_AMODE_IMMEDIATE;
-			*addr = 8;
-		}
-	} else if (*reg == MSP430_REG_R3) {
-		if (*mode == MSP430_AMODE_REGISTER)
-			*addr = 0;
-		else if (*mode == MSP430_AMODE_INDEXED)
-			*addr = 1;
-		else if (*mode == MSP430_AMODE_INDIRECT)
-			*addr = 2;
-		else if (*mode == MSP430_AMODE_INDIRECT_INC)
-			*addr = ALL_ONES;
-
-		*mode = MSP430_AMODE_IMMEDIATE;
-	}
-}
-
-/* Take a decoded instruction and replace certain addressing modes of
- * the constant generator registers with their corresponding immediate
- * values.
- */
-static void find_cgens(struct msp430_instruction *insn)
-{
-	if (insn->itype == MSP430_ITYPE_DOUBLE)
-		remap_cgen(&insn->src_mode, &insn->src_addr,
-			   &insn->src_reg);
-	else if (insn->itype == MSP430_ITYPE_SINGLE)
-		remap_cgen(&insn->dst_mode, &insn->dst_addr,
-			   &insn->dst_reg);
-}
-
-/* Recognise special cases of real instructions and translate them to
- * emulated instructions.
+/* Decode an instruction with an extension word. Only single and
+ * double-operand instructions may follow an extension word.
  */
-static void find_emulated_ops(struct msp430_instruction *insn)
+static int decode_ext(const uint8_t *code, address_t offset,
+		      address_t len, struct msp430_instruction *insn,
+		      const struct emul_list **emul)
 {
-	switch (insn->op) {
-	case MSP430_OP_ADD:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE) {
-			if (insn->src_addr == 1) {
-				insn->op = MSP430_OP_INC;
-				insn->itype = MSP430_ITYPE_SINGLE;
-			} else if (insn->src_addr == 2) {
-				insn->op = MSP430_OP_INCD;
-				insn->itype = MSP430_ITYPE_SINGLE;
-			}
-		} else if (insn->dst_mode == insn->src_mode &&
-			   insn->dst_reg == insn->src_reg &&
-			   insn->dst_addr == insn->src_addr) {
-			insn->op = MSP430_OP_RLA;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
-
-	case MSP430_OP_ADDA:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    insn->src_addr == 2) {
-			insn->op = MSP430_OP_INCDA;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
-
-	case MSP430_OP_ADDX:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE) {
-			if (insn->src_addr == 1) {
-				insn->op = MSP430_OP_INCX;
-				insn->itype = MSP430_ITYPE_SINGLE;
-			} else if (insn->src_addr == 2) {
-				insn->op = MSP430_OP_INCDX;
-				insn->itype = MSP430_ITYPE_SINGLE;
-			}
-		} else if (insn->dst_mode == insn->src_mode &&
-			   insn->dst_reg == insn->src_reg &&
-			   insn->dst_addr == insn->src_addr) {
-			insn->op = MSP430_OP_RLAX;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
-
-	case MSP430_OP_ADDC:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    !insn->src_addr) {
-			insn->op = MSP430_OP_ADC;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		} else if (insn->dst_mode == insn->src_mode &&
-			   insn->dst_reg == insn->src_reg &&
-			   insn->dst_addr == insn->src_addr) {
-			insn->op = MSP430_OP_RLC;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
-
-	case MSP430_OP_ADDCX:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    !insn->src_addr) {
-			insn->op = MSP430_OP_ADCX;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		} else if (insn->dst_mode == insn->src_mode &&
-			   insn->dst_reg == insn->src_reg &&
-			   insn->dst_addr == insn->src_addr) {
-			insn->op = MSP430_OP_RLCX;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
-
-	case MSP430_OP_BIC:
-		if (insn->dst_mode == MSP430_AMODE_REGISTER &&
-		    insn->dst_reg == MSP430_REG_SR &&
-		    insn->src_mode == MSP430_AMODE_IMMEDIATE) {
-			if (insn->src_addr == 1) {
-				insn->op = MSP430_OP_CLRC;
-				insn->itype = MSP430_ITYPE_NOARG;
-			} else if (insn->src_addr == 4) {
-				insn->op = MSP430_OP_CLRN;
-				insn->itype = MSP430_ITYPE_NOARG;
-			} else if (insn->src_addr == 2) {
-				insn->op = MSP430_OP_CLRZ;
-				insn->itype = MSP430_ITYPE_NOARG;
-			} else if (insn->src_addr == 8) {
-				insn->op = MSP430_OP_DINT;
-				insn->itype = MSP430_ITYPE_NOARG;
-			}
-		}
-		break;
-
-	case MSP430_OP_BIS:
-		if (insn->dst_mode == MSP430_AMODE_REGISTER &&
-		    insn->dst_reg == MSP430_REG_SR &&
-		    insn->src_mode == MSP430_AMODE_IMMEDIATE) {
-			if (insn->src_addr == 1) {
-				insn->op = MSP430_OP_SETC;
-				insn->itype = MSP430_ITYPE_NOARG;
-			} else if (insn->src_addr == 4) {
-				insn->op = MSP430_OP_SETN;
-				insn->itype = MSP430_ITYPE_NOARG;
-			} else if (insn->src_addr == 2) {
-				insn->op = MSP430_OP_SETZ;
-				insn->itype = MSP430_ITYPE_NOARG;
-			} else if (insn->src_addr == 8) {
-				insn->op = MSP430_OP_EINT;
-				insn->itype = MSP430_ITYPE_NOARG;
-			}
-		}
-		break;
-
-	case MSP430_OP_CMP:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    !insn->src_addr) {
-			insn->op = MSP430_OP_TST;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
-
-	case MSP430_OP_CMPA:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    !insn->src_addr) {
-			insn->op = MSP430_OP_TSTA;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
-
-	case MSP430_OP_CMPX:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    !insn->src_addr) {
-			insn->op = MSP430_OP_TSTX;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
-
-	case MSP430_OP_DADD:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    !insn->src_addr) {
-			insn->op = MSP430_OP_DADC;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
-
-	case MSP430_OP_DADDX:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    !insn->src_addr) {
-			insn->op = MSP430_OP_DADCX;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
-
-	case MSP430_OP_MOV:
-		if (insn->src_mode == MSP430_AMODE_INDIRECT_INC &&
-		    insn->src_reg == MSP430_REG_SP) {
-			if (insn->dst_mode == MSP430_AMODE_REGISTER &&
-			    insn->dst_reg == MSP430_REG_PC) {
-				insn->op = MSP430_OP_RET;
-				insn->itype = MSP430_ITYPE_NOARG;
-			} else {
-				insn->op = MSP430_OP_POP;
-				insn->itype = MSP430_ITYPE_SINGLE;
-			}
-		} else if (insn->dst_mode == MSP430_AMODE_REGISTER &&
-			   insn->dst_reg == MSP430_REG_PC) {
-			insn->op = MSP430_OP_BR;
-			insn->itype = MSP430_ITYPE_SINGLE;
-			insn->dst_mode = insn->src_mode;
-			insn->dst_reg = insn->src_reg;
-			insn->dst_addr = insn->src_addr;
-		} else if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-			   !insn->src_addr) {
-			if (insn->dst_mode == MSP430_AMODE_REGISTER &&
-			    insn->dst_reg == MSP430_REG_R3) {
-				insn->op = MSP430_OP_NOP;
-				insn->itype = MSP430_ITYPE_NOARG;
-			} else {
-				insn->op = MSP430_OP_CLR;
-				insn->itype = MSP430_ITYPE_SINGLE;
-			}
-		}
-		break;
+	const uint16_t ex_word = get_word(code);
+	uint16_t op;
+	int all_reg;
+	int ret;
 
-	case MSP430_OP_MOVA:
-		if (insn->src_mode == MSP430_AMODE_INDIRECT_INC &&
-		    insn->src_reg == MSP430_REG_SP) {
-			if (insn->dst_mode == MSP430_AMODE_REGISTER &&
-			    insn->dst_reg == MSP430_REG_PC) {
-				insn->op = MSP430_OP_RETA;
-				insn->itype = MSP430_ITYPE_NOARG;
-			} else {
-				insn->op = MSP430_OP_POPX;
-				insn->itype = MSP430_ITYPE_SINGLE;
-			}
-		} else if (insn->dst_mode == MSP430_AMODE_REGISTER &&
-			   insn->dst_reg == MSP430_REG_PC) {
-			insn->op = MSP430_OP_BRA;
-			insn->itype = MSP430_ITYPE_SINGLE;
-			insn->dst_mode = insn->src_mode;
-			insn->dst_reg = insn->src_reg;
-			insn->dst_addr = insn->src_addr;
-		} else if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-			   !insn->src_addr) {
-			if (insn->dst_mode == MSP430_AMODE_REGISTER &&
-			    insn->dst_reg == MSP430_REG_R3) {
-				insn->op = MSP430_OP_NOP;
-				insn->itype = MSP430_ITYPE_NOARG;
-			} else {
-				insn->op = MSP430_OP_CLRX;
-				insn->itype = MSP430_ITYPE_SINGLE;
-			}
-		}
-		break;
+	if (len < 4)
+		return -1;
 
-	case MSP430_OP_SUB:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE) {
-			if (insn->src_addr == 1) {
-				insn->op = MSP430_OP_DEC;
-				insn->itype = MSP430_ITYPE_SINGLE;
-			} else if (insn->src_addr == 2) {
-				insn->op = MSP430_OP_DECD;
-				insn->itype = MSP430_ITYPE_SINGLE;
-			}
-		}
-		break;
+	op = get_word(code + 2);
 
-	case MSP430_OP_SUBA:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    insn->src_addr == 2) {
-			insn->op = MSP430_OP_DECDA;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
+	switch (formats[op >> 8]) {
+	case FMT_SINGLE:
+	case FMT_13XX:
+		ret = decode_single(code + 2, offset + 2, len - 2, insn,
+				    ex_word);
+		all_reg = !(op & 0x0030);
 		break;
 
-	case MSP430_OP_SUBX:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE) {
-			if (insn->src_addr == 1) {
-				insn->op = MSP430_OP_DECX;
-				insn->itype = MSP430_ITYPE_SINGLE;
-			} else if (insn->src_addr == 2) {
-				insn->op = MSP430_OP_DECDX;
-				insn->itype = MSP430_ITYPE_SINGLE;
-			}
-		}
+	case FMT_DOUBLE:
+		ret = decode_double(code + 2, offset + 2, len - 2, insn,
+				    ex_word, emul);
+		all_reg = !(op & 0x00b0);
 		break;
 
-	case MSP430_OP_SUBC:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    !insn->src_addr) {
-			insn->op = MSP430_OP_SBC;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
+	default:
+		return -1;
+	}
 
-	case MSP430_OP_SUBCX:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    !insn->src_addr) {
-			insn->op = MSP430_OP_SECX;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
+	if (ret < 0)
+		return -1;
 
-	case MSP430_OP_XOR:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    insn->src_addr == ALL_ONES) {
-			insn->op = MSP430_OP_INV;
-			insn->itype = MSP430_ITYPE_SINGLE;
-		}
-		break;
+	insn->op |= EXTENSION_BIT;
 
-	case MSP430_OP_XORX:
-		if (insn->src_mode == MSP430_AMODE_IMMEDIATE &&
-		    insn->src_addr == ALL_ONES) {
-			insn->op = MSP430_OP_INVX;
-			insn->itype = MSP430_ITYPE_SINGLE;
+	/* Repetition and carry control apply only if all operands are
+	 * registers as encoded, before any constant generator values are
+	 * substituted.
+	 */
+	if (all_reg) {
+		if ((ex_word >> 8) & 1) {
+			if (insn->op == MSP430_OP_RRCX)
+				insn->op = MSP430_OP_RRUX;
+			else
+				insn->ignore_cy = 1;
 		}
-		break;
-
-	default: break;
+		insn->rep_register = (ex_word >> 7) & 1;
+		insn->rep_index = ex_word & 0xf;
 	}
+
+	return ret + 2;
 }
 
+/* Masks for immediate operands, indexed by data size */
+static const address_t dsize_masks[4] = {
+	[MSP430_DSIZE_WORD]	= 0xffff,
+	[MSP430_DSIZE_BYTE]	= 0xff,
+	[MSP430_DSIZE_UNKNOWN]	= ALL_ONES,
+	[MSP430_DSIZE_AWORD]	= ALL_ONES
+};
+
 /* Decode a single instruction.
  *
  * Returns the number of bytes consumed, or -1 if an error occured.
@@ -771,79 +832,57 @@ static void find_emulated_ops(struct msp430_instruction *insn)
 int dis_decode(const uint8_t *code, address_t offset, address_t len,
 	       struct msp430_instruction *insn)
 {
-	uint16_t op;
-	uint16_t ex_word = 0;
+	const struct emul_list *emul = NULL;
+	address_t ds_mask;
 	int ret;
-	address_t ds_mask = ALL_ONES;
 
 	memset(insn, 0, sizeof(*insn));
 	insn->offset = offset;
 
-	/* Perform decoding */
 	if (len < 2)
 		return -1;
-	op = (code[1] << 8) | code[0];
 
-	if ((op & 0xf800) == 0x1800) {
-		ex_word = op;
-		code += 2;
-		offset += 2;
-		len -= 2;
+	switch (formats[code[1]]) {
+	case FMT_00XX:
+		ret = decode_00xx(code, len, insn, &emul);
+		break;
 
-		if (len < 2)
-			return -1;
-		op = (code[1] << 8) | code[0];
+	case FMT_SINGLE:
+		ret = decode_single(code, offset, len, insn, 0);
+		break;
 
-		if ((op & 0xf000) >= 0x4000)
-			ret = decode_double(code, offset, len, insn, ex_word);
-		else if ((op & 0xf000) == 0x1000 && (op & 0xfc00) < 0x1280)
-			ret = decode_single(code, offset, len, insn, ex_word);
-		else
-			return -1;
+	case FMT_13XX:
+		ret = decode_13xx(code, len, insn);
+		break;
 
-		insn->op |= EXTENSION_BIT;
-		ret += 2;
+	case FMT_14XX:
+		ret = decode_14xx(code, insn);
+		break;
 
-		if (insn->dst_mode == MSP430_AMODE_REGISTER &&
-		    (insn->itype == MSP430_ITYPE_SINGLE ||
-		     insn->src_mode == MSP430_AMODE_REGISTER)) {
-			if ((ex_word >> 8) & 1) {
-				if (insn->op == MSP430_OP_RRCX)
-					insn->op = MSP430_OP_RRUX;
-				else
-					insn->ignore_cy = 1;
-			}
-			insn->rep_register = (ex_word >> 7) & 1;
-			insn->rep_index = ex_word & 0xf;
-		}
+	case FMT_EXT:
+		ret = decode_ext(code, offset, len, insn, &emul);
+		break;
 
-	} else {
-		if ((op & 0xf000) == 0x0000)
-			ret = decode_00xx(code, len, insn);
-		else if ((op & 0xfc00) == 0x1400)
-			ret = decode_14xx(code, insn);
-		else if ((op & 0xff00) == 0x1300)
-			ret = decode_13xx(code, len, insn);
-		else if ((op & 0xf000) == 0x1000)
-			ret = decode_single(code, offset, len, insn, 0);
-		else if ((op & 0xf000) >= 0x2000 && (op & 0xf000) < 0x4000)
-			ret = decode_jump(code, offset, insn);
-		else if ((op & 0xf000) >= 0x4000)
-			ret = decode_double(code, offset, len, insn, 0);
-		else
-			return -1;
+	case FMT_JUMP:
+		ret = decode_jump(code, offset, insn);
+		break;
+
+	case FMT_DOUBLE:
+		ret = decode_double(code, offset, len, insn, 0, &emul);
+		break;
+
+	default:
+		return -1;
 	}
 
-	/* Interpret "emulated" instructions, constant generation, and
-	 * trim data sizes.
-	 */
-	find_cgens(insn);
-	find_emulated_ops(insn);
+	if (ret < 0)
+		return -1;
+
+	if (emul)
+		find_emulated_ops(insn, emul);
 
-	if (insn->dsize == MSP430_DSIZE_BYTE)
-		ds_mask = 0xff;
-	else if (insn->dsize == MSP430_DSIZE_WORD)
-		ds_mask = 0xffff;
+	/* Trim immediate operands to the data size */
+	ds_mask = dsize_masks[insn->dsize];
 
 	if (insn->src_mode == MSP430_AMODE_IMMEDIATE)
 		insn->src_addr &= ds_mask;
@@ -17,6 +17,7 @@
  */
 
 #ifndef DIS_H_
+#define DIS_H_
 
 #include <stdint.h>
 #include "util.h"
@@ -0,0 +1,91 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifndef __Windows__
+#include <sys/mman.h>
+#endif
+
+#include "fmap.h"
+#include "output.h"
+
+int fmap_map(struct fmap *m, FILE *in, int flags)
+{
+	struct stat st;
+
+	memset(m, 0, sizeof(*m));
+
+	if (fstat(fileno(in), &st) < 0) {
+		pr_error("fmap: can't stat file");
+		return -1;
+	}
+
+	if (st.st_size > INT_MAX) {
+		printc_err("fmap: file too large\n");
+		return -1;
+	}
+
+	m->len = st.st_size;
+	if (!m->len)
+		return 0;
+
+#ifndef __Windows__
+	m->data = mmap(NULL, m->len,
+		       (flags & FMAP_WRITABLE) ?
+		       PROT_READ | PROT_WRITE : PROT_READ,
+		       MAP_PRIVATE, fileno(in), 0);
+	if (m->data != MAP_FAILED) {
+		m->mapped = 1;
+		return 0;
+	}
+#endif
+
+	/* Fall back to reading the file */
+	m->data = malloc(m->len);
+	if (!m->data) {
+		pr_error("fmap: can't allocate memory");
+		return -1;
+	}
+
+	rewind(in);
+	if (fread(m->data, 1, m->len, in) != m->len) {
+		pr_error("fmap: can't read file");
+		free(m->data);
+		m->data = NULL;
+		return -1;
+	}
+
+	return 0;
+}
+
+void fmap_unmap(struct fmap *m)
+{
+#ifndef __Windows__
+	if (m->mapped)
+		munmap(m->data, m->len);
+	else
+#endif
+		free(m->data);
+
+	memset(m, 0, sizeof(*m));
+}
@@ -0,0 +1,48 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef FMAP_H_
+#define FMAP_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/* A whole-file mapping. Where mmap() is available, the file is mapped
+ * directly. Otherwise, it's read into a heap buffer.
+ *
+ * The mapping is private: if FMAP_WRITABLE is given, the data may be
+ * modified without affecting the underlying file.
+ */
+struct fmap {
+	uint8_t		*data;
+	size_t		len;
+	int		mapped;
+};
+
+#define FMAP_WRITABLE	0x01
+
+/* Map the entire contents of an open file. The file may be closed
+ * afterwards. Returns 0 on success or -1 on error.
+ */
+int fmap_map(struct fmap *m, FILE *in, int flags);
+
+/* Release a mapping */
+void fmap_unmap(struct fmap *m);
+
+#endif
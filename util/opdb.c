@@ -121,9 +121,51 @@ static const struct opdb_key keys[] = {
 "If set, disassembled instruction and register name are displayed in\n"
 "lowercase.\n"
 	},
+	{
+		.name = "symcache_dir",
+		.type = OPDB_TYPE_STRING,
+		.help =
+"If set, symbol tables loaded from image files by \"prog\" and\n"
+"\"sym import\" are cached in this directory, and are reused without\n"
+"parsing while the image is unchanged.\n"
+	},
+	{
+		.name = "batch_output",
+		.type = OPDB_TYPE_BOOLEAN,
+		.help =
+"If set, output is flushed when each command completes, before input is\n"
+"read or the program waits on the device, and every 50 ms while output\n"
+"continues, rather than after every line. This makes large dumps much\n"
+"faster when output is redirected. Embedded-mode shell messages are\n"
+"always flushed immediately.\n"
+	},
+	{
+		.name = "output_thread",
+		.type = OPDB_TYPE_BOOLEAN,
+		.help =
+"If set, output is written by a background thread, so that commands\n"
+"printing a lot of text don't wait for the terminal. Output is still\n"
+"written in order, and is always complete before input is read.\n"
+	},
+	{
+		.name = "json_records",
+		.type = OPDB_TYPE_BOOLEAN,
+		.help =
+"In embedded mode, send registers, memory, disassembly, breakpoints and\n"
+"power samples to the front-end as JSON records instead of text.\n"
+	},
+	{
+		.name = "devcache_dir",
+		.type = OPDB_TYPE_STRING,
+		.help =
+"If set, drivers cache chip identification results and clock\n"
+"calibration constants in this directory, and reuse them when the same\n"
+"adapter and chip are seen again.\n"
+	},
 };
 
 static union opdb_value values[ARRAY_LEN(keys)];
+static unsigned int generation;
 
 static int opdb_find(const char *name)
 {
@@ -149,6 +191,8 @@ void opdb_reset(void)
 
 		memcpy(value, &key->defval, sizeof(*value));
 	}
+
+	generation++;
 }
 
 int opdb_enum(opdb_enum_func_t func, void *user_data)
@@ -197,9 +241,15 @@ int opdb_set(const char *name, const union opdb_value *value)
 	if (keys[i].type == OPDB_TYPE_STRING)
 		v->string[sizeof(v->string) - 1] = 0;
 
+	generation++;
 	return 0;
 }
 
+unsigned int opdb_generation(void)
+{
+	return generation;
+}
+
 const char *opdb_get_string(const char *name)
 {
 	int idx = opdb_find(name);
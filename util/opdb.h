@@ -57,6 +57,11 @@ int opdb_get(const char *name, struct opdb_key *key,
 
 int opdb_set(const char *name, const union opdb_value *value);
 
+/* Fetch a counter which changes whenever any option is set or reset.
+ * Options which are read very often may be cached until it changes.
+ */
+unsigned int opdb_generation(void);
+
 /* Get wrappers */
 const char *opdb_get_string(const char *name);
 int opdb_get_boolean(const char *name);
@@ -23,10 +23,13 @@
 
 #ifdef __Windows__
 #include <windows.h>
+#else
+#include <time.h>
 #endif
 
 #include "opdb.h"
 #include "output.h"
+#include "thread.h"
 #include "util.h"
 
 static capture_func_t capture_func;
@@ -119,67 +122,384 @@ static int parse_text(const char *text)
 	return len;
 }
 
-/* Print an ANSI code, or change the console text colour. */
-static void emit_ansi(const char *code, int len, int ansi_state, FILE *out)
+/* Options which affect every line are cached until they change */
+static unsigned int opt_generation;
+static int opt_valid;
+static int opt_color;
+static int opt_quiet;
+static int opt_batch;
+static int opt_records;
+
+/************************************************************************
+ * Background writer
+ */
+
+/* Output waiting for the writer is a sequence of chunks, each a header
+ * followed by text for one stream. Text is appended to the last chunk
+ * while the stream doesn't change.
+ */
+struct out_chunk {
+	FILE			*out;
+	int			len;
+};
+
+/* If this much output is waiting, the printing thread waits for the
+ * writer to catch up.
+ */
+#define WRITER_BACKLOG		(1 << 20)
+
+struct writer {
+	int			running;
+	thread_t		thread;
+
+	thread_lock_t		lock;
+	thread_cond_t		cond_data;
+	thread_cond_t		cond_idle;
+
+	struct vector		pending;
+	int			last_chunk;
+	FILE			*last_out;
+	int			busy;
+	int			stop;
+};
+
+static struct writer writer;
+
+static void write_chunks(const struct vector *v)
 {
-#ifdef __Windows__
-	if (is_embedded_mode) {
-		fwrite(code, 1, len, out);
-	} else {
-		fflush(out);
-		SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE),
-					ansi_state);
+	FILE *prev = NULL;
+	int i = 0;
+
+	while (i < v->size) {
+		struct out_chunk c;
+
+		memcpy(&c, (const char *)v->ptr + i, sizeof(c));
+		i += sizeof(c);
+
+		/* Keep streams in order relative to each other */
+		if (prev && prev != c.out)
+			fflush(prev);
+
+		fwrite((const char *)v->ptr + i, 1, c.len, c.out);
+		i += c.len;
+		prev = c.out;
+	}
+
+	if (prev)
+		fflush(prev);
+}
+
+static void writer_main(void *user_data)
+{
+	struct writer *w = (struct writer *)user_data;
+	struct vector batch;
+
+	vector_init(&batch, 1);
+	thread_lock_acquire(&w->lock);
+
+	for (;;) {
+		struct vector t;
+
+		while (!w->pending.size && !w->stop) {
+			w->busy = 0;
+			thread_cond_notify(&w->cond_idle);
+			thread_cond_wait(&w->cond_data, &w->lock);
+		}
+
+		if (!w->pending.size)
+			break;
+
+		/* Take everything waiting, and write it without holding
+		 * the lock.
+		 */
+		t = batch;
+		batch = w->pending;
+		w->pending = t;
+		w->pending.size = 0;
+		w->busy = 1;
+
+		thread_lock_release(&w->lock);
+		write_chunks(&batch);
+		batch.size = 0;
+		thread_lock_acquire(&w->lock);
+	}
+
+	w->busy = 0;
+	thread_cond_notify(&w->cond_idle);
+	thread_lock_release(&w->lock);
+	vector_destroy(&batch);
+}
+
+static void writer_wait_idle(struct writer *w)
+{
+	thread_lock_acquire(&w->lock);
+	while (w->pending.size || w->busy)
+		thread_cond_wait(&w->cond_idle, &w->lock);
+	thread_lock_release(&w->lock);
+}
+
+static void writer_start(struct writer *w)
+{
+	fflush(stdout);
+	fflush(stderr);
+
+	memset(w, 0, sizeof(*w));
+	vector_init(&w->pending, 1);
+	thread_lock_init(&w->lock);
+	thread_cond_init(&w->cond_data);
+	thread_cond_init(&w->cond_idle);
+
+	if (thread_create(&w->thread, writer_main, w) < 0) {
+		thread_lock_destroy(&w->lock);
+		thread_cond_destroy(&w->cond_data);
+		thread_cond_destroy(&w->cond_idle);
+		return;
+	}
+
+	w->running = 1;
+}
+
+static void writer_stop(struct writer *w)
+{
+	if (!w->running)
+		return;
+
+	thread_lock_acquire(&w->lock);
+	w->stop = 1;
+	thread_cond_notify(&w->cond_data);
+	thread_lock_release(&w->lock);
+
+	thread_join(w->thread);
+	w->running = 0;
+
+	thread_lock_destroy(&w->lock);
+	thread_cond_destroy(&w->cond_data);
+	thread_cond_destroy(&w->cond_idle);
+	vector_destroy(&w->pending);
+}
+
+/* Queue text for the writer. If memory runs out, the text is written
+ * directly once the writer has caught up.
+ */
+static void writer_queue(struct writer *w, const char *text, int len,
+			 FILE *out)
+{
+	struct out_chunk c;
+	int was_empty;
+
+	thread_lock_acquire(&w->lock);
+
+	while (w->pending.size >= WRITER_BACKLOG)
+		thread_cond_wait(&w->cond_idle, &w->lock);
+
+	was_empty = !w->pending.size;
+
+	if (was_empty || w->last_out != out) {
+		c.out = out;
+		c.len = 0;
+		w->last_chunk = w->pending.size;
+		w->last_out = out;
+		if (vector_push(&w->pending, &c, sizeof(c)) < 0)
+			goto fail;
 	}
+
+	if (vector_push(&w->pending, text, len) < 0)
+		goto fail;
+
+	/* The header may not be aligned, so it's updated by copying */
+	memcpy(&c, (char *)w->pending.ptr + w->last_chunk, sizeof(c));
+	c.len += len;
+	memcpy((char *)w->pending.ptr + w->last_chunk, &c, sizeof(c));
+
+	if (was_empty)
+		thread_cond_notify(&w->cond_data);
+
+	thread_lock_release(&w->lock);
+	return;
+
+fail:
+	thread_lock_release(&w->lock);
+	writer_wait_idle(w);
+	fwrite(text, 1, len, out);
+	fflush(out);
+}
+
+/************************************************************************
+ * Line output
+ */
+
+static void load_options(void)
+{
+	const unsigned int gen = opdb_generation();
+	int want_thread;
+
+	if (opt_valid && gen == opt_generation)
+		return;
+
+	opt_color = opdb_get_boolean("color");
+	opt_quiet = opdb_get_boolean("quiet");
+	opt_batch = opdb_get_boolean("batch_output");
+	opt_records = opdb_get_boolean("json_records");
+	want_thread = opdb_get_boolean("output_thread");
+
+	opt_generation = gen;
+	opt_valid = 1;
+
+#ifdef __Windows__
+	/* Console colours are set out of band, so they can't be
+	 * queued.
+	 */
+	if (!is_embedded_mode && opt_color)
+		want_thread = 0;
+#endif
+
+	if (want_thread && !writer.running)
+		writer_start(&writer);
+	else if (!want_thread && writer.running)
+		writer_stop(&writer);
+}
+
+static unsigned int now_ms(void)
+{
+#ifdef __Windows__
+	return GetTickCount();
 #else
-	fwrite(code, 1, len, out);
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned int)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
 #endif
 }
 
+/* Interval between flushes, when output is batched */
+#define FLUSH_INTERVAL_MS	50
+
+static FILE *last_out;
+static unsigned int last_flush;
+
+static void emit(const char *text, int len, FILE *out)
+{
+	if (writer.running)
+		writer_queue(&writer, text, len, out);
+	else
+		fwrite(text, 1, len, out);
+}
+
+/* Called at the end of each line. Streams are kept in order relative
+ * to each other by flushing one before switching to the other. Urgent
+ * lines (embedded-mode shell messages, which a front-end may be waiting
+ * for) are always flushed immediately.
+ */
+static void end_line(FILE *out, int urgent)
+{
+	unsigned int now;
+
+	if (writer.running)
+		return;
+
+	if (!opt_batch) {
+		fflush(out);
+		return;
+	}
+
+	if (last_out && last_out != out)
+		fflush(last_out);
+	last_out = out;
+
+	now = now_ms();
+	if (urgent || now - last_flush >= FLUSH_INTERVAL_MS) {
+		fflush(out);
+		last_flush = now;
+	}
+}
+
+#ifdef __Windows__
+/* Change the console text colour, once everything before it has been
+ * written.
+ */
+static void emit_ansi(int ansi_state)
+{
+	output_flush();
+	SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), ansi_state);
+}
+#endif
+
 /* Process and print a single line of text. The given line of text must
  * be nul-terminated with no line-ending characters. Embedded ANSI
  * sequences are handled appropriately.
  */
 static void handle_line(const char *text, FILE *out, char sigil)
 {
-	const int want_color = opdb_get_boolean("color");
+	char line[LINEBUF_SIZE + 8];
+	int line_len = 0;
 	char cap_buf[LINEBUF_SIZE];
 	int cap_len = 0;
 	int ansi_state = 7;
 
+	load_options();
+
 	if (is_embedded_mode) {
 		out = stdout;
-		fputc(sigil, out);
+		line[line_len++] = sigil;
 	}
 
+	/* The line is assembled and written in one piece. Text is
+	 * copied for capture only if anyone wants it.
+	 */
 	while (*text) {
 		int r;
 
 		if (*text == 0x1b) {
 			r = parse_ansi(text, &ansi_state);
-			if (want_color)
-				emit_ansi(text, r, ansi_state, out);
+#ifdef __Windows__
+			if (opt_color && !is_embedded_mode) {
+				emit(line, line_len, out);
+				line_len = 0;
+				emit_ansi(ansi_state);
+			} else
+#endif
+			if (opt_color) {
+				memcpy(line + line_len, text, r);
+				line_len += r;
+			}
 		} else {
 			r = parse_text(text);
 
-			memcpy(cap_buf + cap_len, text, r);
-			cap_len += r;
-			fwrite(text, 1, r, out);
+			if (capture_func) {
+				memcpy(cap_buf + cap_len, text, r);
+				cap_len += r;
+			}
+
+			memcpy(line + line_len, text, r);
+			line_len += r;
 		}
 
 		text += r;
 	}
 
 	/* Reset colours if necessary */
-	if (want_color && (ansi_state != 7))
-		emit_ansi("\x1b[0m", 4, 7, out);
+	if (opt_color && (ansi_state != 7)) {
+#ifdef __Windows__
+		if (!is_embedded_mode) {
+			emit(line, line_len, out);
+			line_len = 0;
+			emit_ansi(7);
+		} else
+#endif
+		{
+			memcpy(line + line_len, "\x1b[0m", 4);
+			line_len += 4;
+		}
+	}
 
-	fputc('\n', out);
-	fflush(out);
+	line[line_len++] = '\n';
+	emit(line, line_len, out);
+	end_line(out, sigil == '\\');
 
 	/* Invoke output capture callback */
 	cap_buf[cap_len] = 0;
 	if (capture_func)
-		capture_func(capture_data, cap_buf);
+		capture_func(capture_data, sigil, cap_buf);
 }
 
 /* Push a chunk of text, possibly with embedded ANSI sequences, into a
@@ -246,7 +566,8 @@ int printc_dbg(const char *fmt, ...)
 	char buf[4096];
 	va_list ap;
 
-	if (opdb_get_boolean("quiet"))
+	load_options();
+	if (opt_quiet)
 		return 0;
 
 	va_start(ap, fmt);
@@ -283,6 +604,50 @@ int printc_shell(const char *fmt, ...)
 	return write_text(&lb_shell, buf, stdout, '\\');
 }
 
+int output_records(void)
+{
+	if (!is_embedded_mode)
+		return 0;
+
+	load_options();
+	return opt_records;
+}
+
+void output_record(const char *text, int len)
+{
+	char head[16];
+	int head_len;
+
+	if (!is_embedded_mode)
+		return;
+
+	load_options();
+
+	head_len = snprintf(head, sizeof(head), "@%d ", len);
+	emit(head, head_len, stdout);
+	emit(text, len, stdout);
+	emit("\n", 1, stdout);
+	end_line(stdout, 0);
+}
+
+void output_flush(void)
+{
+	if (writer.running) {
+		writer_wait_idle(&writer);
+		return;
+	}
+
+	fflush(stdout);
+	fflush(stderr);
+	last_flush = now_ms();
+}
+
+void output_exit(void)
+{
+	output_flush();
+	writer_stop(&writer);
+}
+
 void output_set_embedded(int enable)
 {
 	is_embedded_mode = enable;
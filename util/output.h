@@ -38,6 +38,17 @@ int printc_shell(const char *fmt, ...)
 
 void pr_error(const char *prefix);
 
+/* Output may be held back for a while if the "batch_output" or
+ * "output_thread" options are set. output_flush() makes sure that
+ * everything printed so far has been written, and should be called
+ * before reading input. output_exit() flushes output and stops the
+ * background writer, if there is one.
+ *
+ * Output functions should be called from only one thread.
+ */
+void output_flush(void);
+void output_exit(void);
+
 /* Enable embedded output mode. When enabled, all logical streams
  * are sent to stdout (not stderr), and prefixed with the following
  * sigils:
@@ -52,14 +63,24 @@ void pr_error(const char *prefix);
  */
 void output_set_embedded(int enable);
 
+/* Structured records, for embedded mode only (see record.h).
+ * output_records() returns non-zero if records are wanted.
+ * output_record() sends the text of a single record, which must not
+ * contain line breaks.
+ */
+int output_records(void);
+void output_record(const char *text, int len);
+
 /* Capture output. Capturing is started by calling capture_begin() with
  * a callback function. The callback is invoked for each line of output
  * printed to either stdout or stderr (output still goes to
- * stdout/stderr as well).
+ * stdout/stderr as well). The sigil identifies the stream, as listed
+ * above for embedded mode.
  *
  * Capture is ended by calling capture_end().
  */
-typedef void (*capture_func_t)(void *user_data, const char *text);
+typedef void (*capture_func_t)(void *user_data, char sigil,
+			       const char *text);
 
 void capture_start(capture_func_t, void *user_data);
 void capture_end(void);
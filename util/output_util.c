@@ -26,8 +26,8 @@
 #include "output_util.h"
 #include "stab.h"
 #include "util.h"
-#include "demangle.h"
 #include "opdb.h"
+#include "record.h"
 
 static char* copy_string(int lowercase_dis, char *dst, const char *const end,
 			 const char *src)
@@ -208,6 +208,131 @@ static int dis_format(const struct msp430_instruction *insn)
 	return len;
 }
 
+/************************************************************************
+ * Structured records
+ */
+
+static const char *amode_name(msp430_amode_t amode)
+{
+	switch (amode) {
+	case MSP430_AMODE_REGISTER: return "register";
+	case MSP430_AMODE_INDEXED: return "indexed";
+	case MSP430_AMODE_SYMBOLIC: return "symbolic";
+	case MSP430_AMODE_ABSOLUTE: return "absolute";
+	case MSP430_AMODE_INDIRECT: return "indirect";
+	case MSP430_AMODE_INDIRECT_INC: return "indirect-inc";
+	case MSP430_AMODE_IMMEDIATE: return "immediate";
+	}
+
+	return "unknown";
+}
+
+static void record_operand(struct record *r, const char *key,
+			   msp430_amode_t amode, address_t addr,
+			   msp430_reg_t reg)
+{
+	record_object_begin(r, key);
+	record_str(r, "mode", amode_name(amode));
+
+	if (amode != MSP430_AMODE_SYMBOLIC &&
+	    amode != MSP430_AMODE_ABSOLUTE &&
+	    amode != MSP430_AMODE_IMMEDIATE)
+		record_str(r, "reg", reg_name(reg));
+
+	if (amode != MSP430_AMODE_REGISTER &&
+	    amode != MSP430_AMODE_INDIRECT &&
+	    amode != MSP430_AMODE_INDIRECT_INC) {
+		char name[MAX_SYMBOL_LENGTH];
+
+		record_int(r, "value", addr);
+		if (print_address(addr, name, sizeof(name),
+				  PRINT_ADDRESS_EXACT))
+			record_str(r, "sym", name);
+	}
+
+	record_object_end(r);
+}
+
+static void record_insn(struct record *r,
+			const struct msp430_instruction *insn)
+{
+	record_str(r, "op", opcode_name_with_size(insn));
+
+	if (insn->itype == MSP430_ITYPE_DOUBLE)
+		record_operand(r, "src", insn->src_mode, insn->src_addr,
+			       insn->src_reg);
+
+	if (insn->itype != MSP430_ITYPE_NOARG)
+		record_operand(r, "dst", insn->dst_mode, insn->dst_addr,
+			       insn->dst_reg);
+
+	if (insn->rep_register)
+		record_str(r, "repeat_reg", reg_name(insn->rep_index));
+	else if (insn->rep_index)
+		record_int(r, "repeat", insn->rep_index + 1);
+
+	if (insn->ignore_cy)
+		record_bool(r, "ignore_carry", 1);
+}
+
+/* Disassembly as a single record, with one object per instruction. */
+static address_t disassemble_record(address_t offset, const uint8_t *data,
+				    int length, powerbuf_t power)
+{
+	address_t next_offset = offset;
+	struct record r;
+
+	record_begin(&r, "dis");
+	record_array_begin(&r, "insns");
+
+	while (length) {
+		struct msp430_instruction insn = {0};
+		char name[MAX_SYMBOL_LENGTH];
+		address_t oboff;
+		int retval;
+		int count;
+
+		retval = dis_decode(data, offset, length, &insn);
+		if (retval > 0)
+			next_offset = offset + retval;
+		count = retval > 0 ? retval : 2;
+		if (count > length)
+			count = length;
+
+		record_object_begin(&r, NULL);
+		record_int(&r, "addr", offset);
+		record_data(&r, "data", data, count);
+
+		if (stab_resolve(offset, &oboff, NULL) && !oboff &&
+		    print_address(offset, name, sizeof(name), 0))
+			record_str(&r, "label", name);
+
+		if (retval >= 0)
+			record_insn(&r, &insn);
+
+		if (power) {
+			unsigned long long ua;
+			int samples = powerbuf_get_by_mab(power, offset, &ua);
+
+			if (samples) {
+				record_int(&r, "samples", samples);
+				record_int(&r, "ua_sum", ua);
+			}
+		}
+
+		record_object_end(&r);
+
+		offset += count;
+		length -= count;
+		data += count;
+	}
+
+	record_array_end(&r);
+	record_end(&r);
+
+	return next_offset;
+}
+
 address_t disassemble(address_t offset, const uint8_t *data, int length,
 		 powerbuf_t power)
 {
@@ -216,17 +341,18 @@ address_t disassemble(address_t offset, const uint8_t *data, int length,
 	int samples_total = 0;
 	address_t next_offset = offset;
 
+	if (record_enabled())
+		return disassemble_record(offset, data, length, power);
+
 	while (length) {
 		struct msp430_instruction insn = {0};
 		int retval;
 		int count;
 		int i;
 		address_t oboff;
-		char obname[MAX_SYMBOL_LENGTH];
 
 		if (first_line ||
-			(!stab_nearest(offset, obname, sizeof(obname), &oboff) &&
-			 !oboff)) {
+			(stab_resolve(offset, &oboff, NULL) && !oboff)) {
 			char buffer[MAX_SYMBOL_LENGTH];
 
 			print_address(offset, buffer, sizeof(buffer), 0);
@@ -293,6 +419,16 @@ void hexdump(address_t addr, const uint8_t *data, int data_len)
 {
 	int offset = 0;
 
+	if (record_enabled()) {
+		struct record r;
+
+		record_begin(&r, "mem");
+		record_int(&r, "addr", addr);
+		record_data(&r, "data", data, data_len);
+		record_end(&r);
+		return;
+	}
+
 	while (offset < data_len) {
 		int i, j;
 
@@ -324,6 +460,18 @@ void show_regs(const address_t *regs)
 {
 	int i;
 
+	if (record_enabled()) {
+		struct record r;
+
+		record_begin(&r, "regs");
+		record_array_begin(&r, "regs");
+		for (i = 0; i < 16; i++)
+			record_int(&r, NULL, regs[i]);
+		record_array_end(&r);
+		record_end(&r);
+		return;
+	}
+
 	for (i = 0; i < 4; i++) {
 		int j;
 
@@ -342,11 +490,12 @@ void show_regs(const address_t *regs)
 int print_address(address_t addr, char *out, int max_len,
 		  print_address_flags_t f)
 {
-	char name[MAX_SYMBOL_LENGTH];
+	const char *name;
+	const char *demangled;
 	address_t offset;
 
-	if (!stab_nearest(addr, name, sizeof(name), &offset)) {
-		char demangled[MAX_SYMBOL_LENGTH];
+	name = stab_resolve(addr, &offset, &demangled);
+	if (name) {
 		int len;
 
 		if (offset) {
@@ -360,7 +509,7 @@ int print_address(address_t addr, char *out, int max_len,
 			len = snprintf(out, max_len, "%s", name);
 		}
 
-		if (demangle(name, demangled, sizeof(demangled)) > 0)
+		if (demangled && len < max_len)
 			snprintf(out + len, max_len - len, " (%s)", demangled);
 
 		return 1;
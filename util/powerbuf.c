@@ -18,7 +18,109 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <errno.h>
+
+#ifndef __Windows__
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <signal.h>
+#include <poll.h>
+#endif
+
 #include "powerbuf.h"
+#include "vector.h"
+#include "output.h"
+#include "sockets.h"
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+#define SPILL_CHUNK_BYTES	(POWERBUF_SPILL_CHUNK * 8)
+#define SPILL_NO_CHUNK		(~0ULL)
+
+struct spill_header {
+	uint32_t		magic;
+	uint32_t		version;
+	uint32_t		interval_us;
+	uint32_t		chunk_samples;
+	uint64_t		num_samples;
+	uint64_t		index_offset;
+	uint32_t		num_sessions;
+	uint32_t		reserved;
+};
+
+struct spill_index {
+	int64_t			wall_clock;
+	uint64_t		start;
+	uint64_t		total_ua;
+};
+
+struct spill_session {
+	struct powerbuf_session	info;
+	unsigned long long	start;
+};
+
+struct powerbuf_spill {
+	int			fd;
+	char			*path;
+
+	unsigned long long	num_samples;
+	struct vector		sessions;
+
+	/* The last, incomplete, chunk: current samples followed by
+	 * MAB samples. It holds (num_samples % POWERBUF_SPILL_CHUNK)
+	 * samples. Complete chunks are written out immediately.
+	 */
+	uint32_t		*pending;
+
+	/* The chunk most recently read back, either mapped or copied
+	 * into a heap buffer.
+	 */
+	unsigned long long	view_chunk;
+	uint32_t		*view;
+	int			view_mapped;
+};
+
+static int mab_init(powerbuf_t pb);
+static void mab_clear(powerbuf_t pb);
+static void mab_add(powerbuf_t pb, unsigned int count,
+		    const unsigned int *current_ua, const address_t *mab);
+static void mab_remove(powerbuf_t pb, unsigned int idx, unsigned int count);
+static int pyr_init(powerbuf_t pb);
+static void pyr_free(powerbuf_t pb);
+static void pyr_reset(powerbuf_t pb, unsigned long long pos);
+static void pyr_add(powerbuf_t pb, unsigned int count,
+		    const unsigned int *current_ua);
+static void pyr_trim(powerbuf_t pb);
+static void rebuild_indexes(powerbuf_t pb);
+
+static void spill_clear(struct powerbuf_spill *s);
+static void spill_begin_session(powerbuf_t pb, time_t when);
+static void spill_end_session(struct powerbuf_spill *s);
+static const struct powerbuf_session *spill_session_info
+	(struct powerbuf_spill *s, unsigned int rev_idx, unsigned int *length);
+static unsigned int spill_get_samples(powerbuf_t pb, unsigned int rev_idx,
+				      unsigned int offset, unsigned int count,
+				      unsigned int *current_ua,
+				      address_t *mab);
+static unsigned int spill_read(struct powerbuf_spill *s,
+			       unsigned long long pos, unsigned int count,
+			       unsigned int *current_ua, address_t *mab);
+static unsigned long long spill_session_start(struct powerbuf_spill *s,
+					      unsigned int rev_idx);
+static void spill_add_samples(powerbuf_t pb, unsigned int count,
+			      const unsigned int *current_ua,
+			      const address_t *mab);
+static void stream_begin_session(powerbuf_t pb, time_t when);
+static void stream_add_samples(powerbuf_t pb, unsigned int count,
+			       const unsigned int *current_ua,
+			       const address_t *mab);
 
 powerbuf_t powerbuf_new(unsigned int max_samples, unsigned int interval_us)
 {
@@ -47,8 +149,15 @@ powerbuf_t powerbuf_new(unsigned int max_samples, unsigned int interval_us)
 		return NULL;
 	}
 
-	pb->sorted = malloc(sizeof(pb->sorted[0]) * max_samples);
-	if (!pb->sorted) {
+	if (mab_init(pb) < 0) {
+		free(pb->current_ua);
+		free(pb->mab);
+		free(pb);
+		return NULL;
+	}
+
+	if (pyr_init(pb) < 0) {
+		free(pb->by_mab);
 		free(pb->current_ua);
 		free(pb->mab);
 		free(pb);
@@ -66,9 +175,12 @@ powerbuf_t powerbuf_new(unsigned int max_samples, unsigned int interval_us)
 
 void powerbuf_free(powerbuf_t pb)
 {
+	powerbuf_stream_close(pb);
+	powerbuf_spill_close(pb);
 	free(pb->current_ua);
 	free(pb->mab);
-	free(pb->sorted);
+	free(pb->by_mab);
+	pyr_free(pb);
 	free(pb);
 }
 
@@ -76,7 +188,13 @@ void powerbuf_clear(powerbuf_t pb)
 {
 	pb->session_head = pb->session_tail = 0;
 	pb->current_head = pb->current_tail = 0;
-	pb->sort_valid = 0;
+	pb->tail_pos = 0;
+	pb->dropped = 0;
+	mab_clear(pb);
+	pyr_reset(pb, 0);
+
+	if (pb->spill)
+		spill_clear(pb->spill);
 }
 
 static unsigned int session_length(powerbuf_t pb, unsigned int idx)
@@ -100,10 +218,14 @@ static void pop_oldest_session(powerbuf_t pb)
 {
 	unsigned int length = session_length(pb, pb->session_tail);
 
+	if (!pb->spill)
+		mab_remove(pb, pb->current_tail, length);
+
 	/* Remove corresponding samples from the tail of the current/MAB
 	 * buffers.
 	 */
 	pb->current_tail = (pb->current_tail + length) % pb->max_samples;
+	pb->tail_pos += length;
 
 	/* Remove the session from the session buffer. */
 	pb->session_tail = (pb->session_tail + 1) % POWERBUF_MAX_SESSIONS;
@@ -130,6 +252,11 @@ void powerbuf_begin_session(powerbuf_t pb, time_t when)
 
 	/* Advance the head pointer */
 	pb->session_head = next_head;
+
+	if (pb->spill)
+		spill_begin_session(pb, when);
+	if (pb->stream)
+		stream_begin_session(pb, when);
 }
 
 /* Return the index of the nth most recent session */
@@ -144,6 +271,9 @@ void powerbuf_end_session(powerbuf_t pb)
 	/* (head-1) modulo MAX_SESSIONS */
 	const unsigned int last_idx = rev_index(pb, 0);
 
+	if (pb->spill)
+		spill_end_session(pb->spill);
+
 	/* If there are no sessions, do nothing */
 	if (pb->session_head == pb->session_tail)
 		return;
@@ -155,25 +285,119 @@ void powerbuf_end_session(powerbuf_t pb)
 		pb->session_head = last_idx;
 }
 
-unsigned int powerbuf_num_sessions(powerbuf_t pb)
+static unsigned int ring_num_sessions(powerbuf_t pb)
 {
 	/* (head-tail) modulo MAX_SESSIONS */
 	return (pb->session_head + POWERBUF_MAX_SESSIONS - pb->session_tail) %
 		POWERBUF_MAX_SESSIONS;
 }
 
+unsigned int powerbuf_num_sessions(powerbuf_t pb)
+{
+	if (pb->spill)
+		return pb->spill->sessions.size;
+
+	return ring_num_sessions(pb);
+}
+
 const struct powerbuf_session *powerbuf_session_info(powerbuf_t pb,
 	unsigned int rev_idx, unsigned int *length)
 {
 	/* (head-1-rev_idx) modulo MAX_SESSIONS */
 	const unsigned int idx_map = rev_index(pb, rev_idx);
 
+	if (pb->spill)
+		return spill_session_info(pb->spill, rev_idx, length);
+
 	if (length)
 		*length = session_length(pb, idx_map);
 
 	return &pb->sessions[idx_map];
 }
 
+/* Copy samples out of the circular buffer, starting at the given
+ * index.
+ */
+static void ring_copy(powerbuf_t pb, unsigned int idx, unsigned int count,
+		      unsigned int *current_ua, address_t *mab)
+{
+	unsigned int done = 0;
+
+	while (done < count) {
+		unsigned int cont_len = pb->max_samples - idx;
+
+		if (cont_len > count - done)
+			cont_len = count - done;
+
+		memcpy(current_ua + done, pb->current_ua + idx,
+		       sizeof(pb->current_ua[0]) * cont_len);
+		memcpy(mab + done, pb->mab + idx,
+		       sizeof(pb->mab[0]) * cont_len);
+
+		idx = (idx + cont_len) % pb->max_samples;
+		done += cont_len;
+	}
+}
+
+static unsigned int ring_get_samples(powerbuf_t pb, unsigned int rev_idx,
+				     unsigned int offset, unsigned int count,
+				     unsigned int *current_ua, address_t *mab)
+{
+	const unsigned int idx_map = rev_index(pb, rev_idx);
+	const unsigned int length = session_length(pb, idx_map);
+
+	if (offset >= length)
+		return 0;
+
+	if (count > length - offset)
+		count = length - offset;
+
+	ring_copy(pb, (pb->sessions[idx_map].start_index + offset) %
+		  pb->max_samples, count, current_ua, mab);
+	return count;
+}
+
+/* Position in the sample stream of the first sample in a session */
+static unsigned long long session_start_pos(powerbuf_t pb,
+					    unsigned int rev_idx)
+{
+	const struct powerbuf_session *s = &pb->sessions[rev_index(pb, rev_idx)];
+
+	if (pb->spill)
+		return spill_session_start(pb->spill, rev_idx);
+
+	return pb->tail_pos + (s->start_index + pb->max_samples -
+			       pb->current_tail) % pb->max_samples;
+}
+
+/* Fetch samples by position in the sample stream */
+static unsigned int read_pos(powerbuf_t pb, unsigned long long pos,
+			     unsigned int count,
+			     unsigned int *current_ua, address_t *mab)
+{
+	if (pb->spill)
+		return spill_read(pb->spill, pos, count, current_ua, mab);
+
+	ring_copy(pb, (pb->current_tail + (pos - pb->tail_pos)) %
+		  pb->max_samples, count, current_ua, mab);
+	return count;
+}
+
+unsigned int powerbuf_get_samples(powerbuf_t pb, unsigned int rev_idx,
+				  unsigned int offset, unsigned int count,
+				  unsigned int *current_ua, address_t *mab)
+{
+	if (rev_idx >= powerbuf_num_sessions(pb))
+		return 0;
+
+	if (pb->spill)
+		return spill_get_samples(pb, rev_idx, offset, count,
+					 current_ua, mab);
+
+	return ring_get_samples(pb, rev_idx, offset, count,
+				current_ua, mab);
+}
+
 static void ensure_room(powerbuf_t pb, unsigned int required)
 {
 	unsigned int room =
@@ -183,7 +407,7 @@ static void ensure_room(powerbuf_t pb, unsigned int required)
 	/* Drop old sessions if they're smaller than what we need to
 	 * reclaim.
 	 */
-	while (room < required && powerbuf_num_sessions(pb) > 1) {
+	while (room < required && ring_num_sessions(pb) > 1) {
 		const unsigned int len = session_length(pb, pb->session_tail);
 
 		if (room + len > required)
@@ -209,6 +433,9 @@ static void ensure_room(powerbuf_t pb, unsigned int required)
 		if (cont_len + room > required)
 			cont_len = required - room;
 
+		if (!pb->spill)
+			mab_remove(pb, old->start_index, cont_len);
+
 		/* Un-integrate current */
 		for (i = 0; i < cont_len; i++)
 			old->total_ua -=
@@ -219,6 +446,7 @@ static void ensure_room(powerbuf_t pb, unsigned int required)
 			pb->max_samples;
 		pb->current_tail = (pb->current_tail + cont_len) %
 			pb->max_samples;
+		pb->tail_pos += cont_len;
 
 		room += cont_len;
 	}
@@ -235,11 +463,22 @@ void powerbuf_add_samples(powerbuf_t pb, unsigned int count,
 	if (pb->session_head == pb->session_tail)
 		return;
 
+	if (pb->stream)
+		stream_add_samples(pb, count, current_ua, mab);
+
+	/* While there's a capture file, every sample is kept */
+	if (pb->spill)
+		spill_add_samples(pb, count, current_ua, mab);
+	if (pb->spill) {
+		mab_add(pb, count, current_ua, mab);
+		pyr_add(pb, count, current_ua);
+	}
+
 	/* Make sure that we can't overflow the buffer in a single
 	 * chunk.
 	 */
 	if (count > pb->max_samples - 1) {
-		int extra = pb->max_samples - 1 - count;
+		int extra = count - (pb->max_samples - 1);
 
 		current_ua += extra;
 		mab += extra;
@@ -249,6 +488,12 @@ void powerbuf_add_samples(powerbuf_t pb, unsigned int count,
 	/* Push old samples/sessions out of the buffer if we need to. */
 	ensure_room(pb, count);
 
+	if (!pb->spill) {
+		pyr_trim(pb);
+		mab_add(pb, count, current_ua, mab);
+		pyr_add(pb, count, current_ua);
+	}
+
 	/* Add current integral to the session's running count */
 	for (i = 0; i < count; i++)
 		cur->total_ua += current_ua[i];
@@ -274,8 +519,6 @@ void powerbuf_add_samples(powerbuf_t pb, unsigned int count,
 		mab += cont_len;
 		count -= cont_len;
 	}
-
-	pb->sort_valid = 0;
 }
 
 address_t powerbuf_last_mab(powerbuf_t pb)
@@ -290,144 +533,1305 @@ address_t powerbuf_last_mab(powerbuf_t pb)
 	return pb->mab[last];
 }
 
-static void sift_down(powerbuf_t pb, int start, int end)
+/************************************************************************
+ * Charge by MAB
+ */
+
+#define MAB_HASH_INIT		1024
+
+struct powerbuf_mab_entry {
+	struct powerbuf_mab	m;
+	int			used;
+};
+
+static inline unsigned int mab_hash(address_t mab)
 {
-	int root = start;
+	return mab * 2654435761u;
+}
 
-	while (root * 2 + 1 <= end) {
-		int left_child = root * 2 + 1;
-		int biggest = root;
-		unsigned int temp;
+static int mab_init(powerbuf_t pb)
+{
+	pb->by_mab = calloc(MAB_HASH_INIT, sizeof(pb->by_mab[0]));
+	if (!pb->by_mab)
+		return -1;
+
+	pb->by_mab_size = MAB_HASH_INIT;
+	pb->by_mab_count = 0;
+	pb->by_mab_lost = 0;
+	return 0;
+}
 
-		/* Find the largest of
-		 *   (root, left child, right child)
-		 */
-		if (pb->mab[pb->sorted[biggest]] <
-		    pb->mab[pb->sorted[left_child]])
-			biggest = left_child;
-		if (left_child + 1 <= end &&
-		    (pb->mab[pb->sorted[biggest]] <
-		     pb->mab[pb->sorted[left_child + 1]]))
-			biggest = left_child + 1;
-
-		/* If no changes are needed, the heap property is ok and
-		 * we can stop.
-		 */
-		if (biggest == root)
+static void mab_clear(powerbuf_t pb)
+{
+	memset(pb->by_mab, 0, pb->by_mab_size * sizeof(pb->by_mab[0]));
+	pb->by_mab_count = 0;
+	pb->by_mab_lost = 0;
+}
+
+/* Find the entry for the given MAB, or the empty slot where it
+ * belongs.
+ */
+static struct powerbuf_mab_entry *mab_find(powerbuf_t pb, address_t mab)
+{
+	const unsigned int mask = pb->by_mab_size - 1;
+	unsigned int i = mab_hash(mab) & mask;
+
+	while (pb->by_mab[i].used && pb->by_mab[i].m.mab != mab)
+		i = (i + 1) & mask;
+
+	return &pb->by_mab[i];
+}
+
+/* Double the size of the table, discarding entries with no samples. */
+static int mab_grow(powerbuf_t pb)
+{
+	struct powerbuf_mab_entry *old = pb->by_mab;
+	const unsigned int old_size = pb->by_mab_size;
+	unsigned int i;
+
+	pb->by_mab = calloc(old_size * 2, sizeof(pb->by_mab[0]));
+	if (!pb->by_mab) {
+		pb->by_mab = old;
+		return -1;
+	}
+
+	pb->by_mab_size = old_size * 2;
+	pb->by_mab_count = 0;
+
+	for (i = 0; i < old_size; i++)
+		if (old[i].used && old[i].m.samples) {
+			*mab_find(pb, old[i].m.mab) = old[i];
+			pb->by_mab_count++;
+		}
+
+	free(old);
+	return 0;
+}
+
+static void mab_add(powerbuf_t pb, unsigned int count,
+		    const unsigned int *current_ua, const address_t *mab)
+{
+	struct powerbuf_mab_entry *e = NULL;
+	unsigned int i;
+
+	if (pb->by_mab_lost)
+		return;
+
+	for (i = 0; i < count; i++) {
+		/* Consecutive samples usually share a MAB */
+		if (!e || e->m.mab != mab[i]) {
+			e = mab_find(pb, mab[i]);
+
+			if (!e->used) {
+				if ((pb->by_mab_count + 1) * 2 >
+				    pb->by_mab_size) {
+					if (mab_grow(pb) < 0) {
+						printc_err("powerbuf: can't "
+						   "allocate memory for "
+						   "MAB index\n");
+						pb->by_mab_lost = 1;
+						return;
+					}
+
+					e = mab_find(pb, mab[i]);
+				}
+
+				e->used = 1;
+				e->m.mab = mab[i];
+				pb->by_mab_count++;
+			}
+		}
+
+		e->m.samples++;
+		e->m.sum_ua += current_ua[i];
+	}
+}
+
+/* Remove samples from the circular buffer, starting at the given
+ * index.
+ */
+static void mab_remove(powerbuf_t pb, unsigned int idx, unsigned int count)
+{
+	struct powerbuf_mab_entry *e = NULL;
+
+	if (pb->by_mab_lost)
+		return;
+
+	while (count--) {
+		const address_t mab = pb->mab[idx];
+
+		if (!e || e->m.mab != mab)
+			e = mab_find(pb, mab);
+
+		e->m.samples--;
+		e->m.sum_ua -= pb->current_ua[idx];
+		idx = (idx + 1) % pb->max_samples;
+	}
+}
+
+
+int powerbuf_get_by_mab(powerbuf_t pb, address_t mab,
+			unsigned long long *sum_ua)
+{
+	const struct powerbuf_mab_entry *e;
+
+	if (pb->by_mab_lost)
+		return 0;
+
+	e = mab_find(pb, mab);
+	if (!e->used)
+		return 0;
+
+	*sum_ua = e->m.sum_ua;
+	return e->m.samples;
+}
+
+static int cmp_mab(const void *a, const void *b)
+{
+	const struct powerbuf_mab *x = (const struct powerbuf_mab *)a;
+	const struct powerbuf_mab *y = (const struct powerbuf_mab *)b;
+
+	if (x->mab < y->mab)
+		return -1;
+	if (x->mab > y->mab)
+		return 1;
+
+	return 0;
+}
+
+int powerbuf_enum_by_mab(powerbuf_t pb, powerbuf_mab_func_t func,
+			 void *user_data)
+{
+	struct powerbuf_mab *list;
+	unsigned int count = 0;
+	unsigned int i;
+	int ret = 0;
+
+	if (pb->by_mab_lost) {
+		printc_err("powerbuf: MAB index is unavailable\n");
+		return -1;
+	}
+
+	list = malloc(sizeof(list[0]) * (pb->by_mab_count + 1));
+	if (!list) {
+		pr_error("powerbuf: can't allocate memory");
+		return -1;
+	}
+
+	for (i = 0; i < pb->by_mab_size; i++)
+		if (pb->by_mab[i].used && pb->by_mab[i].m.samples)
+			list[count++] = pb->by_mab[i].m;
+
+	qsort(list, count, sizeof(list[0]), cmp_mab);
+
+	for (i = 0; i < count; i++)
+		if (func(user_data, &list[i]) < 0) {
+			ret = -1;
 			break;
+		}
+
+	free(list);
+	return ret;
+}
+
+/************************************************************************
+ * Range summaries
+ *
+ * The sample stream is summarized at power-of-two granularities, from
+ * 2^PYR_MIN_SHIFT samples upward. Each level is a list of buckets
+ * holding the minimum, maximum and sum of the samples they cover. When
+ * a bucket fills up, it's merged into the level above.
+ *
+ * A range is summarized by taking the largest whole buckets that fit
+ * inside it, and reading the few samples at the ragged ends.
+ */
+
+#define PYR_MIN_SHIFT		8
+#define PYR_MAX_LEVELS		40
+
+struct pyr_bucket {
+	unsigned int		min_ua;
+	unsigned int		max_ua;
+	unsigned long long	sum_ua;
+};
+
+struct pyr_level {
+	/* Bucket number of the first bucket held */
+	unsigned long long	first;
+	struct vector		buckets;
+};
+
+struct powerbuf_pyramid {
+	/* Position of the next sample to be added */
+	unsigned long long	next_pos;
+
+	int			num_levels;
+	struct pyr_level	levels[PYR_MAX_LEVELS];
+
+	/* Set if memory couldn't be allocated. */
+	int			lost;
+};
+
+static int pyr_init(powerbuf_t pb)
+{
+	struct powerbuf_pyramid *p = malloc(sizeof(*p));
+	int i;
+
+	if (!p)
+		return -1;
+
+	memset(p, 0, sizeof(*p));
+	for (i = 0; i < PYR_MAX_LEVELS; i++)
+		vector_init(&p->levels[i].buckets, sizeof(struct pyr_bucket));
+
+	pb->pyramid = p;
+	return 0;
+}
+
+static void pyr_free(powerbuf_t pb)
+{
+	struct powerbuf_pyramid *p = pb->pyramid;
+	int i;
+
+	for (i = 0; i < PYR_MAX_LEVELS; i++)
+		vector_destroy(&p->levels[i].buckets);
+
+	free(p);
+}
+
+static void pyr_reset(powerbuf_t pb, unsigned long long pos)
+{
+	struct powerbuf_pyramid *p = pb->pyramid;
+	int i;
+
+	for (i = 0; i < p->num_levels; i++)
+		p->levels[i].buckets.size = 0;
+
+	p->next_pos = pos;
+	p->num_levels = 0;
+	p->lost = 0;
+}
+
+static void merge_bucket(struct pyr_bucket *dst, const struct pyr_bucket *b)
+{
+	if (b->min_ua < dst->min_ua)
+		dst->min_ua = b->min_ua;
+	if (b->max_ua > dst->max_ua)
+		dst->max_ua = b->max_ua;
+
+	dst->sum_ua += b->sum_ua;
+}
+
+/* Add to the given bucket of a level, starting a new bucket if
+ * necessary.
+ */
+static int pyr_put(struct powerbuf_pyramid *p, int level,
+		   unsigned long long n, const struct pyr_bucket *b)
+{
+	struct pyr_level *l = &p->levels[level];
+
+	if (level >= p->num_levels) {
+		p->num_levels = level + 1;
+		l->first = n;
+	}
+
+	if (l->first + l->buckets.size == n)
+		return vector_push(&l->buckets, b, 1);
 
-		/* Swap the root with its largest child */
-		temp = pb->sorted[biggest];
-		pb->sorted[biggest] = pb->sorted[root];
-		pb->sorted[root] = temp;
+	merge_bucket(VECTOR_PTR(l->buckets, l->buckets.size - 1,
+				struct pyr_bucket), b);
+	return 0;
+}
+
+static void pyr_add(powerbuf_t pb, unsigned int count,
+		    const unsigned int *current_ua)
+{
+	struct powerbuf_pyramid *p = pb->pyramid;
+	unsigned int i;
+
+	if (p->lost)
+		return;
+
+	for (i = 0; i < count; i++) {
+		unsigned long long n = p->next_pos >> PYR_MIN_SHIFT;
+		struct pyr_bucket b;
+		int level = 0;
+
+		b.min_ua = b.max_ua = current_ua[i];
+		b.sum_ua = current_ua[i];
 
-		/* Continue to push down the old root (now a child) */
-		root = biggest;
+		if (pyr_put(p, 0, n, &b) < 0)
+			goto fail;
+
+		p->next_pos++;
+
+		/* Pass on buckets which have just been completed */
+		while (!(p->next_pos & ((1ULL << (level + PYR_MIN_SHIFT)) - 1)) &&
+		       level + 1 < PYR_MAX_LEVELS) {
+			const struct pyr_level *l = &p->levels[level];
+
+			b = *VECTOR_PTR(l->buckets, l->buckets.size - 1,
+					struct pyr_bucket);
+			if (pyr_put(p, level + 1, n >> 1, &b) < 0)
+				goto fail;
+
+			if (!(n & 1))
+				break;
+
+			n >>= 1;
+			level++;
+		}
 	}
+
+	return;
+
+fail:
+	printc_err("powerbuf: can't allocate memory for range summaries\n");
+	p->lost = 1;
 }
 
-static void heapify(powerbuf_t pb, int num_samples)
+/* Discard buckets for samples which have dropped out of the circular
+ * buffer, once they make up at least half of a level.
+ */
+static void pyr_trim(powerbuf_t pb)
 {
-	int start = (num_samples - 2) / 2;
+	struct powerbuf_pyramid *p = pb->pyramid;
+	int i;
+
+	for (i = 0; i < p->num_levels; i++) {
+		struct pyr_level *l = &p->levels[i];
+		const unsigned long long n =
+			pb->tail_pos >> (i + PYR_MIN_SHIFT);
+		unsigned int drop;
+
+		if (n <= l->first || (n - l->first) * 2 < l->buckets.size)
+			continue;
 
-	while (start >= 0) {
-		sift_down(pb, start, num_samples - 1);
-		start--;
+		drop = n - l->first;
+		if (drop > l->buckets.size)
+			drop = l->buckets.size;
+
+		memmove(l->buckets.ptr,
+			VECTOR_PTR(l->buckets, drop, struct pyr_bucket),
+			(l->buckets.size - drop) * sizeof(struct pyr_bucket));
+		l->buckets.size -= drop;
+		l->first += drop;
 	}
 }
 
-static void heap_extract(powerbuf_t pb, int num_samples)
+/* Recalculate the MAB table and range summaries, from the circular
+ * buffer, after the capture file is opened or closed.
+ */
+static void rebuild_indexes(powerbuf_t pb)
 {
-	int end = num_samples - 1;
+	unsigned int idx = pb->current_tail;
 
-	while (end > 0) {
-		unsigned int temp;
+	mab_clear(pb);
+	pyr_reset(pb, pb->spill ? 0 : pb->tail_pos);
 
-		/* Swap the top of the heap with the end of the array,
-		 * and shrink the heap.
-		 */
-		temp = pb->sorted[0];
-		pb->sorted[0] = pb->sorted[end];
-		pb->sorted[end] = temp;
-		end--;
+	while (idx != pb->current_head) {
+		unsigned int len = (idx < pb->current_head ?
+			pb->current_head : pb->max_samples) - idx;
 
-		/* Fix up the heap (push down the new root) */
-		sift_down(pb, 0, end);
+		mab_add(pb, len, pb->current_ua + idx, pb->mab + idx);
+		pyr_add(pb, len, pb->current_ua + idx);
+		idx = (idx + len) % pb->max_samples;
 	}
 }
 
-void powerbuf_sort(powerbuf_t pb)
+/* Find the whole bucket starting at pos and ending at or before end,
+ * for the highest possible level. Returns NULL if there is none.
+ */
+static const struct pyr_bucket *pyr_find(const struct powerbuf_pyramid *p,
+					 unsigned long long pos,
+					 unsigned long long end, int *shift)
 {
-	const unsigned int num_samples =
-		(pb->current_head + pb->max_samples - pb->current_tail) %
-			pb->max_samples;
+	int i;
+
+	for (i = p->num_levels - 1; i >= 0; i--) {
+		const struct pyr_level *l = &p->levels[i];
+		const int sh = i + PYR_MIN_SHIFT;
+		const unsigned long long n = pos >> sh;
+
+		if ((pos & ((1ULL << sh) - 1)) || pos + (1ULL << sh) > end ||
+		    n < l->first || n >= l->first + l->buckets.size)
+			continue;
+
+		*shift = sh;
+		return VECTOR_PTR(l->buckets, n - l->first, struct pyr_bucket);
+	}
+
+	return NULL;
+}
+
+int powerbuf_get_stats(powerbuf_t pb, unsigned int rev_idx,
+		       unsigned int offset, unsigned int count,
+		       struct powerbuf_stats *st)
+{
+	const struct powerbuf_pyramid *p = pb->pyramid;
+	unsigned int length;
+	unsigned long long pos;
+	unsigned long long end;
+	struct pyr_bucket total;
+
+	memset(st, 0, sizeof(*st));
+
+	if (rev_idx >= powerbuf_num_sessions(pb))
+		return -1;
+
+	if (p->lost) {
+		printc_err("powerbuf: range summaries are unavailable\n");
+		return -1;
+	}
+
+	powerbuf_session_info(pb, rev_idx, &length);
+	if (offset >= length)
+		return 0;
+
+	if (count > length - offset)
+		count = length - offset;
+
+	pos = session_start_pos(pb, rev_idx) + offset;
+	end = pos + count;
+
+	total.min_ua = ~0;
+	total.max_ua = 0;
+	total.sum_ua = 0;
+
+	while (pos < end) {
+		int shift;
+		const struct pyr_bucket *b = pyr_find(p, pos, end, &shift);
+		unsigned int ua[1 << PYR_MIN_SHIFT];
+		address_t mab[1 << PYR_MIN_SHIFT];
+		unsigned int n;
+		unsigned int i;
+
+		if (b) {
+			merge_bucket(&total, b);
+			pos += 1ULL << shift;
+			continue;
+		}
+
+		/* Read up to the next bucket boundary */
+		n = ARRAY_LEN(ua) - (pos & (ARRAY_LEN(ua) - 1));
+		if (n > end - pos)
+			n = end - pos;
+
+		n = read_pos(pb, pos, n, ua, mab);
+		if (!n)
+			return -1;
+
+		for (i = 0; i < n; i++) {
+			struct pyr_bucket s;
+
+			s.min_ua = s.max_ua = ua[i];
+			s.sum_ua = ua[i];
+			merge_bucket(&total, &s);
+		}
+
+		pos += n;
+	}
+
+	st->samples = count;
+	st->min_ua = total.min_ua;
+	st->max_ua = total.max_ua;
+	st->sum_ua = total.sum_ua;
+	return 0;
+}
+
+/************************************************************************
+ * Capture file
+ */
+
+static int write_at(int fd, unsigned long long offset,
+		    const void *data, size_t len)
+{
+	const char *ptr = (const char *)data;
+
+	if (lseek(fd, offset, SEEK_SET) == (off_t)-1)
+		return -1;
+
+	while (len) {
+		ssize_t r = write(fd, ptr, len);
+
+		if (r <= 0)
+			return -1;
+
+		ptr += r;
+		len -= r;
+	}
+
+	return 0;
+}
+
+static int read_at(int fd, unsigned long long offset, void *data, size_t len)
+{
+	char *ptr = (char *)data;
+
+	if (lseek(fd, offset, SEEK_SET) == (off_t)-1)
+		return -1;
+
+	while (len) {
+		ssize_t r = read(fd, ptr, len);
+
+		if (r <= 0)
+			return -1;
+
+		ptr += r;
+		len -= r;
+	}
+
+	return 0;
+}
+
+static int write_header(powerbuf_t pb, uint64_t index_offset)
+{
+	const struct powerbuf_spill *s = pb->spill;
+	struct spill_header h;
+
+	memset(&h, 0, sizeof(h));
+	h.magic = POWERBUF_SPILL_MAGIC;
+	h.version = 1;
+	h.interval_us = pb->interval_us;
+	h.chunk_samples = POWERBUF_SPILL_CHUNK;
+	h.num_samples = s->num_samples;
+	h.index_offset = index_offset;
+	h.num_sessions = s->sessions.size;
+
+	return write_at(s->fd, 0, &h, sizeof(h));
+}
+
+static void release_view(struct powerbuf_spill *s)
+{
+#ifndef __Windows__
+	if (s->view_mapped)
+		munmap(s->view, SPILL_CHUNK_BYTES);
+	else
+#endif
+		free(s->view);
+
+	s->view = NULL;
+	s->view_mapped = 0;
+	s->view_chunk = SPILL_NO_CHUNK;
+}
+
+static void spill_free(struct powerbuf_spill *s)
+{
+	release_view(s);
+
+	if (s->fd >= 0)
+		close(s->fd);
+
+	vector_destroy(&s->sessions);
+	free(s->pending);
+	free(s->path);
+	free(s);
+}
+
+/* Give up on the capture file after a write error. The session list
+ * reverts to what's in the circular buffers.
+ */
+static void spill_fail(powerbuf_t pb)
+{
+	pr_error("powerbuf: can't write capture file");
+	printc_err("powerbuf: no longer capturing to %s\n", pb->spill->path);
+
+	spill_free(pb->spill);
+	pb->spill = NULL;
+	rebuild_indexes(pb);
+}
+
+static void spill_clear(struct powerbuf_spill *s)
+{
+	s->sessions.size = 0;
+	s->num_samples = 0;
+	release_view(s);
+}
+
+static struct spill_session *last_session(struct powerbuf_spill *s)
+{
+	if (!s->sessions.size)
+		return NULL;
+
+	return VECTOR_PTR(s->sessions, s->sessions.size - 1,
+			  struct spill_session);
+}
+
+static void spill_end_session(struct powerbuf_spill *s)
+{
+	const struct spill_session *last = last_session(s);
+
+	if (last && last->start == s->num_samples)
+		vector_pop(&s->sessions);
+}
+
+static void spill_begin_session(powerbuf_t pb, time_t when)
+{
+	struct powerbuf_spill *s = pb->spill;
+	struct spill_session ss;
+
+	spill_end_session(s);
+
+	memset(&ss, 0, sizeof(ss));
+	ss.info.wall_clock = when;
+	ss.start = s->num_samples;
+
+	if (vector_push(&s->sessions, &ss, 1) < 0) {
+		printc_err("powerbuf: can't allocate memory for session\n");
+		printc_err("powerbuf: no longer capturing to %s\n", s->path);
+		spill_free(s);
+		pb->spill = NULL;
+		rebuild_indexes(pb);
+	}
+}
+
+static const struct powerbuf_session *spill_session_info
+	(struct powerbuf_spill *s, unsigned int rev_idx, unsigned int *length)
+{
+	const unsigned int idx = s->sessions.size - 1 - rev_idx;
+	const struct spill_session *ss =
+		VECTOR_PTR(s->sessions, idx, struct spill_session);
+
+	if (length) {
+		unsigned long long end = s->num_samples;
+
+		if (idx + 1 < s->sessions.size)
+			end = VECTOR_PTR(s->sessions, idx + 1,
+					 struct spill_session)->start;
+
+		*length = end - ss->start;
+	}
+
+	return &ss->info;
+}
+
+static void spill_add_samples(powerbuf_t pb, unsigned int count,
+			      const unsigned int *current_ua,
+			      const address_t *mab)
+{
+	struct powerbuf_spill *s = pb->spill;
+	struct spill_session *cur = last_session(s);
 	unsigned int i;
 
-	if (pb->sort_valid)
+	if (!cur)
 		return;
 
-	/* Prepare an index list */
-	for (i = 0; i < num_samples; i++)
-		pb->sorted[i] = (pb->current_tail + i) % pb->max_samples;
+	for (i = 0; i < count; i++)
+		cur->info.total_ua += current_ua[i];
+
+	while (count) {
+		const unsigned int fill = s->num_samples % POWERBUF_SPILL_CHUNK;
+		unsigned int len = POWERBUF_SPILL_CHUNK - fill;
+
+		if (len > count)
+			len = count;
+
+		memcpy(s->pending + fill, current_ua, sizeof(uint32_t) * len);
+		memcpy(s->pending + POWERBUF_SPILL_CHUNK + fill, mab,
+		       sizeof(uint32_t) * len);
+		s->num_samples += len;
+
+		if (fill + len == POWERBUF_SPILL_CHUNK) {
+			const unsigned long long chunk =
+				s->num_samples / POWERBUF_SPILL_CHUNK - 1;
+
+			if (write_at(s->fd, POWERBUF_SPILL_DATA_OFFSET +
+				     chunk * SPILL_CHUNK_BYTES,
+				     s->pending, SPILL_CHUNK_BYTES) < 0) {
+				spill_fail(pb);
+				return;
+			}
+		}
+
+		current_ua += len;
+		mab += len;
+		count -= len;
+	}
+}
+
+/* Find the samples for the given chunk, which may be the pending
+ * chunk, or one which must be read back from the file.
+ */
+static const uint32_t *spill_chunk(struct powerbuf_spill *s,
+				   unsigned long long chunk)
+{
+	const unsigned long long offset =
+		POWERBUF_SPILL_DATA_OFFSET + chunk * SPILL_CHUNK_BYTES;
+
+	if (chunk == s->num_samples / POWERBUF_SPILL_CHUNK)
+		return s->pending;
+
+	if (s->view && s->view_chunk == chunk)
+		return s->view;
+
+#ifndef __Windows__
+	release_view(s);
+	s->view = mmap(NULL, SPILL_CHUNK_BYTES, PROT_READ, MAP_SHARED,
+		       s->fd, offset);
+	if (s->view != MAP_FAILED) {
+		s->view_mapped = 1;
+		s->view_chunk = chunk;
+		return s->view;
+	}
+
+	s->view = NULL;
+#endif
+
+	/* Fall back to reading the chunk */
+	if (!s->view) {
+		s->view = malloc(SPILL_CHUNK_BYTES);
+		if (!s->view) {
+			pr_error("powerbuf: can't allocate memory");
+			return NULL;
+		}
+	}
+
+	if (read_at(s->fd, offset, s->view, SPILL_CHUNK_BYTES) < 0) {
+		pr_error("powerbuf: can't read capture file");
+		release_view(s);
+		return NULL;
+	}
+
+	s->view_chunk = chunk;
+	return s->view;
+}
+
+static unsigned int spill_read(struct powerbuf_spill *s,
+			       unsigned long long pos, unsigned int count,
+			       unsigned int *current_ua, address_t *mab)
+{
+	unsigned int done = 0;
+
+	while (done < count) {
+		const unsigned int within = pos % POWERBUF_SPILL_CHUNK;
+		const uint32_t *chunk =
+			spill_chunk(s, pos / POWERBUF_SPILL_CHUNK);
+		unsigned int len = POWERBUF_SPILL_CHUNK - within;
+
+		if (!chunk)
+			break;
+
+		if (len > count - done)
+			len = count - done;
+
+		memcpy(current_ua + done, chunk + within,
+		       sizeof(uint32_t) * len);
+		memcpy(mab + done, chunk + POWERBUF_SPILL_CHUNK + within,
+		       sizeof(uint32_t) * len);
+
+		pos += len;
+		done += len;
+	}
+
+	return done;
+}
+
+static unsigned long long spill_session_start(struct powerbuf_spill *s,
+					      unsigned int rev_idx)
+{
+	return VECTOR_PTR(s->sessions, s->sessions.size - 1 - rev_idx,
+			  struct spill_session)->start;
+}
+
+static unsigned int spill_get_samples(powerbuf_t pb, unsigned int rev_idx,
+				      unsigned int offset, unsigned int count,
+				      unsigned int *current_ua,
+				      address_t *mab)
+{
+	struct powerbuf_spill *s = pb->spill;
+	unsigned int length;
+
+	spill_session_info(s, rev_idx, &length);
+	if (offset >= length)
+		return 0;
+
+	if (count > length - offset)
+		count = length - offset;
+
+	return spill_read(s, spill_session_start(s, rev_idx) + offset,
+			  count, current_ua, mab);
+}
+
+int powerbuf_spill_open(powerbuf_t pb, const char *path)
+{
+	struct powerbuf_spill *s;
+	unsigned int i;
+
+	powerbuf_spill_close(pb);
+
+	s = malloc(sizeof(*s));
+	if (!s) {
+		pr_error("powerbuf: can't allocate memory");
+		return -1;
+	}
+
+	memset(s, 0, sizeof(*s));
+	vector_init(&s->sessions, sizeof(struct spill_session));
+	s->view_chunk = SPILL_NO_CHUNK;
+
+	s->path = strdup(path);
+	s->pending = malloc(SPILL_CHUNK_BYTES);
+	if (!(s->path && s->pending)) {
+		pr_error("powerbuf: can't allocate memory");
+		s->fd = -1;
+		spill_free(s);
+		return -1;
+	}
+
+	s->fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0644);
+	if (s->fd < 0) {
+		printc_err("powerbuf: can't open %s: %s\n",
+			   path, last_error());
+		spill_free(s);
+		return -1;
+	}
+
+	pb->spill = s;
+	if (write_header(pb, 0) < 0) {
+		spill_fail(pb);
+		return -1;
+	}
+
+	/* Copy what we already have, oldest session first */
+	for (i = ring_num_sessions(pb); i > 0 && pb->spill; i--) {
+		const struct powerbuf_session *rs =
+			&pb->sessions[rev_index(pb, i - 1)];
+		unsigned int cur[1024];
+		address_t mab[1024];
+		unsigned int offset = 0;
+		unsigned int n;
+
+		spill_begin_session(pb, rs->wall_clock);
+
+		while (pb->spill &&
+		       (n = ring_get_samples(pb, i - 1, offset,
+					     ARRAY_LEN(cur), cur, mab)) > 0) {
+			spill_add_samples(pb, n, cur, mab);
+			offset += n;
+		}
+	}
+
+	if (!pb->spill)
+		return -1;
+
+	rebuild_indexes(pb);
+	return 0;
+}
+
+void powerbuf_spill_close(powerbuf_t pb)
+{
+	struct powerbuf_spill *s = pb->spill;
+	const unsigned long long chunks =
+		s ? (s->num_samples + POWERBUF_SPILL_CHUNK - 1) /
+			POWERBUF_SPILL_CHUNK : 0;
+	unsigned long long index_offset;
+	int i;
 
-	if (num_samples < 2) {
-		pb->sort_valid = 1;
+	if (!s)
 		return;
+
+	/* Write out the last chunk, padded to a full chunk */
+	if (s->num_samples % POWERBUF_SPILL_CHUNK) {
+		const unsigned int fill = s->num_samples % POWERBUF_SPILL_CHUNK;
+		const unsigned int pad = POWERBUF_SPILL_CHUNK - fill;
+
+		memset(s->pending + fill, 0, sizeof(uint32_t) * pad);
+		memset(s->pending + POWERBUF_SPILL_CHUNK + fill, 0,
+		       sizeof(uint32_t) * pad);
+
+		if (write_at(s->fd, POWERBUF_SPILL_DATA_OFFSET +
+			     (chunks - 1) * SPILL_CHUNK_BYTES,
+			     s->pending, SPILL_CHUNK_BYTES) < 0)
+			goto fail;
 	}
 
-	heapify(pb, num_samples);
-	heap_extract(pb, num_samples);
-	pb->sort_valid = 1;
+	index_offset = POWERBUF_SPILL_DATA_OFFSET + chunks * SPILL_CHUNK_BYTES;
+
+	for (i = 0; i < s->sessions.size; i++) {
+		const struct spill_session *ss =
+			VECTOR_PTR(s->sessions, i, struct spill_session);
+		struct spill_index rec;
+
+		rec.wall_clock = ss->info.wall_clock;
+		rec.start = ss->start;
+		rec.total_ua = ss->info.total_ua;
+
+		if (write_at(s->fd, index_offset + i * sizeof(rec),
+			     &rec, sizeof(rec)) < 0)
+			goto fail;
+	}
+
+	if (write_header(pb, index_offset) < 0)
+		goto fail;
+
+	spill_free(s);
+	pb->spill = NULL;
+	rebuild_indexes(pb);
+	return;
+
+fail:
+	spill_fail(pb);
 }
 
-/* Find the index within the sorted index of the first sample with an
- * MAB >= the given mab parameter.
+const char *powerbuf_spill_path(powerbuf_t pb)
+{
+	return pb->spill ? pb->spill->path : NULL;
+}
+
+/************************************************************************
+ * Live streaming
  */
-static int find_mab_ge(powerbuf_t pb, address_t mab)
+
+/* Maximum amount of data waiting to be sent */
+#define STREAM_MAX_PENDING	(1024 * 1024)
+
+/* How long to wait for the reader when the stream is closed */
+#define STREAM_CLOSE_TIMEOUT_MS	1000
+
+struct powerbuf_stream {
+	int			fd;
+	int			is_socket;
+	char			*path;
+
+	/* Data not yet accepted by the reader. The first "sent" bytes
+	 * have already gone.
+	 */
+	struct vector		pending;
+	unsigned int		sent;
+
+	int			in_session;
+	unsigned long long	dropped;
+};
+
+void powerbuf_export_header(powerbuf_t pb, time_t when,
+			    struct powerbuf_export_header *h)
 {
-	const int num_samples =
-		(pb->current_head + pb->max_samples - pb->current_tail) %
-			pb->max_samples;
-	int low = 0;
-	int high = num_samples - 1;
+	h->magic = POWERBUF_EXPORT_MAGIC;
+	h->version = 1;
+	h->interval_us = pb->interval_us;
+	h->reserved = 0;
+	h->wall_clock = when;
+}
+
+static void stream_free(struct powerbuf_stream *s)
+{
+	if (s->fd >= 0)
+		close(s->fd);
+
+	vector_destroy(&s->pending);
+	free(s->path);
+	free(s);
+}
+
+static int stream_queue(struct powerbuf_stream *s, const void *data,
+			unsigned int len)
+{
+	return vector_push(&s->pending, data, len);
+}
+
+/* A reader going away should end the stream, not the program, but
+ * SIGPIPE mustn't be ignored process-wide: that would be inherited by
+ * shell commands. Sockets can be written without raising it. For a
+ * FIFO, it's blocked around the write, and consumed if raised.
+ */
+static ssize_t stream_write(struct powerbuf_stream *s,
+			    const void *data, size_t len)
+{
+#ifndef __Windows__
+	sigset_t pipe_set;
+	sigset_t old_set;
+	sigset_t pending;
+	int was_pending;
+	int saved_errno;
+	ssize_t r;
+
+	if (s->is_socket)
+		return sockets_send(s->fd, data, len, 0);
+
+	sigemptyset(&pipe_set);
+	sigaddset(&pipe_set, SIGPIPE);
+
+	sigpending(&pending);
+	was_pending = sigismember(&pending, SIGPIPE);
+	pthread_sigmask(SIG_BLOCK, &pipe_set, &old_set);
+
+	r = write(s->fd, data, len);
+	saved_errno = errno;
 
-	while (low <= high) {
-		int mid = (low + high) / 2;
+	if (r < 0 && errno == EPIPE && !was_pending) {
+		int sig;
 
-		if (pb->mab[pb->sorted[mid]] < mab)
-			low = mid + 1;
-		else if ((mid <= 0) || (pb->mab[pb->sorted[mid - 1]] < mab))
-			return mid;
-		else
-			high = mid - 1;
+		sigwait(&pipe_set, &sig);
 	}
 
-	return -1;
+	pthread_sigmask(SIG_SETMASK, &old_set, NULL);
+	errno = saved_errno;
+	return r;
+#else
+	return write(s->fd, data, len);
+#endif
 }
 
-int powerbuf_get_by_mab(powerbuf_t pb, address_t mab,
-			unsigned long long *sum_ua)
+/* Send as much as the reader will take without blocking. */
+static void stream_flush(powerbuf_t pb)
 {
-	const unsigned int num_samples =
-		(pb->current_head + pb->max_samples - pb->current_tail) %
-			pb->max_samples;
-	int i;
-	int count = 0;
+	struct powerbuf_stream *s = pb->stream;
+
+	while (s->sent < s->pending.size) {
+		ssize_t r = stream_write(s,
+				(uint8_t *)s->pending.ptr + s->sent,
+				s->pending.size - s->sent);
+
+		if (r < 0) {
+			if (errno == EINTR)
+				continue;
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				break;
+
+			printc_err("powerbuf: stream to %s closed: %s\n",
+				   s->path, last_error());
+			stream_free(s);
+			pb->stream = NULL;
+			return;
+		}
+
+		s->sent += r;
+	}
 
-	if (!pb->sort_valid)
-		powerbuf_sort(pb);
+	if (s->sent >= s->pending.size) {
+		s->pending.size = 0;
+		s->sent = 0;
+	} else if (s->sent >= s->pending.size / 2) {
+		memmove(s->pending.ptr, (uint8_t *)s->pending.ptr + s->sent,
+			s->pending.size - s->sent);
+		s->pending.size -= s->sent;
+		s->sent = 0;
+	}
+}
+
+static void stream_fail(powerbuf_t pb)
+{
+	printc_err("powerbuf: can't allocate memory for stream\n");
+	stream_free(pb->stream);
+	pb->stream = NULL;
+}
 
-	i = find_mab_ge(pb, mab);
-	if (i < 0)
+static int stream_end_session(struct powerbuf_stream *s)
+{
+	const uint32_t term = 0;
+
+	if (!s->in_session)
 		return 0;
 
-	*sum_ua = 0;
+	s->in_session = 0;
+	return stream_queue(s, &term, sizeof(term));
+}
+
+static void stream_begin_session(powerbuf_t pb, time_t when)
+{
+	struct powerbuf_stream *s = pb->stream;
+	struct powerbuf_export_header h;
+
+	powerbuf_export_header(pb, when, &h);
 
-	while ((i < num_samples) && (pb->mab[pb->sorted[i]] == mab)) {
-		*sum_ua += pb->current_ua[pb->sorted[i]];
-		count++;
-		i++;
+	if (stream_end_session(s) < 0 ||
+	    stream_queue(s, &h, sizeof(h)) < 0) {
+		stream_fail(pb);
+		return;
 	}
 
-	return count;
+	s->in_session = 1;
+	stream_flush(pb);
+}
+
+static void stream_add_samples(powerbuf_t pb, unsigned int count,
+			       const unsigned int *current_ua,
+			       const address_t *mab)
+{
+	struct powerbuf_stream *s = pb->stream;
+
+	if (!s->in_session)
+		return;
+
+	while (count) {
+		const uint32_t n = count > POWERBUF_EXPORT_BLOCK ?
+			POWERBUF_EXPORT_BLOCK : count;
+		const unsigned int len = sizeof(n) + n * 8;
+
+		/* Skip whole blocks if the reader isn't keeping up, so
+		 * that the framing is kept intact.
+		 */
+		if (s->pending.size - s->sent + len > STREAM_MAX_PENDING) {
+			s->dropped += n;
+		} else if (stream_queue(s, &n, sizeof(n)) < 0 ||
+			   stream_queue(s, current_ua, n * 4) < 0 ||
+			   stream_queue(s, mab, n * 4) < 0) {
+			stream_fail(pb);
+			return;
+		}
+
+		current_ua += n;
+		mab += n;
+		count -= n;
+	}
+
+	stream_flush(pb);
+}
+
+#ifndef __Windows__
+static int open_dest(const char *path, int *is_socket)
+{
+	struct stat st;
+	int fd;
+
+	*is_socket = 0;
+
+	if (stat(path, &st) < 0) {
+		printc_err("powerbuf: can't stat %s: %s\n",
+			   path, last_error());
+		return -1;
+	}
+
+	if (S_ISFIFO(st.st_mode)) {
+		/* Fails with ENXIO if there's no reader */
+		fd = open(path, O_WRONLY | O_NONBLOCK);
+		if (fd < 0) {
+			printc_err("powerbuf: can't open %s: %s\n",
+				   path, last_error());
+			return -1;
+		}
+
+		return fd;
+	}
+
+	if (S_ISSOCK(st.st_mode)) {
+		struct sockaddr_un addr;
+
+		if (strlen(path) >= sizeof(addr.sun_path)) {
+			printc_err("powerbuf: socket path too long: %s\n",
+				   path);
+			return -1;
+		}
+
+		memset(&addr, 0, sizeof(addr));
+		addr.sun_family = AF_UNIX;
+		strcpy(addr.sun_path, path);
+
+		fd = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (fd < 0) {
+			pr_error("powerbuf: can't create socket");
+			return -1;
+		}
+
+		if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+		    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) < 0) {
+			printc_err("powerbuf: can't connect to %s: %s\n",
+				   path, last_error());
+			close(fd);
+			return -1;
+		}
+
+		*is_socket = 1;
+		return fd;
+	}
+
+	printc_err("powerbuf: %s is not a FIFO or socket\n", path);
+	return -1;
+}
+#else
+static int open_dest(const char *path, int *is_socket)
+{
+	(void)is_socket;
+
+	printc_err("powerbuf: streaming is not supported on this "
+		   "platform\n");
+	return -1;
+}
+#endif
+
+int powerbuf_stream_open(powerbuf_t pb, const char *path)
+{
+	struct powerbuf_stream *s;
+
+	powerbuf_stream_close(pb);
+
+	s = malloc(sizeof(*s));
+	if (!s) {
+		pr_error("powerbuf: can't allocate memory");
+		return -1;
+	}
+
+	memset(s, 0, sizeof(*s));
+	vector_init(&s->pending, 1);
+
+	s->path = strdup(path);
+	if (!s->path) {
+		pr_error("powerbuf: can't allocate memory");
+		s->fd = -1;
+		stream_free(s);
+		return -1;
+	}
+
+	s->fd = open_dest(path, &s->is_socket);
+	if (s->fd < 0) {
+		stream_free(s);
+		return -1;
+	}
+
+	pb->stream = s;
+
+	/* Samples for a session already in progress go out from now on */
+	if (ring_num_sessions(pb))
+		stream_begin_session(pb,
+			pb->sessions[rev_index(pb, 0)].wall_clock);
+
+	return pb->stream ? 0 : -1;
+}
+
+void powerbuf_stream_close(powerbuf_t pb)
+{
+	struct powerbuf_stream *s = pb->stream;
+
+	if (!s)
+		return;
+
+	if (stream_end_session(s) < 0) {
+		stream_fail(pb);
+		return;
+	}
+
+	/* Give the reader a chance to take the rest */
+	stream_flush(pb);
+	while (pb->stream && pb->stream->sent < pb->stream->pending.size) {
+#ifndef __Windows__
+		struct pollfd pfd;
+
+		pfd.fd = s->fd;
+		pfd.events = POLLOUT;
+
+		if (poll(&pfd, 1, STREAM_CLOSE_TIMEOUT_MS) > 0) {
+			stream_flush(pb);
+			continue;
+		}
+#endif
+		printc_err("powerbuf: stream to %s closed with %d bytes "
+			   "unsent\n", s->path,
+			   s->pending.size - s->sent);
+		break;
+	}
+
+	if (pb->stream) {
+		stream_free(pb->stream);
+		pb->stream = NULL;
+	}
+}
+
+const char *powerbuf_stream_path(powerbuf_t pb)
+{
+	return pb->stream ? pb->stream->path : NULL;
+}
+
+unsigned long long powerbuf_stream_dropped(powerbuf_t pb)
+{
+	return pb->stream ? pb->stream->dropped : 0;
 }
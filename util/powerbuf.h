@@ -36,7 +36,8 @@ struct powerbuf_session {
 	time_t			wall_clock;
 
 	/* Index of first sample in sample buffer corresponding to this
-	 * session.
+	 * session. This is for the power buffer's own use: samples
+	 * should be fetched with powerbuf_get_samples().
 	 */
 	unsigned int		start_index;
 
@@ -47,6 +48,97 @@ struct powerbuf_session {
 #define POWERBUF_MAX_SESSIONS		8
 #define POWERBUF_DEFAULT_SAMPLES	131072
 
+/* Optionally, samples can also be spilled to a capture file, so that
+ * long captures aren't limited by the size of the circular buffers.
+ * While a capture file is open, the session list and sample data are
+ * taken from it, and nothing drops out of the end.
+ *
+ * The file consists of a header, followed by chunks of samples and,
+ * once the file is closed, a session index. All fields are in host byte
+ * order, which can be determined from the magic number.
+ *
+ *     Header (at offset 0):
+ *         uint32_t    magic (POWERBUF_SPILL_MAGIC)
+ *         uint32_t    version (1)
+ *         uint32_t    interval_us
+ *         uint32_t    chunk_samples
+ *         uint64_t    num_samples
+ *         uint64_t    index_offset (0 if the file wasn't closed)
+ *         uint32_t    num_sessions
+ *         uint32_t    reserved
+ *
+ *     Chunk n (at offset POWERBUF_SPILL_DATA_OFFSET +
+ *                         n * chunk_samples * 8):
+ *         uint32_t    current_ua[chunk_samples]
+ *         uint32_t    mab[chunk_samples]
+ *
+ *     Session index (at index_offset):
+ *         int64_t     wall_clock
+ *         uint64_t    first sample
+ *         uint64_t    total_ua
+ *
+ * Only one chunk is kept in memory while writing, and only one is
+ * mapped at a time while reading.
+ */
+#define POWERBUF_SPILL_MAGIC		0x4d505752
+#define POWERBUF_SPILL_CHUNK		65536
+#define POWERBUF_SPILL_DATA_OFFSET	65536
+
+struct powerbuf_spill;
+
+/* Sessions can also be exported in a compact binary form, either to a
+ * file or as a live stream to a FIFO or Unix socket. As for capture
+ * files, fields are in host byte order. Each session consists of:
+ *
+ *     Header:
+ *         uint32_t    magic (POWERBUF_EXPORT_MAGIC)
+ *         uint32_t    version (1)
+ *         uint32_t    interval_us
+ *         uint32_t    reserved
+ *         int64_t     wall_clock
+ *
+ *     Zero or more blocks of samples:
+ *         uint32_t    count (at most POWERBUF_EXPORT_BLOCK)
+ *         uint32_t    current_ua[count]
+ *         uint32_t    mab[count]
+ *
+ *     Terminator:
+ *         uint32_t    count (0)
+ *
+ * An exported file holds a single session. A stream holds one session
+ * after another, for as long as it's open.
+ */
+#define POWERBUF_EXPORT_MAGIC		0x4d505745
+#define POWERBUF_EXPORT_BLOCK		65536
+
+struct powerbuf_export_header {
+	uint32_t		magic;
+	uint32_t		version;
+	uint32_t		interval_us;
+	uint32_t		reserved;
+	int64_t			wall_clock;
+};
+
+struct powerbuf_stream;
+
+/* Charge consumption at a single MAB. */
+struct powerbuf_mab {
+	address_t		mab;
+	unsigned int		samples;
+	unsigned long long	sum_ua;
+};
+
+struct powerbuf_mab_entry;
+struct powerbuf_pyramid;
+
+/* Summary of a range of samples. */
+struct powerbuf_stats {
+	unsigned int		samples;
+	unsigned int		min_ua;
+	unsigned int		max_ua;
+	unsigned long long	sum_ua;
+};
+
 /* Power buffer data structure. The power buffer contains three circular
  * buffers, two of which are dynamically allocated. Helper functions are
  * provided for managing access.
@@ -79,16 +171,33 @@ struct powerbuf {
 	unsigned int			current_head;
 	unsigned int			current_tail;
 
-	/* Index by MAB. This is a flat array which points to indices
-	 * within current_ua/mab. The indices are sorted in order of
-	 * increasing MAB.
-	 *
-	 * Note that this array is invalidated by any modification to
-	 * the sample buffers. You need to call powerbuf_sort() before
-	 * accessing it.
+	/* Position in the sample stream of the sample at the tail. */
+	unsigned long long		tail_pos;
+
+	/* Charge consumption by MAB, over all samples in the session
+	 * list. This is an open-addressed hash table (with a power of two
+	 * size), which is kept up to date as samples come and go. If it
+	 * can't be enlarged, by_mab_lost is set and it's no longer
+	 * maintained until the buffer is cleared.
+	 */
+	struct powerbuf_mab_entry	*by_mab;
+	unsigned int			by_mab_size;
+	unsigned int			by_mab_count;
+	int				by_mab_lost;
+
+	/* Summaries of the sample stream, for powerbuf_get_stats(). */
+	struct powerbuf_pyramid		*pyramid;
+
+	/* Number of samples lost by the driver before they could be
+	 * added. The driver updates this directly.
 	 */
-	int				sort_valid;
-	unsigned int			*sorted;
+	unsigned long long		dropped;
+
+	/* Capture file, or NULL if samples are kept only in memory. */
+	struct powerbuf_spill		*spill;
+
+	/* Live stream, or NULL if there isn't one. */
+	struct powerbuf_stream		*stream;
 };
 
 typedef struct powerbuf *powerbuf_t;
@@ -128,14 +237,60 @@ void powerbuf_add_samples(powerbuf_t pb, unsigned int count,
 			  const unsigned int *current_ua,
 			  const address_t *mab);
 
+/* Fetch samples from a session, starting at the given offset within
+ * it. Returns the number of samples fetched, which is less than count
+ * only if the end of the session is reached.
+ */
+unsigned int powerbuf_get_samples(powerbuf_t pb, unsigned int rev_idx,
+				  unsigned int offset, unsigned int count,
+				  unsigned int *current_ua, address_t *mab);
+
+/* Summarize a range of samples within a session, in time logarithmic
+ * in the length of the range. Returns 0 on success or -1 if an error
+ * occurs. If the range is empty, st->samples is 0.
+ */
+int powerbuf_get_stats(powerbuf_t pb, unsigned int rev_idx,
+		       unsigned int offset, unsigned int count,
+		       struct powerbuf_stats *st);
+
+/* Begin spilling samples to a capture file. Sessions already in the
+ * buffer are copied into it first. Returns 0 on success or -1 if an
+ * error occurs.
+ *
+ * powerbuf_spill_close() writes the session index and closes the file.
+ * It's called automatically if the buffer is freed, or if the file
+ * can't be written to. powerbuf_spill_path() returns the name of the
+ * capture file, or NULL if there isn't one.
+ */
+int powerbuf_spill_open(powerbuf_t pb, const char *path);
+void powerbuf_spill_close(powerbuf_t pb);
+const char *powerbuf_spill_path(powerbuf_t pb);
+
+/* Fill out an export header for a session beginning at the given
+ * time.
+ */
+void powerbuf_export_header(powerbuf_t pb, time_t when,
+			    struct powerbuf_export_header *h);
+
+/* Begin streaming samples, as they're added, to the given FIFO or Unix
+ * socket, which must already have a reader. The stream never blocks:
+ * if the reader falls too far behind, blocks of samples are skipped and
+ * counted by powerbuf_stream_dropped().
+ *
+ * powerbuf_stream_close() ends the stream. It's called automatically
+ * if the buffer is freed, or if the reader goes away.
+ * powerbuf_stream_path() returns the name of the stream's destination,
+ * or NULL if there isn't one.
+ */
+int powerbuf_stream_open(powerbuf_t pb, const char *path);
+void powerbuf_stream_close(powerbuf_t pb);
+const char *powerbuf_stream_path(powerbuf_t pb);
+unsigned long long powerbuf_stream_dropped(powerbuf_t pb);
+
 /* Retrieve the last known MAB for this session, or 0 if none exists. */
 address_t powerbuf_last_mab(powerbuf_t pb);
 
-/* Prepare the sorted MAB index. */
-void powerbuf_sort(powerbuf_t pb);
-
-/* Obtain charge consumption data by MAB over all sessions. This
- * automatically calls powerbuf_sort() if necessary.
+/* Obtain charge consumption data by MAB over all sessions.
  *
  * Returns the number of samples found on success. The sum of all
  * current samples is written to the sum_ua argument.
@@ -143,4 +298,14 @@ void powerbuf_sort(powerbuf_t pb);
 int powerbuf_get_by_mab(powerbuf_t pb, address_t mab,
 			unsigned long long *sum_ua);
 
+/* Visit every MAB for which there are samples, in increasing order.
+ * Returns 0 on success, or -1 if the callback fails or the data isn't
+ * available.
+ */
+typedef int (*powerbuf_mab_func_t)(void *user_data,
+				   const struct powerbuf_mab *m);
+
+int powerbuf_enum_by_mab(powerbuf_t pb, powerbuf_mab_func_t func,
+			 void *user_data);
+
 #endif
@@ -0,0 +1,208 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "record.h"
+#include "output.h"
+#include "util.h"
+
+#define MAX_ID_LENGTH		64
+
+static char request_id[MAX_ID_LENGTH];
+
+int record_enabled(void)
+{
+	return output_records();
+}
+
+void record_set_id(const char *id)
+{
+	if (!id) {
+		request_id[0] = 0;
+		return;
+	}
+
+	strncpy(request_id, id, sizeof(request_id));
+	request_id[sizeof(request_id) - 1] = 0;
+}
+
+static void put(struct record *r, const char *text, int len)
+{
+	if (!r->failed && vector_push(&r->text, text, len) < 0)
+		r->failed = 1;
+}
+
+static void put_str(struct record *r, const char *text)
+{
+	put(r, text, strlen(text));
+}
+
+/* Write a string as a JSON string literal */
+static void put_quoted(struct record *r, const char *text)
+{
+	put(r, "\"", 1);
+
+	while (*text) {
+		const char *start = text;
+		char esc[8];
+
+		while (*text && *text != '"' && *text != '\\' &&
+		       (unsigned char)*text >= 0x20)
+			text++;
+
+		put(r, start, text - start);
+		if (!*text)
+			break;
+
+		if (*text == '"' || *text == '\\') {
+			esc[0] = '\\';
+			esc[1] = *text;
+			esc[2] = 0;
+		} else {
+			snprintf(esc, sizeof(esc), "\\u%04x",
+				 (unsigned char)*text);
+		}
+
+		put_str(r, esc);
+		text++;
+	}
+
+	put(r, "\"", 1);
+}
+
+/* Start a new field or array element */
+static void put_key(struct record *r, const char *key)
+{
+	if (r->need_comma)
+		put(r, ",", 1);
+	r->need_comma = 1;
+
+	if (key) {
+		put_quoted(r, key);
+		put(r, ":", 1);
+	}
+}
+
+void record_begin(struct record *r, const char *type)
+{
+	vector_init(&r->text, 1);
+	r->need_comma = 0;
+	r->failed = 0;
+
+	put(r, "{", 1);
+	record_str(r, "type", type);
+
+	if (request_id[0])
+		record_str(r, "id", request_id);
+}
+
+void record_end(struct record *r)
+{
+	put(r, "}", 1);
+
+	if (r->failed)
+		printc_err("record: out of memory\n");
+	else
+		output_record(r->text.ptr, r->text.size);
+
+	vector_destroy(&r->text);
+}
+
+void record_int(struct record *r, const char *key, long long value)
+{
+	char buf[32];
+
+	put_key(r, key);
+	snprintf(buf, sizeof(buf), "%" LLFMT, value);
+	put_str(r, buf);
+}
+
+void record_bool(struct record *r, const char *key, int value)
+{
+	put_key(r, key);
+	put_str(r, value ? "true" : "false");
+}
+
+void record_str(struct record *r, const char *key, const char *text)
+{
+	put_key(r, key);
+	put_quoted(r, text);
+}
+
+void record_data(struct record *r, const char *key,
+		 const uint8_t *data, int len)
+{
+	const int size = base64_encoded_size(len);
+	int needed;
+
+	put_key(r, key);
+	put(r, "\"", 1);
+
+	/* Encode directly into the end of the record. There must be
+	 * room for the nul terminator too.
+	 */
+	needed = r->text.size + size + 2;
+	if (!r->failed && r->text.capacity < needed &&
+	    vector_realloc(&r->text, needed) < 0)
+		r->failed = 1;
+
+	if (!r->failed) {
+		base64_encode(data, len, (char *)r->text.ptr + r->text.size,
+			      size + 1);
+		r->text.size += size;
+	}
+
+	put(r, "\"", 1);
+}
+
+void record_object_begin(struct record *r, const char *key)
+{
+	put_key(r, key);
+	put(r, "{", 1);
+	r->need_comma = 0;
+}
+
+void record_object_end(struct record *r)
+{
+	put(r, "}", 1);
+	r->need_comma = 1;
+}
+
+void record_array_begin(struct record *r, const char *key)
+{
+	put_key(r, key);
+	put(r, "[", 1);
+	r->need_comma = 0;
+}
+
+void record_array_end(struct record *r)
+{
+	put(r, "]", 1);
+	r->need_comma = 1;
+}
+
+void record_done(int status)
+{
+	struct record r;
+
+	record_begin(&r, "done");
+	record_int(&r, "status", status);
+	record_end(&r);
+}
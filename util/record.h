@@ -0,0 +1,65 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef RECORD_H_
+#define RECORD_H_
+
+#include <stdint.h>
+#include "vector.h"
+
+/* Structured records. In embedded mode, with the "json_records" option
+ * set, data which would otherwise be printed as formatted text is sent
+ * to the front-end as a single-line JSON object instead. See
+ * EmbeddedMode.txt for the framing.
+ *
+ * A record is built by calling record_begin(), then adding fields, then
+ * record_end(), which sends it and frees its memory. Fields added with
+ * a NULL key are array elements.
+ */
+struct record {
+	struct vector	text;
+	int		need_comma;
+	int		failed;
+};
+
+/* Returns non-zero if records should be sent instead of text. */
+int record_enabled(void);
+
+/* Set the request ID copied into each record, or clear it (NULL). */
+void record_set_id(const char *id);
+
+void record_begin(struct record *r, const char *type);
+void record_end(struct record *r);
+
+void record_int(struct record *r, const char *key, long long value);
+void record_bool(struct record *r, const char *key, int value);
+void record_str(struct record *r, const char *key, const char *text);
+
+/* Binary data is Base64-encoded. */
+void record_data(struct record *r, const char *key,
+		 const uint8_t *data, int len);
+
+void record_object_begin(struct record *r, const char *key);
+void record_object_end(struct record *r);
+void record_array_begin(struct record *r, const char *key);
+void record_array_end(struct record *r);
+
+/* Send a record giving the result of a command. */
+void record_done(int status);
+
+#endif
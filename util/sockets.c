@@ -160,6 +160,13 @@ int sockets_connect(SOCKET s, const struct sockaddr *addr, socklen_t addrlen)
 
 ssize_t sockets_send(SOCKET s, const void *buf, size_t len, int flags)
 {
+#if defined(MSG_NOSIGNAL)
+	flags |= MSG_NOSIGNAL;
+#elif defined(SO_NOSIGPIPE)
+	const int on = 1;
+
+	setsockopt(s, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
 	return send(s, buf, len, flags);
 }
 
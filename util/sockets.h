@@ -42,7 +42,8 @@ typedef int SOCKET;
 #endif
 
 /* These are versions of the blocking IO calls which can be interrupted
- * by the user pressing Ctrl+C.
+ * by the user pressing Ctrl+C. sockets_send() never raises SIGPIPE: a
+ * closed connection is reported as an error instead.
  */
 SOCKET sockets_accept(SOCKET s, struct sockaddr *addr, socklen_t *addrlen);
 int sockets_connect(SOCKET s, const struct sockaddr *addr, socklen_t addrlen);
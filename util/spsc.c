@@ -0,0 +1,99 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "spsc.h"
+
+int spsc_init(struct spsc *q, unsigned int elemsize, unsigned int capacity)
+{
+	memset(q, 0, sizeof(*q));
+
+	q->buf = malloc(elemsize * capacity);
+	if (!q->buf)
+		return -1;
+
+	q->elemsize = elemsize;
+	q->capacity = capacity;
+	return 0;
+}
+
+void spsc_destroy(struct spsc *q)
+{
+	free(q->buf);
+	memset(q, 0, sizeof(*q));
+}
+
+unsigned int spsc_room(struct spsc *q)
+{
+	const unsigned int tail = __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE);
+
+	return q->capacity - (q->head - tail);
+}
+
+/* Copy elements in or out of the ring, starting at the given counter
+ * value and wrapping around the end if necessary.
+ */
+static void copy_ring(struct spsc *q, unsigned int pos, uint8_t *data,
+		      unsigned int count, int in)
+{
+	const unsigned int idx = pos & (q->capacity - 1);
+	unsigned int first = q->capacity - idx;
+	uint8_t *ring = q->buf + idx * q->elemsize;
+
+	if (first > count)
+		first = count;
+
+	if (in) {
+		memcpy(ring, data, first * q->elemsize);
+		memcpy(q->buf, data + first * q->elemsize,
+		       (count - first) * q->elemsize);
+	} else {
+		memcpy(data, ring, first * q->elemsize);
+		memcpy(data + first * q->elemsize, q->buf,
+		       (count - first) * q->elemsize);
+	}
+}
+
+unsigned int spsc_push(struct spsc *q, const void *data, unsigned int count)
+{
+	const unsigned int room = spsc_room(q);
+
+	if (count > room)
+		count = room;
+
+	copy_ring(q, q->head, (uint8_t *)data, count, 1);
+	__atomic_store_n(&q->head, q->head + count, __ATOMIC_RELEASE);
+
+	return count;
+}
+
+unsigned int spsc_pop(struct spsc *q, void *data, unsigned int max)
+{
+	const unsigned int head = __atomic_load_n(&q->head, __ATOMIC_ACQUIRE);
+	unsigned int count = head - q->tail;
+
+	if (count > max)
+		count = max;
+
+	copy_ring(q, q->tail, (uint8_t *)data, count, 0);
+	__atomic_store_n(&q->tail, q->tail + count, __ATOMIC_RELEASE);
+
+	return count;
+}
@@ -0,0 +1,60 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef SPSC_H_
+#define SPSC_H_
+
+#include <stdint.h>
+
+/* Lock-free single-producer, single-consumer queue. One thread may push
+ * elements while another pops them, without any other synchronization.
+ *
+ * The capacity, in elements, must be a power of two.
+ */
+struct spsc {
+	uint8_t			*buf;
+	unsigned int		elemsize;
+	unsigned int		capacity;
+
+	/* Free-running counters. The head is advanced only by the
+	 * producer, and the tail only by the consumer.
+	 */
+	unsigned int		head;
+	unsigned int		tail;
+};
+
+/* Create and destroy queues. spsc_init() returns 0 on success or -1 if
+ * memory can't be allocated.
+ */
+int spsc_init(struct spsc *q, unsigned int elemsize, unsigned int capacity);
+void spsc_destroy(struct spsc *q);
+
+/* Number of elements which may be pushed without blocking. Only the
+ * producer should call this.
+ */
+unsigned int spsc_room(struct spsc *q);
+
+/* Push as many of the given elements as will fit. Returns the number
+ * pushed.
+ */
+unsigned int spsc_push(struct spsc *q, const void *data, unsigned int count);
+
+/* Pop up to max elements. Returns the number popped. */
+unsigned int spsc_pop(struct spsc *q, void *data, unsigned int max);
+
+#endif
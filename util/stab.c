@@ -15,229 +15,858 @@
  * along with this program; if not, write to the Free Software
  * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
-
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
 #include <stdint.h>
-#include <regex.h>
-#include <assert.h>
-#include "btree.h"
+#include <limits.h>
 #include "stab.h"
 #include "util.h"
+#include "vector.h"
 #include "output.h"
+#include "demangle.h"
 
 /************************************************************************
- * B+Tree definitions
+ * Symbol storage
+ *
+ * Each symbol name is interned once into a string arena, and symbols
+ * are kept in a flat array of (name offset, address) records. Two
+ * indices are kept over that array:
+ *
+ *    - an open-addressed hash table on the name, used for stab_get(),
+ *      stab_set() and stab_del().
+ *    - an array of record numbers sorted by (address, name), used for
+ *      stab_resolve() and stab_enum(). This is rebuilt lazily, so that
+ *      a long sequence of stab_set() calls (loading an image) costs a
+ *      single sort.
+ *
+ * The whole table can also be saved as a flat, position-independent
+ * image, and an image can be used in place as the table (for example,
+ * straight from a file mapping). The first modification then copies
+ * it to the heap.
+ *
+ * Address resolution remembers the position of the last hit, so that
+ * the sequential lookups done when disassembling or dumping trace data
+ * rarely need a search. Demangled names are produced on first use and
+ * kept in a second arena.
+ *
+ * While bulk loading, stab_set() appends records without touching the
+ * name index, which is then built at the end with no rehashing.
  */
 
-struct sym_key {
-	char name[MAX_SYMBOL_LENGTH];
-};
+#define NAME_DELETED		((uint32_t)0xffffffff)
+
+#define DEMANGLE_UNKNOWN	((uint32_t)0xffffffff)
+#define DEMANGLE_NONE		((uint32_t)0xfffffffe)
+
+#define HASH_EMPTY		(-1)
+#define HASH_TOMBSTONE		(-2)
+#define HASH_MIN_SIZE		64
 
-static const struct sym_key sym_key_zero = {
-	.name = {0}
+struct stab_entry {
+	uint32_t	name;
+	uint32_t	demangled;
+	address_t	addr;
 };
 
-static int sym_key_compare(const void *left, const void *right)
+static struct vector	stab_strings;
+static struct vector	stab_demangled;
+static struct vector	stab_entries;
+static int		stab_dead;
+
+static int		*stab_hash;
+static int		stab_hash_size;
+static int		stab_hash_used;
+
+static int		stab_bulk;
+
+static int		*stab_sorted;
+static int		stab_sorted_count;
+static int		stab_sorted_cap;
+static int		stab_sorted_dirty;
+static int		stab_cursor;
+
+static stab_release_t	stab_image_release;
+static void		*stab_image_ctx;
+static int		*stab_spare_hash;
+static int		stab_spare_hash_size;
+
+static inline struct stab_entry *entry_at(int i)
+{
+	return VECTOR_PTR(stab_entries, i, struct stab_entry);
+}
+
+static inline const char *entry_name(const struct stab_entry *e)
 {
-	return strcmp(((const struct sym_key *)left)->name,
-		      ((const struct sym_key *)right)->name);
+	return VECTOR_PTR(stab_strings, e->name, const char);
 }
 
-static void sym_key_init(struct sym_key *key, const char *text)
+/* Symbol names are limited to MAX_SYMBOL_LENGTH - 1 characters, as
+ * they always have been, so that they fit in the buffers used by
+ * callers.
+ */
+static int name_len(const char *name)
 {
-	int len = strlen(text);
+	const char *end = memchr(name, 0, MAX_SYMBOL_LENGTH - 1);
+
+	return end ? end - name : MAX_SYMBOL_LENGTH - 1;
+}
 
-	if (len >= sizeof(key->name))
-		len = sizeof(key->name) - 1;
+static uint32_t name_hash(const char *name, int len)
+{
+	uint32_t h = 2166136261u;
+	int i;
 
-	memcpy(key->name, text, len);
-	key->name[len] = 0;
+	for (i = 0; i < len; i++) {
+		h ^= (uint8_t)name[i];
+		h *= 16777619u;
+	}
+
+	return h;
 }
 
-struct addr_key {
-	address_t      addr;
-	char           name[MAX_SYMBOL_LENGTH];
-};
+static int name_equal(const struct stab_entry *e, const char *name, int len)
+{
+	const char *n = entry_name(e);
 
-static const struct addr_key addr_key_zero = {
-	.addr = 0,
-	.name = {0}
-};
+	return !memcmp(n, name, len) && !n[len];
+}
+
+/************************************************************************
+ * Name index
+ */
+
+/* Find the hash slot for a name. If the name is present, the slot
+ * holding it is returned. Otherwise, the first free slot on the probe
+ * sequence is returned.
+ */
+static int hash_find(const char *name, int len)
+{
+	const int mask = stab_hash_size - 1;
+	int i = name_hash(name, len) & mask;
+	int free_slot = -1;
 
-static int addr_key_compare(const void *left, const void *right)
+	for (;;) {
+		const int e = stab_hash[i];
+
+		if (e == HASH_EMPTY)
+			return free_slot >= 0 ? free_slot : i;
+
+		if (e == HASH_TOMBSTONE) {
+			if (free_slot < 0)
+				free_slot = i;
+		} else if (name_equal(entry_at(e), name, len)) {
+			return i;
+		}
+
+		i = (i + 1) & mask;
+	}
+}
+
+static int hash_resize(int size)
+{
+	int *old = stab_hash;
+	const int old_size = stab_hash_size;
+	int *table = malloc(size * sizeof(table[0]));
+	int i;
+
+	if (!table) {
+		pr_error("stab: can't allocate name index");
+		return -1;
+	}
+
+	for (i = 0; i < size; i++)
+		table[i] = HASH_EMPTY;
+
+	stab_hash = table;
+	stab_hash_size = size;
+	stab_hash_used = 0;
+
+	for (i = 0; i < old_size; i++) {
+		const int e = old[i];
+
+		if (e >= 0) {
+			const char *name = entry_name(entry_at(e));
+
+			stab_hash[hash_find(name, strlen(name))] = e;
+			stab_hash_used++;
+		}
+	}
+
+	free(old);
+	return 0;
+}
+
+/* Make sure there's room for one more name in the index. Tombstones
+ * count towards the load, so that probe sequences stay short.
+ */
+static int hash_reserve(void)
 {
-	const struct addr_key *kl = (const struct addr_key *)left;
-	const struct addr_key *kr = (const struct addr_key *)right;
+	int size = stab_hash_size;
+
+	if ((stab_hash_used + 1) * 4 < size * 3)
+		return 0;
+
+	while ((stab_entries.size - stab_dead + 1) * 2 >= size)
+		size <<= 1;
+
+	return hash_resize(size);
+}
+
+/************************************************************************
+ * Address index
+ */
+
+static int sorted_compare(const void *left, const void *right)
+{
+	const struct stab_entry *kl = entry_at(*(const int *)left);
+	const struct stab_entry *kr = entry_at(*(const int *)right);
 
 	if (kl->addr < kr->addr)
 		return -1;
 	if (kl->addr > kr->addr)
 		return 1;
 
-	return strcmp(kl->name, kr->name);
+	return strcmp(entry_name(kl), entry_name(kr));
 }
 
-static void addr_key_init(struct addr_key *key, address_t addr,
-			  const char *text)
+static int sorted_update(void)
 {
-	int len = strlen(text);
+	int i;
 
-	if (len >= sizeof(key->name))
-		len = sizeof(key->name) - 1;
+	if (!stab_sorted_dirty)
+		return 0;
 
-	key->addr = addr;
-	memcpy(key->name, text, len);
-	key->name[len] = 0;
+	if (stab_sorted_cap < stab_entries.size) {
+		int *n = realloc(stab_sorted,
+				 stab_entries.size * sizeof(n[0]));
+
+		if (!n) {
+			pr_error("stab: can't allocate address index");
+			return -1;
+		}
+
+		stab_sorted = n;
+		stab_sorted_cap = stab_entries.size;
+	}
+
+	stab_sorted_count = 0;
+	for (i = 0; i < stab_entries.size; i++)
+		if (entry_at(i)->name != NAME_DELETED)
+			stab_sorted[stab_sorted_count++] = i;
+
+	qsort(stab_sorted, stab_sorted_count, sizeof(stab_sorted[0]),
+	      sorted_compare);
+	stab_sorted_dirty = 0;
+	stab_cursor = 0;
+	return 0;
 }
 
-static const struct btree_def sym_table_def = {
-	.compare = sym_key_compare,
-	.zero = &sym_key_zero,
-	.branches = 32,
-	.key_size = sizeof(struct sym_key),
-	.data_size = sizeof(address_t)
-};
+static inline address_t sorted_addr(int i)
+{
+	return entry_at(stab_sorted[i])->addr;
+}
+
+/* Is the given position the last symbol at or below addr? */
+static inline int sorted_hit(int i, address_t addr)
+{
+	return i < stab_sorted_count && sorted_addr(i) <= addr &&
+		(i + 1 >= stab_sorted_count || sorted_addr(i + 1) > addr);
+}
+
+/* Find the position of the last (greatest-named) symbol at or below
+ * addr, or -1 if there is none.
+ */
+static int sorted_find(address_t addr)
+{
+	int low = 0;
+	int high = stab_sorted_count;
+
+	if (sorted_hit(stab_cursor, addr))
+		return stab_cursor;
 
-static const struct btree_def addr_table_def = {
-	.compare = addr_key_compare,
-	.zero = &addr_key_zero,
-	.branches = 32,
-	.key_size = sizeof(struct addr_key),
-	.data_size = 0
+	if (sorted_hit(stab_cursor + 1, addr))
+		return ++stab_cursor;
+
+	/* Find the first entry with an address greater than addr */
+	while (low < high) {
+		const int mid = (low + high) >> 1;
+
+		if (sorted_addr(mid) <= addr)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	if (!low)
+		return -1;
+
+	stab_cursor = low - 1;
+	return stab_cursor;
+}
+
+/* Fetch the demangled name of an entry, or NULL if it has none */
+static const char *entry_demangled(struct stab_entry *e)
+{
+	char buf[MAX_SYMBOL_LENGTH];
+	int len;
+
+	if (e->demangled == DEMANGLE_UNKNOWN) {
+		len = demangle(entry_name(e), buf, sizeof(buf));
+
+		e->demangled = DEMANGLE_NONE;
+		if (len > 0) {
+			const uint32_t offset = stab_demangled.size;
+
+			if (vector_push(&stab_demangled, buf, len + 1) < 0)
+				return NULL;
+
+			e->demangled = offset;
+		}
+	}
+
+	if (e->demangled == DEMANGLE_NONE)
+		return NULL;
+
+	return VECTOR_PTR(stab_demangled, e->demangled, const char);
+}
+
+/************************************************************************
+ * Flat images
+ *
+ * An image is a header, followed by the record array, the address
+ * index, the name index and finally the string arena.
+ */
+
+#define IMAGE_MAGIC		0x42415453
+
+struct stab_image_header {
+	uint32_t	magic;
+	uint32_t	num_entries;
+	uint32_t	strings_len;
+	uint32_t	hash_size;
 };
 
+/* Forget an image without copying it, putting back the heap name index
+ * it displaced.
+ */
+static void release_image(void)
+{
+	if (!stab_image_release)
+		return;
+
+	vector_init(&stab_strings, 1);
+	vector_init(&stab_entries, sizeof(struct stab_entry));
+
+	stab_hash = stab_spare_hash;
+	stab_hash_size = stab_spare_hash_size;
+	stab_spare_hash = NULL;
+
+	stab_sorted = NULL;
+	stab_sorted_count = 0;
+	stab_sorted_cap = 0;
+
+	stab_image_release(stab_image_ctx);
+	stab_image_release = NULL;
+}
+
+/* Copy an image-backed table to the heap, so that it can be modified */
+static int detach_image(void)
+{
+	struct vector strings;
+	struct vector entries;
+	int *hash;
+	int *sorted;
+
+	if (!stab_image_release)
+		return 0;
+
+	vector_init(&strings, 1);
+	vector_init(&entries, sizeof(struct stab_entry));
+	hash = malloc(stab_hash_size * sizeof(hash[0]));
+	sorted = malloc((stab_sorted_count + 1) * sizeof(sorted[0]));
+
+	if (!hash || !sorted ||
+	    vector_push(&strings, stab_strings.ptr, stab_strings.size) < 0 ||
+	    vector_push(&entries, stab_entries.ptr, stab_entries.size) < 0) {
+		pr_error("stab: can't copy symbol table");
+		vector_destroy(&strings);
+		vector_destroy(&entries);
+		free(hash);
+		free(sorted);
+		return -1;
+	}
+
+	memcpy(hash, stab_hash, stab_hash_size * sizeof(hash[0]));
+	memcpy(sorted, stab_sorted, stab_sorted_count * sizeof(sorted[0]));
+
+	free(stab_spare_hash);
+	stab_spare_hash = NULL;
+	stab_image_release(stab_image_ctx);
+	stab_image_release = NULL;
+
+	stab_strings = strings;
+	stab_entries = entries;
+	stab_hash = hash;
+	stab_sorted = sorted;
+	stab_sorted_cap = stab_sorted_count + 1;
+
+	return 0;
+}
+
 /************************************************************************
  * Symbol table methods
  */
 
-static btree_t         stab_sym;
-static btree_t         stab_addr;
+static void reset_tables(void)
+{
+	int i;
+
+	release_image();
+
+	vector_realloc(&stab_strings, 0);
+	vector_realloc(&stab_demangled, 0);
+	vector_realloc(&stab_entries, 0);
+	stab_dead = 0;
+
+	for (i = 0; i < stab_hash_size; i++)
+		stab_hash[i] = HASH_EMPTY;
+	stab_hash_used = 0;
+
+	free(stab_sorted);
+	stab_sorted = NULL;
+	stab_sorted_count = 0;
+	stab_sorted_cap = 0;
+	stab_sorted_dirty = 0;
+	stab_cursor = 0;
+
+	stab_bulk = 0;
+}
 
 void stab_clear(void)
 {
-	btree_clear(stab_sym);
-	btree_clear(stab_addr);
+	reset_tables();
 }
 
-int stab_set(const char *name, int value)
+/* Rebuild the arena and record array without deleted entries. This
+ * is done when more than half the records are dead (e.g. after
+ * renaming most of the table).
+ */
+static int compact(void)
 {
-	struct sym_key skey;
-	struct addr_key akey;
-	address_t addr = value;
-	address_t old_addr;
+	struct vector strings;
+	struct vector entries;
+	int i;
 
-	sym_key_init(&skey, name);
+	if (detach_image() < 0)
+		return -1;
 
-	/* Look for an old address first, and delete the reverse mapping
-	 * if it's there.
-	 */
-	if (!btree_get(stab_sym, &skey, &old_addr)) {
-		addr_key_init(&akey, old_addr, skey.name);
-		btree_delete(stab_addr, &akey);
+	vector_init(&strings, 1);
+	vector_init(&entries, sizeof(struct stab_entry));
+
+	for (i = 0; i < stab_entries.size; i++) {
+		const struct stab_entry *e = entry_at(i);
+		struct stab_entry n;
+		const char *name;
+
+		if (e->name == NAME_DELETED)
+			continue;
+
+		name = entry_name(e);
+		n.name = strings.size;
+		n.demangled = DEMANGLE_UNKNOWN;
+		n.addr = e->addr;
+
+		if (vector_push(&strings, name, strlen(name) + 1) < 0 ||
+		    vector_push(&entries, &n, 1) < 0) {
+			vector_destroy(&strings);
+			vector_destroy(&entries);
+			return -1;
+		}
 	}
 
-	/* Put the new mapping into both tables */
-	addr_key_init(&akey, addr, name);
-	if (btree_put(stab_addr, &akey, NULL) < 0 ||
-	    btree_put(stab_sym, &skey, &addr) < 0) {
-		printc_err("stab: can't set %s = 0x%04x\n", name, addr);
-		return -1;
+	vector_destroy(&stab_strings);
+	vector_destroy(&stab_entries);
+	stab_strings = strings;
+	stab_entries = entries;
+	vector_realloc(&stab_demangled, 0);
+	stab_dead = 0;
+	stab_sorted_dirty = 1;
+
+	for (i = 0; i < stab_hash_size; i++)
+		stab_hash[i] = HASH_EMPTY;
+	stab_hash_used = 0;
+
+	for (i = 0; i < stab_entries.size; i++) {
+		const char *name = entry_name(entry_at(i));
+
+		stab_hash[hash_find(name, strlen(name))] = i;
+		stab_hash_used++;
 	}
 
 	return 0;
 }
 
-int stab_nearest(address_t addr, char *ret_name, int max_len,
-		 address_t *ret_offset)
+void stab_bulk_begin(void)
 {
-	struct addr_key akey;
+	stab_bulk = !stab_entries.size;
+}
+
+int stab_bulk_end(void)
+{
+	int size = HASH_MIN_SIZE;
 	int i;
 
-	akey.addr = addr;
-	for (i = 0; i < sizeof(akey.name); i++)
-		akey.name[i] = 0xff;
-	akey.name[sizeof(akey.name) - 1] = 0xff;
+	if (!stab_bulk)
+		return 0;
+
+	stab_bulk = 0;
+
+	while (stab_entries.size * 4 >= size * 3)
+		size <<= 1;
+
+	if (size > stab_hash_size && hash_resize(size) < 0) {
+		reset_tables();
+		return -1;
+	}
+
+	for (i = 0; i < stab_entries.size; i++) {
+		struct stab_entry *e = entry_at(i);
+		const char *name = entry_name(e);
+		const int slot = hash_find(name, strlen(name));
+
+		if (stab_hash[slot] >= 0) {
+			entry_at(stab_hash[slot])->addr = e->addr;
+			e->name = NAME_DELETED;
+			stab_dead++;
+			continue;
+		}
+
+		stab_hash[slot] = i;
+		stab_hash_used++;
+	}
+
+	stab_sorted_dirty = 1;
+	return 0;
+}
+
+int stab_set(const char *name, int value)
+{
+	const int len = name_len(name);
+	const address_t addr = value;
+	struct stab_entry e;
+	int slot = -1;
+
+	if (detach_image() < 0)
+		goto fail;
+
+	if (!stab_bulk) {
+		if (hash_reserve() < 0)
+			goto fail;
+
+		slot = hash_find(name, len);
+	}
+
+	if (slot >= 0 && stab_hash[slot] >= 0) {
+		struct stab_entry *old = entry_at(stab_hash[slot]);
+
+		if (old->addr != addr) {
+			old->addr = addr;
+			stab_sorted_dirty = 1;
+		}
 
-	if (!btree_select(stab_addr, &akey, BTREE_LE, &akey, NULL)) {
-		strncpy(ret_name, akey.name, max_len);
-		ret_name[max_len - 1] = 0;
-		*ret_offset = addr - akey.addr;
 		return 0;
 	}
 
+	e.name = stab_strings.size;
+	e.demangled = DEMANGLE_UNKNOWN;
+	e.addr = addr;
+
+	if (vector_push(&stab_strings, name, len) < 0 ||
+	    vector_push(&stab_strings, "", 1) < 0 ||
+	    vector_push(&stab_entries, &e, 1) < 0) {
+		stab_strings.size = e.name;
+		goto fail;
+	}
+
+	stab_sorted_dirty = 1;
+	if (stab_bulk)
+		return 0;
+
+	if (stab_hash[slot] == HASH_EMPTY)
+		stab_hash_used++;
+	stab_hash[slot] = stab_entries.size - 1;
+
+	return 0;
+
+fail:
+	printc_err("stab: can't set %s = 0x%04x\n", name, value);
 	return -1;
 }
 
+const char *stab_resolve(address_t addr, address_t *ret_offset,
+			 const char **ret_demangled)
+{
+	struct stab_entry *e;
+	int i;
+
+	if (stab_bulk_end() < 0 || sorted_update() < 0)
+		return NULL;
+
+	i = sorted_find(addr);
+	if (i < 0)
+		return NULL;
+
+	e = entry_at(stab_sorted[i]);
+	*ret_offset = addr - e->addr;
+	if (ret_demangled)
+		*ret_demangled = entry_demangled(e);
+
+	return entry_name(e);
+}
+
+int stab_nearest(address_t addr, char *ret_name, int max_len,
+		 address_t *ret_offset)
+{
+	const char *name = stab_resolve(addr, ret_offset, NULL);
+
+	if (!name)
+		return -1;
+
+	strncpy(ret_name, name, max_len);
+	ret_name[max_len - 1] = 0;
+
+	return 0;
+}
+
 int stab_get(const char *name, address_t *value)
 {
-	struct sym_key skey;
-	address_t addr;
+	int slot;
 
-	sym_key_init(&skey, name);
-	if (btree_get(stab_sym, &skey, &addr))
+	if (stab_bulk_end() < 0)
 		return -1;
 
-	*value = addr;
+	slot = hash_find(name, name_len(name));
+	if (stab_hash[slot] < 0)
+		return -1;
+
+	*value = entry_at(stab_hash[slot])->addr;
 	return 0;
 }
 
 int stab_del(const char *name)
 {
-	struct sym_key skey;
-	address_t value;
-	struct addr_key akey;
+	int slot;
 
-	sym_key_init(&skey, name);
-	if (btree_get(stab_sym, &skey, &value))
+	if (stab_bulk_end() < 0 || detach_image() < 0)
 		return -1;
 
-	addr_key_init(&akey, value, name);
-	btree_delete(stab_sym, &skey);
-	btree_delete(stab_addr, &akey);
+	slot = hash_find(name, name_len(name));
+	if (stab_hash[slot] < 0)
+		return -1;
+
+	entry_at(stab_hash[slot])->name = NAME_DELETED;
+	stab_hash[slot] = HASH_TOMBSTONE;
+	stab_sorted_dirty = 1;
+	stab_dead++;
+
+	if (stab_dead > 64 && stab_dead * 2 > stab_entries.size)
+		compact();
 
 	return 0;
 }
 
 int stab_enum(stab_callback_t cb, void *user_data)
 {
-	int ret;
-	struct addr_key akey;
+	int i;
 
-	ret = btree_select(stab_addr, NULL, BTREE_FIRST,
-			   &akey, NULL);
-	while (!ret) {
-		if (cb(user_data, akey.name, akey.addr) < 0)
+	if (stab_bulk_end() < 0 || sorted_update() < 0)
+		return -1;
+
+	for (i = 0; i < stab_sorted_count; i++) {
+		const struct stab_entry *e = entry_at(stab_sorted[i]);
+
+		if (cb(user_data, entry_name(e), e->addr) < 0)
 			return -1;
-		ret = btree_select(stab_addr, NULL, BTREE_NEXT,
-				   &akey, NULL);
 	}
 
 	return 0;
 }
 
-int stab_init(void)
+/* Images can be written either to a file or to memory */
+typedef int (*image_write_t)(void *ctx, const void *data, int len);
+
+static int write_file(void *ctx, const void *data, int len)
 {
-	stab_sym = btree_alloc(&sym_table_def);
-	if (!stab_sym) {
-		printc_err("stab: failed to allocate symbol table\n");
+	return fwrite(data, 1, len, (FILE *)ctx) == len ? 0 : -1;
+}
+
+static int write_vector(void *ctx, const void *data, int len)
+{
+	return vector_push((struct vector *)ctx, data, len);
+}
+
+static int save_image(image_write_t write, void *ctx)
+{
+	struct stab_image_header hdr;
+	int i;
+
+	if (stab_bulk_end() < 0 ||
+	    (stab_dead && compact() < 0) ||
+	    sorted_update() < 0)
 		return -1;
+
+	hdr.magic = IMAGE_MAGIC;
+	hdr.num_entries = stab_entries.size;
+	hdr.strings_len = stab_strings.size;
+	hdr.hash_size = stab_hash_size;
+
+	if (write(ctx, &hdr, sizeof(hdr)) < 0)
+		return -1;
+
+	/* Cached demangled names refer to memory outside the image */
+	for (i = 0; i < stab_entries.size; i++) {
+		struct stab_entry e = *entry_at(i);
+
+		e.demangled = DEMANGLE_UNKNOWN;
+		if (write(ctx, &e, sizeof(e)) < 0)
+			return -1;
 	}
 
-	stab_addr = btree_alloc(&addr_table_def);
-	if (!stab_addr) {
-		printc_err("stab: failed to allocate address table\n");
-		btree_free(stab_sym);
+	if (write(ctx, stab_sorted,
+		  stab_sorted_count * sizeof(stab_sorted[0])) < 0 ||
+	    write(ctx, stab_hash,
+		  stab_hash_size * sizeof(stab_hash[0])) < 0 ||
+	    write(ctx, stab_strings.ptr, stab_strings.size) < 0)
+		return -1;
+
+	return 0;
+}
+
+int stab_save_image(FILE *out)
+{
+	if (save_image(write_file, out) < 0) {
+		pr_error("stab: can't write image");
 		return -1;
 	}
 
-        return 0;
+	return 0;
+}
+
+int stab_save_vector(struct vector *out)
+{
+	if (save_image(write_vector, out) < 0) {
+		printc_err("stab: can't save symbol table image\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+int stab_use_image(void *data, size_t len,
+		   stab_release_t release, void *ctx)
+{
+	const struct stab_image_header *hdr = data;
+	const struct stab_entry *entries;
+	const int *sorted;
+	const int *hash;
+	const char *strings;
+	uint64_t need = sizeof(*hdr);
+	int hash_used = 0;
+	int has_empty = 0;
+	uint32_t i;
+
+	/* Check the whole image once, so that no further bounds checks
+	 * are needed while it's in use.
+	 */
+	if (((uintptr_t)data & 3) || len < sizeof(*hdr) ||
+	    hdr->magic != IMAGE_MAGIC ||
+	    hdr->hash_size < 1 || (hdr->hash_size & (hdr->hash_size - 1)) ||
+	    hdr->hash_size > INT_MAX / sizeof(int) ||
+	    hdr->num_entries >= hdr->hash_size ||
+	    hdr->strings_len > INT_MAX)
+		goto bad;
+
+	need += (uint64_t)hdr->num_entries * sizeof(*entries);
+	need += (uint64_t)hdr->num_entries * sizeof(*sorted);
+	need += (uint64_t)hdr->hash_size * sizeof(*hash);
+	need += hdr->strings_len;
+	if (need != len)
+		goto bad;
+
+	entries = (const struct stab_entry *)(hdr + 1);
+	sorted = (const int *)(entries + hdr->num_entries);
+	hash = sorted + hdr->num_entries;
+	strings = (const char *)(hash + hdr->hash_size);
+
+	if (hdr->strings_len && strings[hdr->strings_len - 1])
+		goto bad;
+
+	for (i = 0; i < hdr->num_entries; i++)
+		if (entries[i].name >= hdr->strings_len ||
+		    entries[i].demangled != DEMANGLE_UNKNOWN ||
+		    sorted[i] < 0 || sorted[i] >= hdr->num_entries)
+			goto bad;
+
+	for (i = 0; i < hdr->hash_size; i++) {
+		if (hash[i] == HASH_EMPTY)
+			has_empty = 1;
+		else if (hash[i] >= 0 && hash[i] < hdr->num_entries)
+			hash_used++;
+		else if (hash[i] != HASH_TOMBSTONE)
+			goto bad;
+	}
+
+	if (!has_empty)
+		goto bad;
+
+	reset_tables();
+
+	stab_spare_hash = stab_hash;
+	stab_spare_hash_size = stab_hash_size;
+	stab_image_release = release;
+	stab_image_ctx = ctx;
+
+	stab_strings.ptr = (void *)strings;
+	stab_strings.size = stab_strings.capacity = hdr->strings_len;
+	stab_entries.ptr = (void *)entries;
+	stab_entries.size = stab_entries.capacity = hdr->num_entries;
+
+	stab_hash = (int *)hash;
+	stab_hash_size = hdr->hash_size;
+	stab_hash_used = hash_used;
+
+	stab_sorted = (int *)sorted;
+	stab_sorted_count = stab_sorted_cap = hdr->num_entries;
+
+	return 0;
+
+bad:
+	printc_err("stab: invalid symbol table image\n");
+	return -1;
+}
+
+int stab_init(void)
+{
+	vector_init(&stab_strings, 1);
+	vector_init(&stab_demangled, 1);
+	vector_init(&stab_entries, sizeof(struct stab_entry));
+
+	stab_hash = NULL;
+	stab_hash_size = 0;
+	if (hash_resize(HASH_MIN_SIZE) < 0) {
+		printc_err("stab: failed to allocate symbol table\n");
+		return -1;
+	}
+
+	reset_tables();
+	return 0;
 }
 
 void stab_exit(void)
 {
-	btree_free(stab_sym);
-	btree_free(stab_addr);
+	reset_tables();
+	free(stab_hash);
+	stab_hash = NULL;
+	stab_hash_size = 0;
 }
@@ -19,8 +19,10 @@
 #ifndef STAB_H_
 #define STAB_H_
 
+#include <stdio.h>
 #include <stdint.h>
 #include "util.h"
+#include "vector.h"
 
 #define MAX_SYMBOL_LENGTH 512
 
@@ -36,6 +38,18 @@ void stab_clear(void);
 /* Set a symbol in the table. Returns 0 on success, or -1 on error. */
 int stab_set(const char *name, int value);
 
+/* Bulk loading. If the table is empty when stab_bulk_begin() is called,
+ * subsequent calls to stab_set() only append to the table, and the
+ * indices are built in a single pass by stab_bulk_end() (or the next
+ * lookup). If the same name is set more than once, the last value wins,
+ * as it would for individual calls.
+ *
+ * If the table isn't empty, stab_set() behaves as usual. stab_bulk_end()
+ * returns 0 on success or -1 on error.
+ */
+void stab_bulk_begin(void);
+int stab_bulk_end(void);
+
 /* Take an address and find the nearest symbol and offset (always
  * non-negative).
  *
@@ -44,6 +58,17 @@ int stab_set(const char *name, int value);
 int stab_nearest(address_t addr, char *ret_name, int max_len,
 		 address_t *ret_offset);
 
+/* Find the nearest symbol at or below an address without copying its
+ * name. Lookups at nearby or increasing addresses (as when
+ * disassembling) are cheap. If ret_demangled is given, it receives the
+ * demangled name, or NULL if the name isn't mangled.
+ *
+ * Returned names point into the table, and remain valid only until the
+ * next call to a stab function. Returns NULL if no symbol is found.
+ */
+const char *stab_resolve(address_t addr, address_t *ret_offset,
+			 const char **ret_demangled);
+
 /* Retrieve the value of a symbol. Returns 0 on success or -1 if the symbol
  * doesn't exist.
  */
@@ -60,4 +85,27 @@ typedef int (*stab_callback_t)(void *user_data,
 
 int stab_enum(stab_callback_t cb, void *user_data);
 
+/* Save the table as a flat image, suitable for stab_use_image(). The
+ * image is in host byte order. Returns 0 on success or -1 on error.
+ */
+int stab_save_image(FILE *out);
+
+/* As for stab_save_image(), but append the image to a byte vector. */
+int stab_save_vector(struct vector *out);
+
+/* Replace the table with an image previously written by
+ * stab_save_image(), using it in place. The memory must be 4-byte
+ * aligned and writable (a private mapping will do), and must remain
+ * valid until the release function is called. The release function is
+ * invoked when the table is cleared, or after the table has been copied
+ * to the heap on first modification.
+ *
+ * The image is validated first. Returns 0 on success, or -1 if the
+ * image is invalid, in which case the table is left unchanged.
+ */
+typedef void (*stab_release_t)(void *ctx);
+
+int stab_use_image(void *data, size_t len,
+		   stab_release_t release, void *ctx);
+
 #endif
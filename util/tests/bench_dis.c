@@ -0,0 +1,118 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "dis.h"
+#include "dis_ref.h"
+
+/*
+ * Microbenchmark for the instruction decoder. A large corpus is decoded
+ * at every even offset, first with dis_decode() and then with the
+ * reference decoder, and the time per decode is reported for each.
+ *
+ * The corpus is either random, or taken from a raw binary image given
+ * on the command line.
+ */
+
+#define CORPUS_SIZE	(4 << 20)
+#define PASSES		4
+
+typedef int (*decode_func_t)(const uint8_t *code, address_t offset,
+			     address_t len, struct msp430_instruction *insn);
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void run(const char *name, decode_func_t decode,
+		const uint8_t *corpus, int len)
+{
+	unsigned long long total = 0;
+	unsigned long long count = 0;
+	const double start = now();
+	double elapsed;
+	int pass;
+	int i;
+
+	for (pass = 0; pass < PASSES; pass++)
+		for (i = 0; i + 1 < len; i += 2) {
+			struct msp430_instruction insn;
+			const int r = decode(corpus + i, i, len - i, &insn);
+
+			if (r > 0)
+				total += r + insn.op + insn.src_addr;
+
+			count++;
+		}
+
+	elapsed = now() - start;
+	printf("%-12s %8.2f ns/insn  (%llu decodes, checksum %llx)\n",
+	       name, elapsed * 1e9 / count, count, total);
+}
+
+static uint8_t *load_corpus(const char *path, int *len)
+{
+	uint8_t *buf = malloc(CORPUS_SIZE);
+	unsigned int state = 1;
+	int i;
+
+	if (!buf) {
+		perror("bench_dis: malloc");
+		exit(1);
+	}
+
+	if (path) {
+		FILE *in = fopen(path, "rb");
+
+		if (!in) {
+			perror(path);
+			exit(1);
+		}
+
+		*len = fread(buf, 1, CORPUS_SIZE, in);
+		fclose(in);
+		return buf;
+	}
+
+	for (i = 0; i < CORPUS_SIZE; i++) {
+		state = state * 1103515245 + 12345;
+		buf[i] = state >> 16;
+	}
+
+	*len = CORPUS_SIZE;
+	return buf;
+}
+
+int main(int argc, char **argv)
+{
+	int len;
+	uint8_t *corpus = load_corpus(argc > 1 ? argv[1] : NULL, &len);
+
+	run("dis_decode", dis_decode, corpus, len);
+	run("reference", dis_decode_ref, corpus, len);
+
+	free(corpus);
+	return 0;
+}
@@ -0,0 +1,216 @@
+/* MSPDebug - debugging tool for MSP430 MCUs
+ * Copyright (C) 2009, 2010 Daniel Beer
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dis.h"
+#include "dis_ref.h"
+
+/*
+ * Differential test of the instruction decoder against the reference
+ * decoder.
+ */
+
+static unsigned int rand_state;
+
+static unsigned int next_rand(void)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return rand_state >> 8;
+}
+
+static void fill_random(uint8_t *buf, int len)
+{
+	int i;
+
+	for (i = 0; i < len; i++)
+		buf[i] = next_rand();
+}
+
+/* Addresses at which code is decoded, to exercise PC-relative operands
+ * and wrapping.
+ */
+static const address_t offsets[] = {
+	0x0000, 0x4400, 0xfffa, 0xfffe, 0x10000, 0xffffa
+};
+
+static int mismatches;
+
+static void report(const uint8_t *code, address_t offset, address_t len,
+		   const char *what)
+{
+	if (mismatches++ < 10)
+		fprintf(stderr, "  mismatch (%s) at 0x%05x, len %d: "
+			"%02x %02x %02x %02x %02x %02x %02x %02x\n",
+			what, offset, len,
+			code[0], code[1], code[2], code[3],
+			code[4], code[5], code[6], code[7]);
+}
+
+static void check(const uint8_t *code, address_t offset, address_t len)
+{
+	struct msp430_instruction a;
+	struct msp430_instruction b;
+	int ra = dis_decode(code, offset, len, &a);
+	int rb = dis_decode_ref(code, offset, len, &b);
+
+	/* The reference decoder returns 1 rather than -1 if an
+	 * instruction with an extension word is truncated.
+	 */
+	if (rb == 1)
+		rb = -1;
+
+	if (ra != rb) {
+		report(code, offset, len, "length");
+		return;
+	}
+
+	if (ra < 0)
+		return;
+
+	if (a.offset != b.offset || a.len != b.len ||
+	    a.op != b.op || a.itype != b.itype || a.dsize != b.dsize)
+		report(code, offset, len, "opcode");
+	else if (a.src_mode != b.src_mode || a.src_addr != b.src_addr ||
+		 a.src_reg != b.src_reg)
+		report(code, offset, len, "source");
+	else if (a.dst_mode != b.dst_mode || a.dst_addr != b.dst_addr ||
+		 a.dst_reg != b.dst_reg)
+		report(code, offset, len, "destination");
+	else if (a.rep_index != b.rep_index ||
+		 a.rep_register != b.rep_register ||
+		 a.ignore_cy != b.ignore_cy)
+		report(code, offset, len, "extension");
+}
+
+/* Decode with every possible length, up to a complete instruction */
+static void check_all_lengths(const uint8_t *code, address_t offset)
+{
+	address_t len;
+
+	for (len = 0; len <= 8; len += 2)
+		check(code, offset, len);
+}
+
+/*
+ * Tests.
+ */
+
+static void test_all_first_words(void)
+{
+	uint8_t code[8];
+	int pattern;
+	int i;
+
+	for (pattern = 0; pattern < 4; pattern++) {
+		for (i = 0; i < 0x10000; i++) {
+			const address_t offset =
+				offsets[i % ARRAY_LEN(offsets)];
+
+			if (pattern == 0)
+				memset(code, 0, sizeof(code));
+			else if (pattern == 1)
+				memset(code, 0xff, sizeof(code));
+			else
+				fill_random(code, sizeof(code));
+
+			code[0] = i;
+			code[1] = i >> 8;
+			check_all_lengths(code, offset);
+		}
+	}
+
+	assert(!mismatches);
+}
+
+static void test_all_extension_words(void)
+{
+	uint8_t code[8];
+	int ex;
+	int i;
+
+	for (ex = 0x1800; ex < 0x2000; ex++)
+		for (i = 0; i < 1024; i++) {
+			fill_random(code, sizeof(code));
+			code[0] = ex;
+			code[1] = ex >> 8;
+			check_all_lengths(code, offsets[i % ARRAY_LEN(offsets)]);
+		}
+
+	assert(!mismatches);
+}
+
+static void test_all_extended_words(void)
+{
+	uint8_t code[8];
+	int n;
+	int i;
+
+	for (n = 0; n < 16; n++) {
+		const unsigned int ex = 0x1800 | (next_rand() & 0x7ff);
+
+		for (i = 0; i < 0x10000; i++) {
+			fill_random(code, sizeof(code));
+			code[0] = ex;
+			code[1] = ex >> 8;
+			code[2] = i;
+			code[3] = i >> 8;
+			check_all_lengths(code, offsets[i % ARRAY_LEN(offsets)]);
+		}
+	}
+
+	assert(!mismatches);
+}
+
+static void test_random_corpus(void)
+{
+	static uint8_t corpus[1 << 20];
+	int i;
+
+	fill_random(corpus, sizeof(corpus));
+
+	for (i = 0; i + 8 <= sizeof(corpus); i += 2)
+		check(corpus + i, i, sizeof(corpus) - i);
+
+	assert(!mismatches);
+}
+
+/*
+ * Test runner.
+ */
+
+static void run_test(void (*test)(), const char *test_name)
+{
+	rand_state = 1;
+
+	test();
+	printf("  PASS %s\n", test_name);
+}
+
+#define RUN_TEST(test) run_test(test, #test)
+
+int main(int argc, char **argv)
+{
+	RUN_TEST(test_all_first_words);
+	RUN_TEST(test_all_extension_words);
+	RUN_TEST(test_all_extended_words);
+	RUN_TEST(test_random_corpus);
+	return 0;
+}
@@ -45,6 +45,15 @@ static inline void thread_join(thread_t t)
 	WaitForSingleObject(t, INFINITE);
 }
 
+/* Number of processors available for running threads. */
+static inline int thread_num_cpus(void)
+{
+	SYSTEM_INFO info;
+
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors;
+}
+
 /* Windows mutexes. We use critical sections, because we don't need to
  * share between processes.
  *
@@ -104,6 +113,7 @@ static inline void thread_cond_notify(thread_cond_t *c)
 #else /* __Windows__ */
 
 #include <pthread.h>
+#include <unistd.h>
 
 /* POSIX thread creation. */
 typedef pthread_t thread_t;
@@ -118,6 +128,13 @@ static inline void thread_join(thread_t t)
 	pthread_join(t, NULL);
 }
 
+static inline int thread_num_cpus(void)
+{
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return n > 0 ? n : 1;
+}
+
 /* POSIX mutexes. */
 typedef pthread_mutex_t thread_lock_t;
 
@@ -181,6 +181,19 @@ int hexval(int c)
 	return 0;
 }
 
+uint64_t fnv64(uint64_t h, const void *data, size_t len)
+{
+	const uint8_t *d = (const uint8_t *)data;
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		h ^= d[i];
+		h *= 1099511628211ull;
+	}
+
+	return h;
+}
+
 #ifdef __Windows__
 char *strsep(char **strp, const char *delim)
 {
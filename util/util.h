@@ -20,6 +20,7 @@
 #define UTIL_H_
 
 #include <stdint.h>
+#include <stddef.h>
 #include <ctype.h>
 
 #define ARRAY_LEN(a) (sizeof(a) / sizeof((a)[0]))
@@ -52,6 +53,13 @@ static inline int ishex(int c)
 
 int hexval(int c);
 
+/* 64-bit FNV-1a hash. Start with FNV64_INIT, and feed the result back
+ * in to hash data in pieces.
+ */
+#define FNV64_INIT	14695981039346656037ull
+
+uint64_t fnv64(uint64_t h, const void *data, size_t len);
+
 #ifdef __Windows__
 char *strsep(char **strp, const char *delim);
 #endif